@@ -0,0 +1,216 @@
+#include "benchmark.h"
+#include "benchdata.h"
+#include "framedecoder.h"
+#include "networkworker.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace {
+
+// 一次套接字读取的大小，与内核接收缓冲区一次交付的数据量相当
+const size_t kReadChunk = 16 * 1024;
+
+std::vector<char> makeStream(int frames, int players) {
+    std::vector<char> stream;
+    for (int i = 0; i < frames; ++i) {
+        sanguosha::GameMessage message;
+        message.set_type(sanguosha::GAME_STATE);
+        *message.mutable_game_state() = makeGameState(players, 8, static_cast<uint32_t>(i));
+        NetworkWorker::appendFrame(message, &stream);
+    }
+    return stream;
+}
+
+// 与 NetworkWorker::onReadyRead 相同的读取方式：按块写入解码器的环形缓冲区后取出所有完整帧
+template <typename OnFrame>
+void feedStream(FrameDecoder* decoder, const std::vector<char>& stream, OnFrame onFrame) {
+    size_t offset = 0;
+    while (offset < stream.size()) {
+        size_t chunk = std::min(kReadChunk, stream.size() - offset);
+        size_t available = 0;
+        char* dest = decoder->prepareWrite(chunk, &available);
+        std::memcpy(dest, stream.data() + offset, chunk);
+        decoder->commitWrite(chunk);
+        offset += chunk;
+
+        FrameView frame;
+        while (decoder->nextFrame(frame)) {
+            onFrame(frame);
+        }
+    }
+}
+
+// 与 NetworkWorker::parseMessage 相同：直接从解码器缓冲区解析，跨越末尾时拼接两段
+bool parseFrame(const FrameView& frame, sanguosha::GameMessage* message) {
+    google::protobuf::io::ArrayInputStream firstPart(frame.first, static_cast<int>(frame.firstSize));
+    google::protobuf::io::ArrayInputStream secondPart(frame.second, static_cast<int>(frame.secondSize));
+    google::protobuf::io::ZeroCopyInputStream* parts[] = { &firstPart, &secondPart };
+    google::protobuf::io::ConcatenatingInputStream input(parts, frame.isContiguous() ? 1 : 2);
+    google::protobuf::io::CodedInputStream coded(&input);
+    return message->ParseFromCodedStream(&coded) && coded.ConsumedEntireMessage();
+}
+
+void addFrameDecode(BenchmarkRegistry* registry, int burst) {
+    std::vector<char> stream = makeStream(burst, 4);
+    registry->add("frame_decode/burst:" + std::to_string(burst), [stream](BenchmarkRun& run) {
+        FrameDecoder decoder;
+        uint64_t frames = 0;
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            feedStream(&decoder, stream, [&frames](const FrameView& frame) {
+                doNotOptimize(frame.first);
+                ++frames;
+            });
+        }
+        run.setItemsProcessed(frames);
+        run.setBytesProcessed(stream.size() * run.iterations());
+    });
+}
+
+void addReadPath(BenchmarkRegistry* registry, int burst) {
+    std::vector<char> stream = makeStream(burst, 4);
+    registry->add("read_path/burst:" + std::to_string(burst), [stream](BenchmarkRun& run) {
+        FrameDecoder decoder;
+        uint64_t frames = 0;
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            feedStream(&decoder, stream, [&frames](const FrameView& frame) {
+                // 改用 arena 之前的做法：每帧在堆上分配一条新消息，嵌套对象各自分配
+                std::unique_ptr<sanguosha::GameMessage> message(new sanguosha::GameMessage);
+                if (parseFrame(frame, message.get())) {
+                    ++frames;
+                }
+                doNotOptimize(message.get());
+            });
+        }
+        run.setItemsProcessed(frames);
+        run.setBytesProcessed(stream.size() * run.iterations());
+    });
+}
+
+void addReadPathArena(BenchmarkRegistry* registry, int burst) {
+    std::vector<char> stream = makeStream(burst, 4);
+    registry->add("read_path_arena/burst:" + std::to_string(burst), [stream](BenchmarkRun& run) {
+        FrameDecoder decoder;
+        // 与 NetworkWorker 相同：一次读取的消息解析到同一个批次 arena 上，批次分发完后重置复用
+        InboundBatch batch;
+        uint64_t frames = 0;
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            batch.reset();
+            feedStream(&decoder, stream, [&frames, &batch](const FrameView& frame) {
+                sanguosha::GameMessage* message =
+                    google::protobuf::Arena::CreateMessage<sanguosha::GameMessage>(&batch.arena);
+                if (parseFrame(frame, message)) {
+                    batch.messages.push_back(message);
+                    ++frames;
+                }
+                doNotOptimize(message);
+            });
+        }
+        run.setItemsProcessed(frames);
+        run.setBytesProcessed(stream.size() * run.iterations());
+    });
+}
+
+void addParseSerialize(BenchmarkRegistry* registry, int players) {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    *message.mutable_game_state() = makeGameState(players, 8);
+    std::string wire = message.SerializeAsString();
+    std::string suffix = "/players:" + std::to_string(players);
+
+    registry->add("game_state_parse" + suffix, [wire](BenchmarkRun& run) {
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            sanguosha::GameMessage parsed;
+            parsed.ParseFromArray(wire.data(), static_cast<int>(wire.size()));
+            doNotOptimize(parsed.game_state().players_size());
+        }
+        run.setItemsProcessed(run.iterations());
+        run.setBytesProcessed(wire.size() * run.iterations());
+    });
+
+    registry->add("game_state_parse_arena" + suffix, [wire](BenchmarkRun& run) {
+        InboundBatch batch;
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            batch.reset();
+            sanguosha::GameMessage* parsed =
+                google::protobuf::Arena::CreateMessage<sanguosha::GameMessage>(&batch.arena);
+            parsed->ParseFromArray(wire.data(), static_cast<int>(wire.size()));
+            doNotOptimize(parsed->game_state().players_size());
+        }
+        run.setItemsProcessed(run.iterations());
+        run.setBytesProcessed(wire.size() * run.iterations());
+    });
+
+    registry->add("game_state_serialize" + suffix, [message, wire](BenchmarkRun& run) {
+        std::vector<char> buffer(wire.size());
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            message.SerializeToArray(buffer.data(), static_cast<int>(buffer.size()));
+            doNotOptimize(buffer.data());
+        }
+        run.setItemsProcessed(run.iterations());
+        run.setBytesProcessed(wire.size() * run.iterations());
+    });
+}
+
+void addSendEncode(BenchmarkRegistry* registry, const std::string& name,
+                   const sanguosha::GameMessage& message, size_t compressThreshold) {
+    // 与 sendMessage 相同：序列化进复用的发送缓冲区
+    registry->add(name, [message, compressThreshold](BenchmarkRun& run) {
+        std::vector<char> buffer;
+        uint64_t bytes = 0;
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            buffer.clear();
+            NetworkWorker::appendFrame(message, &buffer, compressThreshold);
+            bytes += buffer.size();
+            doNotOptimize(buffer.data());
+        }
+        run.setItemsProcessed(run.iterations());
+        run.setBytesProcessed(bytes);
+    });
+}
+
+}
+
+void registerNetworkBenchmarks(BenchmarkRegistry* registry) {
+    for (int burst : { 1, 16, 256 }) {
+        addFrameDecode(registry, burst);
+    }
+    for (int burst : { 1, 16, 256 }) {
+        addReadPath(registry, burst);
+        addReadPathArena(registry, burst);
+    }
+    for (int players : { 2, 4, 8 }) {
+        addParseSerialize(registry, players);
+    }
+
+    sanguosha::GameMessage action;
+    action.set_type(sanguosha::GAME_ACTION);
+    action.mutable_game_action()->set_type(sanguosha::ACTION_PLAY_CARD);
+    action.mutable_game_action()->set_card_id(1);
+    action.mutable_game_action()->set_target_player(2);
+    action.mutable_game_action()->set_sequence(42);
+    addSendEncode(registry, "send_encode/game_action", action, 0);
+
+    sanguosha::GameMessage state;
+    state.set_type(sanguosha::GAME_STATE);
+    *state.mutable_game_state() = makeGameState(8, 8);
+    addSendEncode(registry, "send_encode/game_state", state, 0);
+
+    // 大房间列表超过压缩阈值，对比压缩前后的编码开销
+    sanguosha::GameMessage roomList;
+    roomList.set_type(sanguosha::ROOM_LIST_RESPONSE);
+    for (uint32_t id = 1; id <= 200; ++id) {
+        sanguosha::RoomInfo* room = roomList.mutable_room_list_response()->add_rooms();
+        room->set_room_id(id);
+        room->add_players(id * 2);
+        room->set_current_players(1);
+        room->set_max_players(2);
+        room->set_status(sanguosha::WAITING);
+    }
+    addSendEncode(registry, "send_encode/room_list", roomList, 0);
+    addSendEncode(registry, "send_encode/room_list_compressed", roomList, kDefaultCompressThreshold);
+}
@@ -0,0 +1,139 @@
+#include "benchmark.h"
+#include "benchdata.h"
+#include "clientgamestate.h"
+#include "gamelogmodel.h"
+#include "handcardswidget.h"
+#include "mainwindow.h"
+#include "playertablemodel.h"
+#include <QApplication>
+#include <QListView>
+#include <QTableView>
+#include <string>
+
+// 界面更新路径：先分别驱动玩家表模型、手牌控件和日志模型，
+// 再经 MainWindow::handleGameStateInUIThread 测量一次状态更新的完整开销。
+// 每次更新后处理一次事件，把布局和绘制（offscreen 平台）一并计入。
+namespace {
+
+void addPlayerTable(BenchmarkRegistry* registry, int players) {
+    registry->add("ui_player_table/players:" + std::to_string(players), [players](BenchmarkRun& run) {
+        ClientGameState states[2];
+        for (uint32_t variant = 0; variant < 2; ++variant) {
+            states[variant].setSelfId(1);
+            states[variant].applyState(makeGameState(players, 8, variant));
+        }
+
+        PlayerTableModel model;
+        QTableView view;
+        view.setModel(&model);
+        view.resize(400, 300);
+        view.show();
+        QApplication::processEvents();
+
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            model.updateFromState(states[i % 2]);
+            QApplication::processEvents();
+        }
+        run.setItemsProcessed(run.iterations());
+    });
+}
+
+void addHandCards(BenchmarkRegistry* registry, int handSize) {
+    registry->add("ui_hand_cards/cards:" + std::to_string(handSize), [handSize](BenchmarkRun& run) {
+        // 两手牌只有第一张不同，对应出一张牌再摸一张牌
+        std::vector<uint32_t> hands[2];
+        for (uint32_t variant = 0; variant < 2; ++variant) {
+            ClientGameState state;
+            state.setSelfId(1);
+            state.applyState(makeGameState(4, handSize, variant));
+            hands[variant] = state.hand();
+        }
+
+        HandCardsWidget widget;
+        widget.resize(800, 140);
+        widget.show();
+        QApplication::processEvents();
+
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            widget.setCards(hands[i % 2]);
+            QApplication::processEvents();
+        }
+        run.setItemsProcessed(run.iterations());
+    });
+}
+
+void addGameLog(BenchmarkRegistry* registry, int linesPerUpdate) {
+    registry->add("ui_game_log/lines:" + std::to_string(linesPerUpdate), [linesPerUpdate](BenchmarkRun& run) {
+        GameLogModel model(1000);
+        QListView view;
+        view.setModel(&model);
+        view.setUniformItemSizes(true);
+        view.resize(400, 300);
+        view.show();
+        QApplication::processEvents();
+
+        const QString line = QStringLiteral("玩家1对玩家2使用了【杀】，玩家2体力-1");
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            for (int n = 0; n < linesPerUpdate; ++n) {
+                model.append(line);
+            }
+            // 与界面一致，每帧统一写入一次
+            model.flush();
+            QApplication::processEvents();
+        }
+        run.setItemsProcessed(run.iterations() * static_cast<uint64_t>(linesPerUpdate));
+    });
+}
+
+void addMainWindow(BenchmarkRegistry* registry, int players) {
+    registry->add("ui_main_window_state/players:" + std::to_string(players), [players](BenchmarkRun& run) {
+        sanguosha::GameState states[2];
+        for (uint32_t variant = 0; variant < 2; ++variant) {
+            states[variant] = makeGameState(players, 8, variant);
+        }
+
+        // 不连接服务器，登录和开局消息直接交给界面，进入对局界面后再反复推送状态
+        MainWindow window(nullptr, false);
+        window.resize(1024, 768);
+        window.show();
+
+        sanguosha::LoginResponse login;
+        login.set_success(true);
+        login.set_user_id(1);
+        QMetaObject::invokeMethod(&window, "handleLoginResponse", Qt::DirectConnection,
+                                  Q_ARG(sanguosha::LoginResponse, login));
+
+        sanguosha::GameStart start;
+        start.set_room_id(1);
+        for (const sanguosha::PlayerState& player : states[0].players()) {
+            start.add_player_ids(player.player_id());
+        }
+        QMetaObject::invokeMethod(&window, "handleGameStartInUIThread", Qt::DirectConnection,
+                                  Q_ARG(sanguosha::GameStart, start));
+        QApplication::processEvents();
+
+        for (uint64_t i = 0; i < run.iterations(); ++i) {
+            QMetaObject::invokeMethod(&window, "handleGameStateInUIThread", Qt::DirectConnection,
+                                      Q_ARG(sanguosha::GameState, states[i % 2]));
+            QApplication::processEvents();
+        }
+        run.setItemsProcessed(run.iterations());
+    });
+}
+
+}
+
+void registerUiBenchmarks(BenchmarkRegistry* registry) {
+    for (int players : { 2, 8 }) {
+        addPlayerTable(registry, players);
+    }
+    for (int handSize : { 4, 16 }) {
+        addHandCards(registry, handSize);
+    }
+    for (int lines : { 1, 32 }) {
+        addGameLog(registry, lines);
+    }
+    for (int players : { 2, 8 }) {
+        addMainWindow(registry, players);
+    }
+}
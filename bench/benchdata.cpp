@@ -0,0 +1,26 @@
+#include "benchdata.h"
+#include <string>
+
+sanguosha::GameState makeGameState(int players, int handSize, uint32_t variant) {
+    sanguosha::GameState state;
+    state.set_current_player(1 + variant % static_cast<uint32_t>(players));
+    state.set_phase(sanguosha::PLAY_PHASE);
+    state.set_version(variant + 1);
+    state.set_game_log("玩家1对玩家2使用了【杀】，玩家2体力-1");
+    for (int i = 0; i < players; ++i) {
+        sanguosha::PlayerState* player = state.add_players();
+        player->set_player_id(static_cast<uint32_t>(i + 1));
+        player->set_username("玩家" + std::to_string(i + 1));
+        player->set_max_hp(4);
+        player->set_hp(1 + (variant + static_cast<uint32_t>(i)) % 4);
+        // 每次变化只替换一张手牌，接近真实对局中的增量
+        for (int card = 0; card < handSize; ++card) {
+            uint32_t id = 1 + static_cast<uint32_t>(card + i) % 6;
+            if (card == 0) {
+                id = 1 + (variant + static_cast<uint32_t>(i)) % 6;
+            }
+            player->add_hand_cards(id);
+        }
+    }
+    return state;
+}
@@ -0,0 +1,11 @@
+#ifndef BENCH_DATA_H
+#define BENCH_DATA_H
+
+#include <cstdint>
+#include "sanguosha.pb.h"
+
+// 基准测试使用的游戏状态：玩家ID从1开始，1号是当前玩家，
+// variant 不同时血量、手牌和日志略有变化，用于模拟连续的状态更新
+sanguosha::GameState makeGameState(int players, int handSize, uint32_t variant = 0);
+
+#endif // BENCH_DATA_H
@@ -0,0 +1,180 @@
+#include "benchmark.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+
+namespace {
+std::atomic<uint64_t> g_allocations{0};
+
+void* countedAllocate(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+}
+
+// 替换全局分配函数，只计数，实际分配仍交给 malloc
+void* operator new(std::size_t size) {
+    if (void* p = countedAllocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAllocate(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+uint64_t allocationCount() {
+    return g_allocations.load(std::memory_order_relaxed);
+}
+
+void BenchmarkRegistry::add(const std::string& name, Body body) {
+    m_entries.push_back({ name, std::move(body) });
+}
+
+std::vector<BenchmarkResult> BenchmarkRegistry::run(const std::string& filter, double minTimeSec,
+                                                    int repetitions) const {
+    using Clock = std::chrono::steady_clock;
+    std::vector<BenchmarkResult> results;
+
+    for (const Entry& entry : m_entries) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        // 次数按10倍递增，直到单次运行超过最短时间的十分之一，再按比例算出正式次数
+        uint64_t iterations = 1;
+        for (;;) {
+            BenchmarkRun calibration(iterations);
+            Clock::time_point start = Clock::now();
+            entry.body(calibration);
+            double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            if (elapsed >= minTimeSec / 10 || iterations >= (1ull << 40)) {
+                double scale = elapsed > 0 ? minTimeSec / elapsed : 10.0;
+                iterations = std::max<uint64_t>(1, static_cast<uint64_t>(iterations * scale));
+                break;
+            }
+            iterations *= 10;
+        }
+
+        std::vector<BenchmarkResult> samples;
+        for (int i = 0; i < std::max(1, repetitions); ++i) {
+            BenchmarkRun run(iterations);
+            uint64_t allocationsBefore = allocationCount();
+            std::clock_t cpuStart = std::clock();
+            Clock::time_point start = Clock::now();
+            entry.body(run);
+            double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            double cpuElapsed = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+            uint64_t allocations = allocationCount() - allocationsBefore;
+
+            BenchmarkResult sample;
+            sample.name = entry.name;
+            sample.iterations = iterations;
+            sample.repetitions = std::max(1, repetitions);
+            sample.nsPerIteration = elapsed * 1e9 / static_cast<double>(iterations);
+            sample.cpuNsPerIteration = cpuElapsed * 1e9 / static_cast<double>(iterations);
+            uint64_t items = run.itemsProcessed() > 0 ? run.itemsProcessed() : iterations;
+            sample.allocationsPerItem = static_cast<double>(allocations) / static_cast<double>(items);
+            if (elapsed > 0) {
+                sample.itemsPerSecond = static_cast<double>(run.itemsProcessed()) / elapsed;
+                sample.bytesPerSecond = static_cast<double>(run.bytesProcessed()) / elapsed;
+            }
+            samples.push_back(sample);
+        }
+
+        // 取中位数，减少偶发的调度抖动
+        std::sort(samples.begin(), samples.end(), [](const BenchmarkResult& a, const BenchmarkResult& b) {
+            return a.nsPerIteration < b.nsPerIteration;
+        });
+        results.push_back(samples[samples.size() / 2]);
+    }
+    return results;
+}
+
+void BenchmarkRegistry::printTable(const std::vector<BenchmarkResult>& results) {
+    std::printf("%-40s %12s %14s %14s %12s %12s\n", "benchmark", "iterations", "ns/iter", "items/s", "MB/s",
+                "allocs/item");
+    for (const BenchmarkResult& result : results) {
+        std::printf("%-40s %12llu %14.1f %14.0f %12.2f %12.2f\n", result.name.c_str(),
+                    static_cast<unsigned long long>(result.iterations), result.nsPerIteration,
+                    result.itemsPerSecond, result.bytesPerSecond / (1024.0 * 1024.0),
+                    result.allocationsPerItem);
+    }
+}
+
+std::string BenchmarkRegistry::toJson(const std::vector<BenchmarkResult>& results) {
+    // 输出 Google Benchmark 的 JSON 格式，tools/compare.py 等现有脚本可以直接读取。
+    // 重复多次时只输出中位数，与 --benchmark_report_aggregates_only 的输出相同；
+    // allocs_per_item 对应 Google Benchmark 的用户计数器
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::string json = "{\n  \"context\": {\n    \"date\": \"";
+    json += date;
+    json += "\",\n    \"executable\": \"sanguosha_bench\",\n";
+#ifdef NDEBUG
+    json += "    \"library_build_type\": \"release\"\n";
+#else
+    json += "    \"library_build_type\": \"debug\"\n";
+#endif
+    json += "  },\n  \"benchmarks\": [\n";
+    char line[768];
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        const bool aggregate = result.repetitions > 1;
+        const std::string name = aggregate ? result.name + "_median" : result.name;
+        std::snprintf(line, sizeof(line),
+                      "    {\"name\": \"%s\", \"run_name\": \"%s\", \"run_type\": \"%s\", %s"
+                      "\"repetitions\": %d, \"threads\": 1, \"iterations\": %llu, "
+                      "\"real_time\": %.3f, \"cpu_time\": %.3f, \"time_unit\": \"ns\", "
+                      "\"items_per_second\": %.3f, \"bytes_per_second\": %.3f, "
+                      "\"allocs_per_item\": %.3f}%s\n",
+                      name.c_str(), result.name.c_str(), aggregate ? "aggregate" : "iteration",
+                      aggregate ? "\"aggregate_name\": \"median\", " : "",
+                      result.repetitions, static_cast<unsigned long long>(result.iterations),
+                      result.nsPerIteration, result.cpuNsPerIteration,
+                      result.itemsPerSecond, result.bytesPerSecond, result.allocationsPerItem,
+                      i + 1 < results.size() ? "," : "");
+        json += line;
+    }
+    json += "  ]\n}\n";
+    return json;
+}
@@ -0,0 +1,77 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// 极简的基准测试框架，不依赖第三方库。
+// 每个基准自行循环 iterations() 次；框架自动增加次数直到单次运行超过最短时间，
+// 重复若干次取中位数，结果可以输出为 Google Benchmark 格式的 JSON 供版本间比较。
+// 基准程序替换了全局 operator new，同时统计每个条目平均的堆分配次数。
+class BenchmarkRun
+{
+public:
+    explicit BenchmarkRun(uint64_t iterations) : m_iterations(iterations) {}
+
+    uint64_t iterations() const { return m_iterations; }
+    // 整次运行处理的条目数（帧、消息等）和字节数，用于计算吞吐
+    void setItemsProcessed(uint64_t items) { m_items = items; }
+    void setBytesProcessed(uint64_t bytes) { m_bytes = bytes; }
+
+    uint64_t itemsProcessed() const { return m_items; }
+    uint64_t bytesProcessed() const { return m_bytes; }
+
+private:
+    uint64_t m_iterations;
+    uint64_t m_items = 0;
+    uint64_t m_bytes = 0;
+};
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations = 0;
+    int repetitions = 1;
+    double nsPerIteration = 0.0;
+    double cpuNsPerIteration = 0.0;    // 进程 CPU 时间，包括网络工作线程
+    double itemsPerSecond = 0.0;
+    double bytesPerSecond = 0.0;
+    double allocationsPerItem = 0.0;   // 没有设置条目数时按每次迭代计
+};
+
+class BenchmarkRegistry
+{
+public:
+    using Body = std::function<void(BenchmarkRun&)>;
+
+    void add(const std::string& name, Body body);
+
+    // 只运行名称包含 filter 的基准
+    std::vector<BenchmarkResult> run(const std::string& filter, double minTimeSec, int repetitions) const;
+
+    static void printTable(const std::vector<BenchmarkResult>& results);
+    static std::string toJson(const std::vector<BenchmarkResult>& results);
+
+private:
+    struct Entry {
+        std::string name;
+        Body body;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+// 进程启动以来 operator new 被调用的次数
+uint64_t allocationCount();
+
+// 阻止编译器把结果未被使用的计算优化掉
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+void registerNetworkBenchmarks(BenchmarkRegistry* registry);
+void registerUiBenchmarks(BenchmarkRegistry* registry);
+
+#endif // BENCHMARK_H
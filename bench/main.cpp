@@ -0,0 +1,52 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QLoggingCategory>
+#include <cstdio>
+#include "benchmark.h"
+
+// 网络和界面更新热点路径的基准测试。
+// 界面部分默认使用 offscreen 平台，可以在没有显示器的机器上运行。
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+    }
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("sanguosha_bench");
+    QLoggingCategory::setFilterRules("*.debug=false");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Microbenchmarks for the network and UI update paths");
+    parser.addHelpOption();
+    QCommandLineOption filterOption("filter", "Only run benchmarks whose name contains this text.", "text");
+    QCommandLineOption minTimeOption("min-time", "Minimum time per repetition in seconds.", "sec", "0.2");
+    QCommandLineOption repetitionsOption("repetitions", "Repetitions per benchmark; the median is reported.", "n", "3");
+    QCommandLineOption jsonOption("json", "Write results as JSON to this file ('-' for stdout).", "file");
+    parser.addOptions({ filterOption, minTimeOption, repetitionsOption, jsonOption });
+    parser.process(app);
+
+    BenchmarkRegistry registry;
+    registerNetworkBenchmarks(&registry);
+    registerUiBenchmarks(&registry);
+
+    std::vector<BenchmarkResult> results = registry.run(parser.value(filterOption).toStdString(),
+                                                        parser.value(minTimeOption).toDouble(),
+                                                        parser.value(repetitionsOption).toInt());
+
+    QString jsonPath = parser.value(jsonOption);
+    if (jsonPath == "-") {
+        std::fputs(BenchmarkRegistry::toJson(results).c_str(), stdout);
+        return 0;
+    }
+    BenchmarkRegistry::printTable(results);
+    if (!jsonPath.isEmpty()) {
+        QFile file(jsonPath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            std::fprintf(stderr, "Cannot write %s\n", qPrintable(jsonPath));
+            return 1;
+        }
+        file.write(QByteArray::fromStdString(BenchmarkRegistry::toJson(results)));
+    }
+    return 0;
+}
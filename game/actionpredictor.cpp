@@ -0,0 +1,148 @@
+#include "actionpredictor.h"
+#include <algorithm>
+
+ActionPredictor::ActionPredictor()
+    : m_nextSequence(1),
+      m_timeoutMs(3000),
+      m_corrections(0),
+      m_enabled(false) {
+}
+
+void ActionPredictor::setEnabled(bool enabled) {
+    m_enabled = enabled;
+    if (!enabled) {
+        m_pending.clear();
+    }
+}
+
+uint32_t ActionPredictor::predictPlayCard(ClientGameState* state, uint32_t cardId,
+                                          uint32_t targetPlayer, int64_t nowMs) {
+    if (!m_enabled) {
+        return 0;
+    }
+
+    Prediction prediction;
+    prediction.sequence = m_nextSequence++;
+    if (m_nextSequence == 0) {
+        m_nextSequence = 1; // 0 保留给不需要确认的操作
+    }
+    prediction.cardId = cardId;
+    prediction.targetPlayer = targetPlayer;
+    prediction.sentAtMs = nowMs;
+    applyEffect(state, &prediction);
+    m_pending.push_back(prediction);
+    return prediction.sequence;
+}
+
+ActionPredictor::ReconcileResult ActionPredictor::reconcile(ClientGameState* state, uint32_t ackedSequence,
+                                                            int64_t nowMs) {
+    ReconcileResult result;
+    if (!m_enabled) {
+        return result;
+    }
+
+    size_t acked = 0;
+    while (ackedSequence != 0 && acked < m_pending.size()
+           && sequenceNotAfter(m_pending[acked].sequence, ackedSequence)) {
+        ++acked;
+    }
+
+    // 权威状态已包含所有已确认操作的累计效果，同一种牌、同一个目标只需核对最后一次预测
+    uint32_t checkedCards[8];
+    uint32_t checkedTargets[8];
+    size_t cardCount = 0;
+    size_t targetCount = 0;
+    for (size_t i = acked; i-- > 0;) {
+        const Prediction& prediction = m_pending[i];
+        if (!prediction.applied) {
+            continue;
+        }
+        bool checkCard = std::find(checkedCards, checkedCards + cardCount, prediction.cardId)
+                         == checkedCards + cardCount;
+        bool checkHp = prediction.hpPredicted
+                       && std::find(checkedTargets, checkedTargets + targetCount, prediction.targetPlayer)
+                          == checkedTargets + targetCount;
+        if (checkCard && cardCount < 8) {
+            checkedCards[cardCount++] = prediction.cardId;
+        }
+        if (checkHp && targetCount < 8) {
+            checkedTargets[targetCount++] = prediction.targetPlayer;
+        }
+        if (!matches(*state, prediction, checkCard, checkHp)) {
+            ++result.corrected;
+        }
+    }
+    result.confirmed = static_cast<int>(acked);
+    m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(acked));
+
+    // 迟迟得不到确认的预测（操作丢失或服务器不处理）直接回退
+    while (!m_pending.empty() && nowMs - m_pending.front().sentAtMs >= m_timeoutMs) {
+        m_pending.pop_front();
+        ++result.corrected;
+    }
+
+    // 仍在途中的操作重放到新的权威状态上
+    for (Prediction& prediction : m_pending) {
+        applyEffect(state, &prediction);
+    }
+
+    m_corrections += static_cast<uint64_t>(result.corrected);
+    return result;
+}
+
+void ActionPredictor::reset() {
+    m_pending.clear();
+}
+
+void ActionPredictor::applyEffect(ClientGameState* state, Prediction* prediction) {
+    std::vector<uint32_t>& hand = state->mutableHand();
+    auto it = std::find(hand.begin(), hand.end(), prediction->cardId);
+    prediction->applied = it != hand.end();
+    prediction->hpPredicted = false;
+    if (!prediction->applied) {
+        return;
+    }
+
+    hand.erase(it);
+    prediction->cardsLeft = static_cast<uint32_t>(std::count(hand.begin(), hand.end(), prediction->cardId));
+    if (ClientPlayer* self = state->findPlayer(state->selfId())) {
+        if (self->handCardCount > 0) {
+            --self->handCardCount;
+        }
+    }
+
+    // 只预测确定性的效果：杀扣对方1点体力（可能被闪抵消，届时按权威状态修正），桃回复1点体力
+    ClientPlayer* target = state->findPlayer(prediction->targetPlayer);
+    if (!target) {
+        return;
+    }
+    if (prediction->cardId == sanguosha::CARD_ATTACK && target->playerId != state->selfId()) {
+        if (target->hp > 0) {
+            --target->hp;
+        }
+    } else if (prediction->cardId == sanguosha::CARD_HEAL) {
+        target->hp = std::min(target->hp + 1, target->maxHp);
+    } else {
+        return;
+    }
+    prediction->hpPredicted = true;
+    prediction->targetHp = target->hp;
+}
+
+bool ActionPredictor::matches(const ClientGameState& state, const Prediction& prediction,
+                              bool checkCard, bool checkHp) {
+    if (checkCard) {
+        const std::vector<uint32_t>& hand = state.hand();
+        // 牌又回到手里说明出牌被拒绝
+        if (static_cast<uint32_t>(std::count(hand.begin(), hand.end(), prediction.cardId)) > prediction.cardsLeft) {
+            return false;
+        }
+    }
+    if (checkHp) {
+        const ClientPlayer* target = state.findPlayer(prediction.targetPlayer);
+        if (target && target->hp != prediction.targetHp) {
+            return false;
+        }
+    }
+    return true;
+}
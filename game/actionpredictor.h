@@ -0,0 +1,69 @@
+#ifndef ACTION_PREDICTOR_H
+#define ACTION_PREDICTOR_H
+
+#include <cstdint>
+#include <deque>
+#include "clientgamestate.h"
+
+// 出牌的本地预测，不依赖Qt，时间由调用方传入，须取自单调时钟。
+// 发出出牌操作时立即在 ClientGameState 上应用预测效果并分配操作序号；
+// 权威状态到达后丢弃服务器已处理的预测，把仍未确认的预测重放到新状态上。
+// 已确认的预测与权威状态不一致（出牌被拒绝、杀被闪避等）时计为一次修正。
+class ActionPredictor
+{
+public:
+    struct ReconcileResult {
+        int confirmed = 0;   // 本次被服务器确认的预测数量
+        int corrected = 0;   // 其中结果与预测不一致、界面需要回退的数量
+    };
+
+    ActionPredictor();
+
+    // 只有服务器回传操作序号时才能启用，否则预测永远得不到确认
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return m_enabled; }
+    // 超过该时限仍未确认的预测视为丢失并回退
+    void setTimeoutMs(int64_t timeoutMs) { m_timeoutMs = timeoutMs; }
+    int64_t timeoutMs() const { return m_timeoutMs; }
+    // 下一次出牌从指定序号开始编号，0 按 1 处理
+    void setNextSequence(uint32_t sequence) { m_nextSequence = sequence != 0 ? sequence : 1; }
+
+    // 应用一次出牌的预测效果，返回本次操作的序号；未启用时返回0且不修改状态
+    uint32_t predictPlayCard(ClientGameState* state, uint32_t cardId, uint32_t targetPlayer, int64_t nowMs);
+
+    // 在 state 刚应用完权威状态之后调用；序号按32位回绕比较，0 表示服务器还没有处理过任何操作
+    ReconcileResult reconcile(ClientGameState* state, uint32_t ackedSequence, int64_t nowMs);
+
+    void reset();
+
+    size_t pendingCount() const { return m_pending.size(); }
+    // 最早一个未确认预测的超时时刻，没有未确认预测时返回 -1
+    int64_t nextDeadlineMs() const { return m_pending.empty() ? -1 : m_pending.front().sentAtMs + m_timeoutMs; }
+    uint64_t correctionCount() const { return m_corrections; }
+
+private:
+    struct Prediction {
+        uint32_t sequence = 0;
+        uint32_t cardId = 0;
+        uint32_t targetPlayer = 0;
+        int64_t sentAtMs = 0;
+        bool applied = false;         // 手牌中找到了这张牌并应用了效果
+        uint32_t cardsLeft = 0;       // 预测后手牌中同种牌的数量
+        bool hpPredicted = false;
+        uint32_t targetHp = 0;        // 预测后目标的体力
+    };
+
+    static void applyEffect(ClientGameState* state, Prediction* prediction);
+    // a 不晚于 b，按序号空间的一半判断先后，序号回绕后仍然成立
+    static bool sequenceNotAfter(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) <= 0; }
+    static bool matches(const ClientGameState& state, const Prediction& prediction,
+                        bool checkCard, bool checkHp);
+
+    std::deque<Prediction> m_pending;
+    uint32_t m_nextSequence;
+    int64_t m_timeoutMs;
+    uint64_t m_corrections;
+    bool m_enabled;
+};
+
+#endif // ACTION_PREDICTOR_H
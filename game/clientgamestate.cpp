@@ -0,0 +1,117 @@
+#include "clientgamestate.h"
+
+ClientGameState::ClientGameState()
+    : m_selfId(0),
+      m_currentPlayer(0),
+      m_phase(sanguosha::PHASE_UNKNOWN),
+      m_hasState(false),
+      m_stateCopies(&MetricsRegistry::instance().counter("dispatch.state_copies")) {
+    m_players.reserve(kMaxPlayers);
+    m_hand.reserve(16);
+    rebuildIndex();
+}
+
+void ClientGameState::applyState(const sanguosha::GameState& state) {
+    m_currentPlayer = state.current_player();
+    m_phase = state.phase();
+    m_hasState = true;
+    m_stateCopies->add();
+
+    // 原地更新，复用已有的字符串和数组容量；座位上的玩家变化时才重建索引
+    const int count = state.players_size() < kMaxPlayers ? state.players_size() : kMaxPlayers;
+    bool seatsChanged = m_players.size() != static_cast<size_t>(count);
+    m_players.resize(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        const sanguosha::PlayerState& source = state.players(i);
+        ClientPlayer& player = m_players[static_cast<size_t>(i)];
+        if (player.playerId != source.player_id()) {
+            player.playerId = source.player_id();
+            seatsChanged = true;
+        }
+        if (player.username != source.username()) {
+            player.username = source.username();
+        }
+        player.hp = source.hp();
+        player.maxHp = source.max_hp();
+        player.handCardCount = static_cast<uint32_t>(source.hand_cards_size());
+
+        if (source.player_id() == m_selfId) {
+            m_hand.assign(source.hand_cards().begin(), source.hand_cards().end());
+        }
+    }
+
+    if (seatsChanged) {
+        rebuildIndex();
+    }
+    if (!findPlayer(m_selfId)) {
+        m_hand.clear();
+    }
+}
+
+void ClientGameState::reset() {
+    m_players.clear();
+    rebuildIndex();
+    m_hand.clear();
+    m_currentPlayer = 0;
+    m_phase = sanguosha::PHASE_UNKNOWN;
+    m_hasState = false;
+}
+
+const ClientPlayer* ClientGameState::findPlayer(uint32_t playerId) const {
+    for (size_t slot = slotOf(playerId); m_index[slot].seat >= 0; slot = (slot + 1) % kIndexSlots) {
+        if (m_index[slot].playerId == playerId) {
+            return &m_players[static_cast<size_t>(m_index[slot].seat)];
+        }
+    }
+    return nullptr;
+}
+
+ClientPlayer* ClientGameState::findPlayer(uint32_t playerId) {
+    return const_cast<ClientPlayer*>(static_cast<const ClientGameState*>(this)->findPlayer(playerId));
+}
+
+size_t ClientGameState::slotOf(uint32_t playerId) {
+    // 乘法散列取高位，连续的ID也能分散到不同槽位
+    return static_cast<size_t>((playerId * 2654435761u) >> 28) % kIndexSlots;
+}
+
+void ClientGameState::rebuildIndex() {
+    for (IndexSlot& slot : m_index) {
+        slot.seat = -1;
+    }
+    for (size_t seat = 0; seat < m_players.size(); ++seat) {
+        uint32_t playerId = m_players[seat].playerId;
+        size_t slot = slotOf(playerId);
+        while (m_index[slot].seat >= 0 && m_index[slot].playerId != playerId) {
+            slot = (slot + 1) % kIndexSlots;
+        }
+        // 同一ID出现多次时保留第一个座位，与按座位顺序扫描的结果一致
+        if (m_index[slot].seat < 0) {
+            m_index[slot].playerId = playerId;
+            m_index[slot].seat = static_cast<int>(seat);
+        }
+    }
+}
+
+bool ClientGameState::selfAlive() const {
+    const ClientPlayer* self = findPlayer(m_selfId);
+    return !self || self->isAlive();
+}
+
+bool ClientGameState::anyPlayerDead() const {
+    for (const ClientPlayer& player : m_players) {
+        if (!player.isAlive()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t ClientGameState::firstOpponent() const {
+    for (const ClientPlayer& player : m_players) {
+        if (player.playerId != m_selfId) {
+            return player.playerId;
+        }
+    }
+    return 0;
+}
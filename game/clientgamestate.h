@@ -0,0 +1,78 @@
+#ifndef CLIENT_GAME_STATE_H
+#define CLIENT_GAME_STATE_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "metrics.h"
+#include "sanguosha.pb.h"
+
+// 客户端的对局状态存储，与界面控件无关。
+// 每收到一次 GameState 更新一次，界面和出牌逻辑都从这里读取，不再解析表格文本。
+struct ClientPlayer {
+    uint32_t playerId = 0;
+    std::string username;
+    uint32_t hp = 0;
+    uint32_t maxHp = 0;
+    uint32_t handCardCount = 0;
+
+    bool isAlive() const { return hp > 0; }
+};
+
+class ClientGameState
+{
+public:
+    // 一局最多8名玩家，按座位顺序放在连续数组里；快照中超出的玩家被忽略
+    static const int kMaxPlayers = 8;
+
+    ClientGameState();
+
+    void setSelfId(uint32_t selfId) { m_selfId = selfId; }
+    uint32_t selfId() const { return m_selfId; }
+
+    void applyState(const sanguosha::GameState& state);
+    void reset();
+
+    bool hasState() const { return m_hasState; }
+    uint32_t currentPlayer() const { return m_currentPlayer; }
+    sanguosha::GamePhase phase() const { return m_phase; }
+    bool isMyTurn() const { return m_hasState && m_currentPlayer == m_selfId; }
+
+    int playerCount() const { return static_cast<int>(m_players.size()); }
+    const ClientPlayer& playerAt(int index) const { return m_players[index]; }
+    // 按ID查找，O(1)；找不到时返回 nullptr
+    const ClientPlayer* findPlayer(uint32_t playerId) const;
+    ClientPlayer* findPlayer(uint32_t playerId);
+
+    // 自己的手牌
+    const std::vector<uint32_t>& hand() const { return m_hand; }
+    std::vector<uint32_t>& mutableHand() { return m_hand; }
+
+    bool selfAlive() const;
+    bool anyPlayerDead() const;
+    // 第一个不是自己的玩家，找不到时返回0
+    uint32_t firstOpponent() const;
+
+private:
+    // 玩家ID到座位下标的索引：线性探测的定长散列表，槽位数是玩家上限的两倍，探测总能遇到空槽
+    static const int kIndexSlots = 2 * kMaxPlayers;
+    struct IndexSlot {
+        uint32_t playerId;
+        int seat;   // -1 表示空槽
+    };
+
+    static size_t slotOf(uint32_t playerId);
+    void rebuildIndex();
+
+    std::vector<ClientPlayer> m_players;
+    std::array<IndexSlot, kIndexSlots> m_index;
+    std::vector<uint32_t> m_hand;
+    uint32_t m_selfId;
+    uint32_t m_currentPlayer;
+    sanguosha::GamePhase m_phase;
+    bool m_hasState;
+    MetricCounter* m_stateCopies;   // 每应用一次快照，玩家信息和手牌都拷贝一份
+};
+
+#endif // CLIENT_GAME_STATE_H
@@ -0,0 +1,96 @@
+#include "gamelogmodel.h"
+#include <QTime>
+#include <algorithm>
+
+GameLogModel::GameLogModel(int capacity, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_entries(std::max(capacity, 1))
+    , m_start(0)
+    , m_count(0)
+    , m_flushTimer(new QTimer(this))
+{
+    // 每帧最多写入一次
+    m_flushTimer->setSingleShot(true);
+    m_flushTimer->setInterval(16);
+    connect(m_flushTimer, &QTimer::timeout, this, &GameLogModel::flush);
+}
+
+int GameLogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_count;
+}
+
+QVariant GameLogModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_count || role != Qt::DisplayRole) {
+        return QVariant();
+    }
+
+    const Entry &entry = entryAt(index.row());
+    QString timestamp = QTime::fromMSecsSinceStartOfDay(entry.timeMs).toString("hh:mm:ss");
+    return QString("[%1] %2").arg(timestamp).arg(entry.text);
+}
+
+void GameLogModel::append(const QString &text)
+{
+    m_pending.append(text);
+    if (!m_flushTimer->isActive()) {
+        m_flushTimer->start();
+    }
+}
+
+void GameLogModel::flush()
+{
+    m_flushTimer->stop();
+    if (m_pending.isEmpty()) {
+        return;
+    }
+
+    const int capacity = m_entries.size();
+    // 一批日志超过容量时只保留最后 capacity 条
+    const int skip = std::max(0, m_pending.size() - capacity);
+    const int incoming = m_pending.size() - skip;
+
+    // 先移除放不下的最旧日志
+    const int overflow = m_count + incoming - capacity;
+    if (overflow > 0) {
+        beginRemoveRows(QModelIndex(), 0, overflow - 1);
+        for (int i = 0; i < overflow; ++i) {
+            m_entries[m_start].text.clear();
+            m_start = (m_start + 1) % capacity;
+        }
+        m_count -= overflow;
+        endRemoveRows();
+    }
+
+    // 同一批日志共用一个时间戳
+    const int now = QTime::currentTime().msecsSinceStartOfDay();
+    beginInsertRows(QModelIndex(), m_count, m_count + incoming - 1);
+    for (int i = skip; i < m_pending.size(); ++i) {
+        Entry &entry = m_entries[(m_start + m_count) % capacity];
+        entry.timeMs = now;
+        entry.text = m_pending[i];
+        ++m_count;
+    }
+    endInsertRows();
+
+    m_pending.clear();
+}
+
+void GameLogModel::clear()
+{
+    m_flushTimer->stop();
+    m_pending.clear();
+    beginResetModel();
+    for (Entry &entry : m_entries) {
+        entry.text.clear();
+    }
+    m_start = 0;
+    m_count = 0;
+    endResetModel();
+}
+
+const GameLogModel::Entry &GameLogModel::entryAt(int row) const
+{
+    return m_entries[(m_start + row) % m_entries.size()];
+}
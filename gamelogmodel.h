@@ -0,0 +1,43 @@
+#ifndef GAMELOGMODEL_H
+#define GAMELOGMODEL_H
+
+#include <QAbstractListModel>
+#include <QStringList>
+#include <QTimer>
+#include <QVector>
+
+// 游戏日志模型：固定容量的环形存储，超出容量时丢弃最旧的日志。
+// append 只放入待写队列，每帧统一写入一次；时间戳在显示时才格式化，
+// 配合 QListView 只对可见行做布局。
+class GameLogModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    explicit GameLogModel(int capacity = 1000, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    void append(const QString &text);
+    void flush();
+    void clear();
+
+    int capacity() const { return m_entries.size(); }
+
+private:
+    struct Entry {
+        int timeMs = 0;   // 当天的毫秒数
+        QString text;
+    };
+
+    const Entry &entryAt(int row) const;
+
+    QVector<Entry> m_entries;   // 环形存储，大小固定为容量
+    int m_start;                // 最旧一条所在的下标
+    int m_count;
+    QStringList m_pending;
+    QTimer *m_flushTimer;
+};
+
+#endif // GAMELOGMODEL_H
@@ -0,0 +1,210 @@
+#include "handcardswidget.h"
+#include <QHash>
+#include <QMap>
+#include <QStyle>
+#include <algorithm>
+
+HandCardsWidget::HandCardsWidget(QWidget *parent)
+    : QWidget(parent)
+    , m_layout(new QHBoxLayout(this))
+    , m_selectedButton(nullptr)
+{
+    // 所有卡牌按钮共用这一份样式表，按钮只切换属性，不再各自解析CSS
+    static const QString styleSheet = QStringLiteral(
+        "QPushButton[cardKind=\"attack\"] { background-color: #ff6666; border: 2px solid black; }"   // 杀 - 红色
+        "QPushButton[cardKind=\"defend\"] { background-color: #66aaff; border: 2px solid black; }"   // 闪 - 蓝色
+        "QPushButton[cardKind=\"heal\"] { background-color: #66ff66; border: 2px solid black; }"     // 桃 - 绿色
+        "QPushButton[cardKind=\"other\"] { background-color: #ffff66; border: 2px solid black; }"    // 其他 - 黄色
+        "QPushButton[selected=\"true\"] { background-color: lightblue; }");
+    setStyleSheet(styleSheet);
+}
+
+void HandCardsWidget::setCards(const std::vector<uint32_t> &cardIds)
+{
+    const int count = static_cast<int>(cardIds.size());
+    const int oldCount = m_buttons.size();
+
+    // 新槽位对应的旧按钮下标，-1 表示新牌。同一ID可能有多张，优先匹配上一次匹配位置之后的那张，
+    // 这样去掉或插入一张重复的牌时其余牌的相对顺序仍然不变
+    QHash<uint32_t, QVector<int>> unmatched;
+    for (int j = 0; j < oldCount; ++j) {
+        unmatched[cardIdOf(m_buttons[j])].append(j);
+    }
+    QVector<int> source(count, -1);
+    int lastMatched = -1;
+    for (int i = 0; i < count; ++i) {
+        auto it = unmatched.find(cardIds[i]);
+        if (it == unmatched.end() || it->isEmpty()) {
+            continue;
+        }
+        auto pos = std::upper_bound(it->begin(), it->end(), lastMatched);
+        if (pos == it->end()) {
+            pos = it->begin();
+        }
+        source[i] = lastMatched = *pos;
+        it->erase(pos);
+    }
+
+    // 旧下标的最长递增子序列上的按钮相对顺序没变，留在原位不动，只移动其余的按钮
+    QVector<bool> stays(oldCount, false);
+    {
+        QVector<int> tails;               // tails[k]：长度为 k+1 的递增子序列以哪个新槽位结尾
+        QVector<int> previous(count, -1);
+        for (int i = 0; i < count; ++i) {
+            if (source[i] < 0) {
+                continue;
+            }
+            int lo = 0;
+            int hi = tails.size();
+            while (lo < hi) {
+                int mid = (lo + hi) / 2;
+                if (source[tails[mid]] < source[i]) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            previous[i] = lo > 0 ? tails[lo - 1] : -1;
+            if (lo == tails.size()) {
+                tails.append(i);
+            } else {
+                tails[lo] = i;
+            }
+        }
+        for (int i = tails.isEmpty() ? -1 : tails.last(); i >= 0; i = previous[i]) {
+            stays[source[i]] = true;
+        }
+    }
+
+    QVector<QPushButton*> moving(count, nullptr);
+    QVector<bool> reused(oldCount, false);
+    for (int i = 0; i < count; ++i) {
+        if (source[i] >= 0) {
+            reused[source[i]] = true;
+            if (!stays[source[i]]) {
+                moving[i] = m_buttons[source[i]];
+            }
+        }
+    }
+
+    // 不再需要的按钮原地回收到对象池，要换位置的先从布局中取下
+    QVector<QPushButton*> staying;
+    staying.reserve(count);
+    for (int j = 0; j < oldCount; ++j) {
+        QPushButton *button = m_buttons[j];
+        if (stays[j]) {
+            staying.append(button);
+        } else if (reused[j]) {
+            m_layout->removeWidget(button);
+        } else {
+            releaseButton(button);
+        }
+    }
+    m_buttons.swap(staying);
+
+    // 按新顺序插入移动的按钮和新牌；留在原位的按钮此时正好已经在各自的槽位上
+    for (int i = 0; i < count; ++i) {
+        if (source[i] >= 0 && stays[source[i]]) {
+            continue;
+        }
+        QPushButton *button = moving[i] ? moving[i] : acquireButton(cardIds[i]);
+        m_buttons.insert(i, button);
+        m_layout->insertWidget(i, button);
+    }
+}
+
+void HandCardsWidget::clear()
+{
+    while (!m_buttons.isEmpty()) {
+        releaseButton(m_buttons.takeLast());
+    }
+}
+
+void HandCardsWidget::clearSelection()
+{
+    if (m_selectedButton) {
+        setSelected(m_selectedButton, false);
+        m_selectedButton = nullptr;
+    }
+}
+
+QString HandCardsWidget::cardName(uint32_t cardId)
+{
+    // 简单的卡牌ID到名称映射
+    static QMap<uint32_t, QString> cardNames = {
+        {1, "杀"}, {2, "闪"}, {3, "桃"},
+        {4, "过河拆桥"}, {5, "顺手牵羊"}, {6, "无中生有"}
+    };
+    return cardNames.value(cardId, QString::number(cardId));
+}
+
+void HandCardsWidget::onCardClicked()
+{
+    QPushButton *button = qobject_cast<QPushButton*>(sender());
+    if (!button) {
+        return;
+    }
+
+    // 高亮选中的卡牌，只重绘前后两个按钮
+    if (m_selectedButton != button) {
+        clearSelection();
+        setSelected(button, true);
+        m_selectedButton = button;
+    }
+    emit cardSelected(cardIdOf(button));
+}
+
+QPushButton *HandCardsWidget::acquireButton(uint32_t cardId)
+{
+    QPushButton *button;
+    if (!m_pool.isEmpty()) {
+        button = m_pool.takeLast();
+    } else {
+        button = new QPushButton(this);
+        button->setMinimumSize(80, 120);
+        button->setMaximumSize(80, 120);
+        connect(button, &QPushButton::clicked, this, &HandCardsWidget::onCardClicked);
+    }
+
+    button->setText(cardName(cardId));
+    button->setProperty("cardId", cardId);
+    const char *kind = cardKind(cardId);
+    if (button->property("cardKind").toString() != QLatin1String(kind)) {
+        button->setProperty("cardKind", QLatin1String(kind));
+        button->style()->unpolish(button);
+        button->style()->polish(button);
+    }
+    button->show();
+    return button;
+}
+
+void HandCardsWidget::releaseButton(QPushButton *button)
+{
+    if (button == m_selectedButton) {
+        clearSelection();
+    }
+    m_layout->removeWidget(button);
+    button->hide();
+    m_pool.append(button);
+}
+
+void HandCardsWidget::setSelected(QPushButton *button, bool selected)
+{
+    button->setProperty("selected", selected);
+    button->style()->unpolish(button);
+    button->style()->polish(button);
+}
+
+uint32_t HandCardsWidget::cardIdOf(const QPushButton *button)
+{
+    return button->property("cardId").toUInt();
+}
+
+const char *HandCardsWidget::cardKind(uint32_t cardId)
+{
+    // 根据卡牌类型选择样式
+    if (cardId == 1) return "attack";
+    if (cardId == 2) return "defend";
+    if (cardId == 3) return "heal";
+    return "other";
+}
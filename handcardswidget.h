@@ -0,0 +1,46 @@
+#ifndef HANDCARDSWIDGET_H
+#define HANDCARDSWIDGET_H
+
+#include <QWidget>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QVector>
+#include <vector>
+
+// 手牌区域：按卡牌ID对比新旧手牌，相对顺序不变的按钮留在原位，只插入、移除或移动其余的按钮。
+// 卡牌按钮放在对象池中复用，所有按钮共用一份预先生成的样式表。
+class HandCardsWidget : public QWidget
+{
+    Q_OBJECT
+
+public:
+    explicit HandCardsWidget(QWidget *parent = nullptr);
+
+    void setCards(const std::vector<uint32_t> &cardIds);
+    void clear();
+    void clearSelection();
+
+    int cardCount() const { return m_buttons.size(); }
+
+    static QString cardName(uint32_t cardId);
+
+signals:
+    void cardSelected(uint32_t cardId);
+
+private slots:
+    void onCardClicked();
+
+private:
+    QPushButton *acquireButton(uint32_t cardId);
+    void releaseButton(QPushButton *button);
+    void setSelected(QPushButton *button, bool selected);
+    static uint32_t cardIdOf(const QPushButton *button);
+    static const char *cardKind(uint32_t cardId);
+
+    QHBoxLayout *m_layout;
+    QVector<QPushButton*> m_buttons;   // 按显示顺序排列
+    QVector<QPushButton*> m_pool;      // 已隐藏、可复用的按钮
+    QPushButton *m_selectedButton;
+};
+
+#endif // HANDCARDSWIDGET_H
@@ -0,0 +1,72 @@
+#include "latencyhistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+const double kFirstBucketMs = 0.05;
+const double kGrowth = 1.3;
+}
+
+LatencyHistogram::LatencyHistogram()
+    : m_count(0),
+      m_sum(0.0),
+      m_min(0.0),
+      m_max(0.0) {
+    m_buckets.fill(0);
+}
+
+double LatencyHistogram::bucketUpperMs(int index) {
+    return kFirstBucketMs * std::pow(kGrowth, index);
+}
+
+int LatencyHistogram::bucketIndex(double ms) {
+    if (ms <= kFirstBucketMs) {
+        return 0;
+    }
+    int index = static_cast<int>(std::ceil(std::log(ms / kFirstBucketMs) / std::log(kGrowth)));
+    return std::min(index, kBucketCount - 1);
+}
+
+void LatencyHistogram::record(double ms) {
+    ms = std::max(ms, 0.0);
+    ++m_buckets[static_cast<size_t>(bucketIndex(ms))];
+    if (m_count == 0) {
+        m_min = ms;
+        m_max = ms;
+    } else {
+        m_min = std::min(m_min, ms);
+        m_max = std::max(m_max, ms);
+    }
+    ++m_count;
+    m_sum += ms;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.m_count == 0) {
+        return;
+    }
+    for (int i = 0; i < kBucketCount; ++i) {
+        m_buckets[static_cast<size_t>(i)] += other.m_buckets[static_cast<size_t>(i)];
+    }
+    m_min = m_count ? std::min(m_min, other.m_min) : other.m_min;
+    m_max = m_count ? std::max(m_max, other.m_max) : other.m_max;
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+}
+
+double LatencyHistogram::percentileMs(double percentile) const {
+    if (m_count == 0) {
+        return 0.0;
+    }
+    // 第 rank 个样本（从1开始）所在的桶
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(m_count)));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += m_buckets[static_cast<size_t>(i)];
+        if (seen >= rank) {
+            return std::min(bucketUpperMs(i), m_max);
+        }
+    }
+    return m_max;
+}
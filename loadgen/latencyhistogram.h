@@ -0,0 +1,41 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// 固定分桶的延迟直方图（毫秒），不依赖Qt。
+// 桶的上界按1.3倍递增，从0.05ms到十几分钟，记录一个样本只需一次对数运算，
+// 不保存原始样本，几千个客户端的统计也可以直接合并。
+class LatencyHistogram
+{
+public:
+    static const int kBucketCount = 64;
+
+    LatencyHistogram();
+
+    void record(double ms);
+    void merge(const LatencyHistogram& other);
+
+    uint64_t count() const { return m_count; }
+    double minMs() const { return m_count ? m_min : 0.0; }
+    double maxMs() const { return m_count ? m_max : 0.0; }
+    double meanMs() const { return m_count ? m_sum / static_cast<double>(m_count) : 0.0; }
+    // 返回第 percentile（0~100）百分位所在桶的上界，不超过最大样本
+    double percentileMs(double percentile) const;
+
+    static double bucketUpperMs(int index);
+    uint64_t bucketValue(int index) const { return m_buckets[static_cast<size_t>(index)]; }
+
+private:
+    static int bucketIndex(double ms);
+
+    std::array<uint64_t, kBucketCount> m_buckets;
+    uint64_t m_count;
+    double m_sum;
+    double m_min;
+    double m_max;
+};
+
+#endif // LATENCY_HISTOGRAM_H
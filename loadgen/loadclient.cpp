@@ -0,0 +1,323 @@
+#include "loadclient.h"
+#include <QStringList>
+
+namespace {
+// 可以主动打出的牌及其目标：杀、过河拆桥、顺手牵羊对对手使用，桃、无中生有对自己使用。
+// 闪只能响应，不会主动打出。
+enum class CardTarget { None, Opponent, Self };
+
+CardTarget targetOf(uint32_t cardId) {
+    switch (cardId) {
+    case 1: case 4: case 5:
+        return CardTarget::Opponent;
+    case 3: case 6:
+        return CardTarget::Self;
+    default:
+        return CardTarget::None;
+    }
+}
+}
+
+bool parseLoadScript(const QString& text, std::vector<ScriptStep>* steps, QString* error) {
+    steps->clear();
+    const QStringList parts = text.split(',', Qt::SkipEmptyParts);
+    for (const QString& rawPart : parts) {
+        QString part = rawPart.trimmed().toLower();
+        ScriptStep step;
+        if (part == "login") {
+            step.step = LoadStep::Login;
+        } else if (part == "list") {
+            step.step = LoadStep::ListRooms;
+        } else if (part == "create") {
+            step.step = LoadStep::CreateRoom;
+        } else if (part == "join") {
+            step.step = LoadStep::JoinRoom;
+        } else if (part == "leave") {
+            step.step = LoadStep::LeaveRoom;
+        } else if (part == "play") {
+            step.step = LoadStep::PlayCard;
+        } else if (part == "end") {
+            step.step = LoadStep::EndTurn;
+        } else if (part.startsWith("wait:")) {
+            bool ok = false;
+            step.step = LoadStep::Wait;
+            step.waitMs = part.mid(5).toInt(&ok);
+            if (!ok || step.waitMs < 0) {
+                *error = QString("invalid wait step: %1").arg(rawPart);
+                return false;
+            }
+        } else {
+            *error = QString("unknown script step: %1").arg(rawPart);
+            return false;
+        }
+        steps->push_back(step);
+    }
+    if (steps->empty()) {
+        *error = "empty script";
+        return false;
+    }
+    return true;
+}
+
+LoadClient::LoadClient(const LoadClientConfig& config, LoadReport* report, uint32_t seed,
+                       QObject *parent)
+    : QObject(parent),
+      m_config(config),
+      m_report(report),
+      m_network(new NetworkManager(this)),
+      m_random(seed),
+      m_timeoutTimer(new QTimer(this)),
+      m_pending(Pending::None),
+      m_turnStep(LoadStep::PlayCard),
+      m_nextSequence(1),
+      m_awaitedSequence(0),
+      m_stepIndex(0),
+      m_iteration(0),
+      m_disconnects(0),
+      m_finished(false) {
+
+    m_timeoutTimer->setSingleShot(true);
+    connect(m_timeoutTimer, &QTimer::timeout, this, &LoadClient::onTimeout);
+
+    // 压测只关心响应延迟，状态不必按显示帧率合并
+    m_network->stateCoalescer()->setFrameInterval(0);
+
+    connect(m_network, &NetworkManager::connected, this, &LoadClient::onConnected);
+    connect(m_network, &NetworkManager::disconnected, this, &LoadClient::onDisconnected);
+    connect(m_network, &NetworkManager::loginResponseReceived, this, &LoadClient::onLoginResponse);
+    connect(m_network, &NetworkManager::roomResponseReceived, this, &LoadClient::onRoomResponse);
+    connect(m_network, &NetworkManager::roomListResponseReceived, this, &LoadClient::onRoomListResponse);
+    connect(m_network, &NetworkManager::gameStateReceived, this, &LoadClient::onGameState);
+    connect(m_network, &NetworkManager::gameOverReceived, this, &LoadClient::onGameOver);
+}
+
+void LoadClient::start() {
+    beginOperation("connect", Pending::Connect, m_config.timeoutMs);
+    m_network->connectToServer(m_config.host, m_config.port);
+}
+
+void LoadClient::beginOperation(const char* name, Pending pending, int timeoutMs) {
+    m_operation = name;
+    m_pending = pending;
+    m_operationClock.start();
+    if (timeoutMs > 0) {
+        m_timeoutTimer->start(timeoutMs);
+    }
+}
+
+void LoadClient::completeOperation(bool success) {
+    m_timeoutTimer->stop();
+    OperationStats& stats = (*m_report)[m_operation];
+    if (success) {
+        stats.latency.record(static_cast<double>(m_operationClock.nsecsElapsed()) / 1e6);
+    } else {
+        ++stats.failed;
+    }
+    m_pending = Pending::None;
+    runNextStep();
+}
+
+void LoadClient::skipOperation(const char* name) {
+    m_timeoutTimer->stop();
+    ++(*m_report)[name].skipped;
+    m_pending = Pending::None;
+    // 放到下一轮事件循环，脚本全部被跳过时也不会递归过深
+    scheduleNextStep();
+}
+
+void LoadClient::scheduleNextStep() {
+    QMetaObject::invokeMethod(this, &LoadClient::runNextStep, Qt::QueuedConnection);
+}
+
+void LoadClient::runNextStep() {
+    if (m_finished) {
+        return;
+    }
+    if (m_stepIndex == m_config.script.size()) {
+        m_stepIndex = 0;
+        if (++m_iteration >= m_config.iterations) {
+            m_finished = true;
+            m_network->disconnectFromServer();
+            emit finished();
+            return;
+        }
+    }
+
+    const ScriptStep& step = m_config.script[m_stepIndex++];
+    switch (step.step) {
+    case LoadStep::Login:
+        beginOperation("login", Pending::Login, m_config.timeoutMs);
+        m_network->login(m_config.username, m_config.password);
+        break;
+    case LoadStep::ListRooms:
+        beginOperation("list_rooms", Pending::RoomList, m_config.timeoutMs);
+        m_network->requestRoomList();
+        break;
+    case LoadStep::CreateRoom:
+        beginOperation("create_room", Pending::Room, m_config.timeoutMs);
+        m_network->createRoom();
+        break;
+    case LoadStep::JoinRoom: {
+        if (m_joinableRooms.empty()) {
+            skipOperation("join_room");
+            break;
+        }
+        std::uniform_int_distribution<size_t> pick(0, m_joinableRooms.size() - 1);
+        uint32_t roomId = m_joinableRooms[pick(m_random)];
+        beginOperation("join_room", Pending::Room, m_config.timeoutMs);
+        m_network->joinRoom(roomId);
+        break;
+    }
+    case LoadStep::LeaveRoom:
+        beginOperation("leave_room", Pending::Room, m_config.timeoutMs);
+        m_network->leaveRoom();
+        break;
+    case LoadStep::PlayCard:
+    case LoadStep::EndTurn:
+        m_turnStep = step.step;
+        if (canAct()) {
+            act();
+        } else {
+            // 等待轮到自己的时间不计入延迟
+            m_pending = Pending::TurnWait;
+            m_timeoutTimer->start(m_config.turnTimeoutMs);
+        }
+        break;
+    case LoadStep::Wait:
+        m_pending = Pending::Wait;
+        m_timeoutTimer->start(step.waitMs);
+        break;
+    }
+}
+
+bool LoadClient::canAct() const {
+    return m_state.isMyTurn() && m_state.phase() == sanguosha::PLAY_PHASE && m_state.selfAlive();
+}
+
+void LoadClient::act() {
+    if (m_turnStep == LoadStep::EndTurn) {
+        beginOperation("end_turn", Pending::GameState, m_config.timeoutMs);
+        m_awaitedSequence = nextSequence();
+        m_network->endTurn(m_awaitedSequence);
+        return;
+    }
+
+    uint32_t cardId = 0;
+    uint32_t targetPlayer = 0;
+    if (!pickCard(&cardId, &targetPlayer)) {
+        skipOperation("play_card");
+        return;
+    }
+    beginOperation("play_card", Pending::GameState, m_config.timeoutMs);
+    m_awaitedSequence = nextSequence();
+    m_network->sendGameAction(cardId, targetPlayer, m_awaitedSequence);
+}
+
+uint32_t LoadClient::nextSequence() {
+    // 0 表示不需要确认，回绕时跳过
+    uint32_t sequence = m_nextSequence++;
+    if (m_nextSequence == 0) {
+        m_nextSequence = 1;
+    }
+    return sequence;
+}
+
+bool LoadClient::pickCard(uint32_t* cardId, uint32_t* targetPlayer) {
+    uint32_t opponent = m_state.firstOpponent();
+    std::vector<uint32_t> playable;
+    for (uint32_t card : m_state.hand()) {
+        CardTarget target = targetOf(card);
+        if (target == CardTarget::Self || (target == CardTarget::Opponent && opponent != 0)) {
+            playable.push_back(card);
+        }
+    }
+    if (playable.empty()) {
+        return false;
+    }
+
+    std::uniform_int_distribution<size_t> pick(0, playable.size() - 1);
+    *cardId = playable[pick(m_random)];
+    *targetPlayer = targetOf(*cardId) == CardTarget::Opponent ? opponent : m_state.selfId();
+    return true;
+}
+
+void LoadClient::onConnected() {
+    // 断线重连由 NetworkManager 自动恢复会话，脚本继续执行
+    if (m_pending == Pending::Connect) {
+        completeOperation(true);
+    }
+}
+
+void LoadClient::onDisconnected() {
+    ++m_disconnects;
+}
+
+void LoadClient::onLoginResponse(const sanguosha::LoginResponse& response) {
+    if (response.success()) {
+        m_state.setSelfId(response.user_id());
+    }
+    if (m_pending == Pending::Login) {
+        completeOperation(response.success());
+    }
+}
+
+void LoadClient::onRoomResponse(const sanguosha::RoomResponse& response) {
+    if (m_pending == Pending::Room) {
+        completeOperation(response.success());
+    }
+}
+
+void LoadClient::onRoomListResponse(const sanguosha::RoomListResponse& response) {
+    m_joinableRooms.clear();
+    for (const sanguosha::RoomInfo& room : response.rooms()) {
+        if (room.status() == sanguosha::WAITING && room.current_players() < room.max_players()) {
+            m_joinableRooms.push_back(room.room_id());
+        }
+    }
+    if (m_pending == Pending::RoomList) {
+        completeOperation(true);
+    }
+}
+
+void LoadClient::onGameState(const sanguosha::GameState& state) {
+    m_state.applyState(state);
+    // 其他玩家的操作也会推送状态，只有服务器确认处理了本次操作才算完成；
+    // 序号按差值的符号比较，回绕后仍然成立
+    if (m_pending == Pending::GameState && state.acked_sequence() != 0 &&
+        static_cast<int32_t>(m_awaitedSequence - state.acked_sequence()) <= 0) {
+        completeOperation(true);
+    } else if (m_pending == Pending::TurnWait && canAct()) {
+        m_timeoutTimer->stop();
+        act();
+    }
+}
+
+void LoadClient::onGameOver(const sanguosha::GameOver& gameOver) {
+    Q_UNUSED(gameOver);
+    m_state.reset();
+    // 结束对局的操作不会再收到游戏状态，对局结束本身就是服务器的回应
+    if (m_pending == Pending::GameState) {
+        completeOperation(true);
+    } else if (m_pending == Pending::TurnWait) {
+        skipOperation(m_turnStep == LoadStep::EndTurn ? "end_turn" : "play_card");
+    }
+}
+
+void LoadClient::onTimeout() {
+    switch (m_pending) {
+    case Pending::Wait:
+        m_pending = Pending::None;
+        runNextStep();
+        break;
+    case Pending::TurnWait:
+        skipOperation(m_turnStep == LoadStep::EndTurn ? "end_turn" : "play_card");
+        break;
+    case Pending::None:
+        break;
+    default:
+        ++(*m_report)[m_operation].timedOut;
+        m_pending = Pending::None;
+        runNextStep();
+        break;
+    }
+}
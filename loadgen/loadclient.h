@@ -0,0 +1,126 @@
+#ifndef LOAD_CLIENT_H
+#define LOAD_CLIENT_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include "clientgamestate.h"
+#include "latencyhistogram.h"
+#include "networkmanager.h"
+
+// 压测脚本中的一步
+enum class LoadStep {
+    Login,       // login
+    ListRooms,   // list
+    CreateRoom,  // create
+    JoinRoom,    // join：从最近一次房间列表中随机选一个等待中的房间
+    LeaveRoom,   // leave
+    PlayCard,    // play：等到自己的出牌阶段，随机打出一张可用的牌
+    EndTurn,     // end：等到自己的出牌阶段后结束回合
+    Wait         // wait:毫秒，模拟玩家思考时间
+};
+
+struct ScriptStep {
+    LoadStep step = LoadStep::Wait;
+    int waitMs = 0;
+};
+
+// 解析逗号分隔的脚本，例如 "login,list,join,play,wait:500,end"
+bool parseLoadScript(const QString& text, std::vector<ScriptStep>* steps, QString* error);
+
+// 每种操作的统计；延迟从发出请求到收到对应响应
+struct OperationStats {
+    LatencyHistogram latency;
+    uint64_t failed = 0;     // 服务器返回失败
+    uint64_t timedOut = 0;   // 超时没有响应
+    uint64_t skipped = 0;    // 条件不满足没有发出（没有可加入的房间、没轮到自己等）
+};
+
+// 所有客户端共享同一份统计；客户端都在同一个事件循环里，不需要加锁
+using LoadReport = std::map<std::string, OperationStats>;
+
+struct LoadClientConfig {
+    QString host;
+    quint16 port = 9527;
+    QString username;
+    QString password;
+    std::vector<ScriptStep> script;
+    int iterations = 1;         // 脚本重复次数
+    int timeoutMs = 10000;      // 等待响应的超时
+    int turnTimeoutMs = 30000;  // play/end 等待轮到自己的超时
+};
+
+// 一个模拟客户端：持有独立的 NetworkManager，按脚本依次发出请求并记录每步的延迟
+class LoadClient : public QObject
+{
+    Q_OBJECT
+
+public:
+    LoadClient(const LoadClientConfig& config, LoadReport* report, uint32_t seed,
+               QObject *parent = nullptr);
+
+    void start();
+    bool isFinished() const { return m_finished; }
+    uint64_t disconnectCount() const { return m_disconnects; }
+
+signals:
+    void finished();
+
+private slots:
+    void onConnected();
+    void onDisconnected();
+    void onLoginResponse(const sanguosha::LoginResponse& response);
+    void onRoomResponse(const sanguosha::RoomResponse& response);
+    void onRoomListResponse(const sanguosha::RoomListResponse& response);
+    void onGameState(const sanguosha::GameState& state);
+    void onGameOver(const sanguosha::GameOver& gameOver);
+    void onTimeout();
+
+private:
+    enum class Pending {
+        None,
+        Connect,
+        Login,
+        RoomList,
+        Room,
+        TurnWait,
+        GameState,
+        Wait
+    };
+
+    void runNextStep();
+    void scheduleNextStep();
+    void beginOperation(const char* name, Pending pending, int timeoutMs);
+    void completeOperation(bool success);
+    void skipOperation(const char* name);
+    bool canAct() const;
+    void act();
+    uint32_t nextSequence();
+    bool pickCard(uint32_t* cardId, uint32_t* targetPlayer);
+
+    LoadClientConfig m_config;
+    LoadReport* m_report;
+    NetworkManager* m_network;
+    ClientGameState m_state;
+    std::mt19937 m_random;
+    QTimer* m_timeoutTimer;
+    QElapsedTimer m_operationClock;
+
+    Pending m_pending;
+    std::string m_operation;
+    LoadStep m_turnStep;
+    uint32_t m_nextSequence;
+    uint32_t m_awaitedSequence;     // 等待服务器确认的操作序号
+    size_t m_stepIndex;
+    int m_iteration;
+    std::vector<uint32_t> m_joinableRooms;
+    uint64_t m_disconnects;
+    bool m_finished;
+};
+
+#endif // LOAD_CLIENT_H
@@ -0,0 +1,156 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QLoggingCategory>
+#include <QTimer>
+#include <cstdio>
+#include <vector>
+#include "loadclient.h"
+
+// 多客户端压测：在一个进程、一个事件循环里模拟 N 个客户端，
+// 使用真实的 NetworkManager 和 sanguosha.proto 协议按脚本发出请求，
+// 结束时按操作输出延迟分布和吞吐量。
+namespace {
+
+void printReport(const LoadReport& report, double elapsedSec, bool printBuckets) {
+    uint64_t completed = 0;
+    std::printf("%-12s %8s %6s %8s %8s %9s %9s %9s %9s %9s %9s\n",
+                "operation", "ok", "fail", "timeout", "skipped",
+                "ops/s", "min(ms)", "p50(ms)", "p90(ms)", "p99(ms)", "max(ms)");
+    for (const auto& entry : report) {
+        const OperationStats& stats = entry.second;
+        const LatencyHistogram& latency = stats.latency;
+        completed += latency.count();
+        std::printf("%-12s %8llu %6llu %8llu %8llu %9.1f %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                    entry.first.c_str(),
+                    static_cast<unsigned long long>(latency.count()),
+                    static_cast<unsigned long long>(stats.failed),
+                    static_cast<unsigned long long>(stats.timedOut),
+                    static_cast<unsigned long long>(stats.skipped),
+                    elapsedSec > 0 ? latency.count() / elapsedSec : 0.0,
+                    latency.minMs(), latency.percentileMs(50), latency.percentileMs(90),
+                    latency.percentileMs(99), latency.maxMs());
+    }
+    std::printf("total: %llu operations in %.2f s, %.1f ops/s\n",
+                static_cast<unsigned long long>(completed), elapsedSec,
+                elapsedSec > 0 ? completed / elapsedSec : 0.0);
+
+    if (!printBuckets) {
+        return;
+    }
+    for (const auto& entry : report) {
+        const LatencyHistogram& latency = entry.second.latency;
+        if (latency.count() == 0) {
+            continue;
+        }
+        std::printf("\n%s latency histogram\n", entry.first.c_str());
+        for (int i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+            if (latency.bucketValue(i) != 0) {
+                std::printf("  <= %10.2f ms  %llu\n", LatencyHistogram::bucketUpperMs(i),
+                            static_cast<unsigned long long>(latency.bucketValue(i)));
+            }
+        }
+    }
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("sanguosha_loadgen");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Simulate many Sanguosha clients against a server");
+    parser.addHelpOption();
+    QCommandLineOption hostOption("host", "Server address.", "host", "127.0.0.1");
+    QCommandLineOption portOption("port", "Server port.", "port", "9527");
+    QCommandLineOption clientsOption("clients", "Number of simulated clients.", "n", "100");
+    QCommandLineOption rampOption("ramp-ms", "Spread client connects over this many milliseconds.", "ms", "1000");
+    QCommandLineOption scriptOption("script",
+        "Comma separated steps: login, list, create, join, leave, play, end, wait:<ms>.",
+        "steps", "login,list,join,play,end");
+    QCommandLineOption iterationsOption("iterations", "Times each client runs the script.", "n", "1");
+    QCommandLineOption durationOption("duration", "Stop after this many seconds (0 = when all scripts finish).", "sec", "0");
+    QCommandLineOption timeoutOption("timeout", "Response timeout in milliseconds.", "ms", "10000");
+    QCommandLineOption turnTimeoutOption("turn-timeout", "How long play/end wait for the client's turn.", "ms", "30000");
+    QCommandLineOption userPrefixOption("user-prefix", "Usernames are <prefix><index>.", "prefix", "bot");
+    QCommandLineOption passwordOption("password", "Password for every simulated user.", "password", "bot");
+    QCommandLineOption seedOption("seed", "Random seed for room and card choices.", "seed", "1");
+    QCommandLineOption histogramOption("histogram", "Print latency histogram buckets.");
+    QCommandLineOption verboseOption("verbose", "Keep the client's debug logging.");
+    parser.addOptions({ hostOption, portOption, clientsOption, rampOption, scriptOption,
+                        iterationsOption, durationOption, timeoutOption, turnTimeoutOption,
+                        userPrefixOption, passwordOption, seedOption, histogramOption, verboseOption });
+    parser.process(app);
+
+    if (!parser.isSet(verboseOption)) {
+        // 每条消息一行的调试输出在上千个客户端下会成为瓶颈
+        QLoggingCategory::setFilterRules("*.debug=false");
+    }
+
+    LoadClientConfig baseConfig;
+    baseConfig.host = parser.value(hostOption);
+    baseConfig.port = static_cast<quint16>(parser.value(portOption).toUInt());
+    baseConfig.password = parser.value(passwordOption);
+    baseConfig.iterations = qMax(1, parser.value(iterationsOption).toInt());
+    baseConfig.timeoutMs = parser.value(timeoutOption).toInt();
+    baseConfig.turnTimeoutMs = parser.value(turnTimeoutOption).toInt();
+    QString error;
+    if (!parseLoadScript(parser.value(scriptOption), &baseConfig.script, &error)) {
+        std::fprintf(stderr, "%s\n", qPrintable(error));
+        return 1;
+    }
+
+    const int clientCount = qMax(1, parser.value(clientsOption).toInt());
+    const int rampMs = qMax(0, parser.value(rampOption).toInt());
+    const int durationSec = qMax(0, parser.value(durationOption).toInt());
+    const uint32_t seed = parser.value(seedOption).toUInt();
+    const QString userPrefix = parser.value(userPrefixOption);
+
+    LoadReport report;
+    std::vector<LoadClient*> clients;
+    clients.reserve(static_cast<size_t>(clientCount));
+    int finishedClients = 0;
+    bool reported = false;
+    QElapsedTimer elapsed;
+
+    auto finish = [&]() {
+        if (reported) {
+            return;
+        }
+        reported = true;
+        double elapsedSec = static_cast<double>(elapsed.nsecsElapsed()) / 1e9;
+        uint64_t disconnects = 0;
+        for (const LoadClient* client : clients) {
+            disconnects += client->disconnectCount();
+        }
+        std::printf("clients: %d, finished: %d, disconnects: %llu\n", clientCount, finishedClients,
+                    static_cast<unsigned long long>(disconnects));
+        printReport(report, elapsedSec, parser.isSet(histogramOption));
+        std::fflush(stdout);
+        app.quit();
+    };
+
+    for (int i = 0; i < clientCount; ++i) {
+        LoadClientConfig config = baseConfig;
+        config.username = userPrefix + QString::number(i);
+        LoadClient* client = new LoadClient(config, &report, seed + static_cast<uint32_t>(i), &app);
+        clients.push_back(client);
+        QObject::connect(client, &LoadClient::finished, &app, [&]() {
+            if (++finishedClients == clientCount) {
+                finish();
+            }
+        });
+        // 连接均匀分布在爬坡时间内，避免所有客户端同时握手
+        int startDelay = clientCount > 1 ? static_cast<int>(static_cast<qint64>(rampMs) * i / clientCount) : 0;
+        QTimer::singleShot(startDelay, client, &LoadClient::start);
+    }
+
+    if (durationSec > 0) {
+        QTimer::singleShot(durationSec * 1000, &app, finish);
+    }
+
+    elapsed.start();
+    return app.exec();
+}
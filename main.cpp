@@ -3,6 +3,8 @@
 #include <QFont>
 #include <QFontDatabase>
 #include "mainwindow.h"  // 确保包含 MainWindow 的头文件
+#include "network/metricsreporter.h"
+#include "network/tracing.h"
 
 int main(int argc, char *argv[])
 {
@@ -32,6 +34,62 @@ int main(int argc, char *argv[])
     font.setPointSize(9);
     QApplication::setFont(font);
 
+    const QStringList arguments = QCoreApplication::arguments();
+    auto argumentValue = [&arguments](const QString &name) {
+        int index = arguments.indexOf(name);
+        return index >= 0 && index + 1 < arguments.size() ? arguments.at(index + 1) : QString();
+    };
+
+    // --io-thread: 网络读写与解析放到独立线程
+    NetworkManager::setIoThreadEnabled(arguments.contains("--io-thread"));
+    NetworkManager &network = NetworkManager::instance();
+
+    // --record <文件>: 录制收发的全部帧
+    QString recordPath = argumentValue("--record");
+    if (!recordPath.isEmpty()) {
+        network.setRecordingPath(recordPath);
+    }
+
+    // --replay <文件> [--replay-speed <倍速|max>] [--replay-exit]:
+    // 不连接服务器，把录制的入站数据按原始节奏重新走一遍解析、分发和界面更新
+    QString replayPath = argumentValue("--replay");
+    if (!replayPath.isEmpty()) {
+        QString speedText = argumentValue("--replay-speed");
+        double speed = speedText.isEmpty() ? 1.0 : (speedText == "max" ? 0.0 : speedText.toDouble());
+        if (arguments.contains("--replay-exit")) {
+            // 全速回放后退出，可作为整个客户端的吞吐基准
+            QObject::connect(&network, &NetworkManager::replayFinished, &a,
+                             [](quint64 frames, quint64 bytes, qint64 elapsedMs) {
+                qInfo("Replayed %llu frames (%llu bytes) in %lld ms, %.0f frames/s",
+                      static_cast<unsigned long long>(frames), static_cast<unsigned long long>(bytes),
+                      static_cast<long long>(elapsedMs), elapsedMs > 0 ? frames * 1000.0 / elapsedMs : 0.0);
+                QCoreApplication::quit();
+            }, Qt::QueuedConnection);
+        }
+        network.startReplay(replayPath, speed);
+    }
+
+    // --metrics <文件> [--metrics-interval <秒>]: 定期（默认10秒）并在退出时把客户端指标写成JSON
+    QString metricsPath = argumentValue("--metrics");
+    if (!metricsPath.isEmpty()) {
+        QString intervalText = argumentValue("--metrics-interval");
+        int intervalSec = intervalText.isEmpty() ? 10 : intervalText.toInt();
+        auto *reporter = new MetricsReporter(metricsPath, intervalSec * 1000, &a);
+        QObject::connect(&a, &QCoreApplication::aboutToQuit, reporter, &MetricsReporter::writeNow);
+    }
+
+    // --trace <文件>: 记录从读套接字到重绘的各段耗时，退出时写成 Chrome trace_event JSON
+    QString tracePath = argumentValue("--trace");
+    if (!tracePath.isEmpty()) {
+        Tracer::instance().setThreadName("UI");
+        Tracer::instance().start();
+        QObject::connect(&a, &QCoreApplication::aboutToQuit, [tracePath]() {
+            if (!Tracer::instance().stop(tracePath.toStdString())) {
+                qWarning("Cannot write trace to %s", qPrintable(tracePath));
+            }
+        });
+    }
+
     MainWindow w;  // 确保 MainWindow 类已正确声明
     w.show();
     return a.exec();
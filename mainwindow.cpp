@@ -15,50 +15,64 @@
 #include <QPushButton>
 #include <QLineEdit>
 #include "proto/sanguosha.pb.h"
+#include "network/metrics.h"
+#include "network/tracing.h"
 #include <QThread>
 #include <QDebug>
 #include <QTimer>
 #include <QDateTime>
+#include <algorithm>
 //#include <QFlowLayout> 拟删除
 
 
-MainWindow::MainWindow(QWidget *parent)
+MainWindow::MainWindow(QWidget *parent, bool connectOnStart)
     : QMainWindow(parent)
     , ui(new Ui::MainWindow)
     , m_networkManager(&NetworkManager::instance())
-    //, m_loginScreen(nullptr) 移除
+    , m_loginScreen(nullptr)
     , m_lobbyScreen(nullptr)
     , m_gameScreen(nullptr)
     , m_playerInfoTable(nullptr)
+    , m_playerModel(nullptr)
     , m_gameLog(nullptr)
+    , m_gameLogModel(nullptr)
     , m_deckCountLabel(nullptr)
     , m_gameArea(nullptr)
     , m_turnInfoLabel(nullptr)
-    , m_handCardsLayout(nullptr)
+    , m_handCards(nullptr)
     , m_playCardButton(nullptr)
     , m_endTurnButton(nullptr)
     , m_cancelButton(nullptr)
     , m_selectedCard(0)
     , m_selfUserId(0)
-    , isAlive(true)
+    , m_predictionTimer(nullptr)
+    , m_pendingPaintFlow(0)
 {
     ui->setupUi(this);
+    // UI文件里的中心部件就是登录界面
+    m_loginScreen = ui->centralwidget;
     
     // 设置窗口标题
     this->setWindowTitle(tr("三国杀客户端"));
     
     // 设置状态栏初始消息
-    ui->statusbar->showMessage(tr("正在连接服务器..."));
+    ui->statusbar->showMessage(m_networkManager->isReplaying() ? tr("正在回放录制的会话...")
+                                                               : tr("正在连接服务器..."));
 
     // 添加连接超时检查
-    QTimer::singleShot(5000, this, [this]() {
-        if (!m_networkManager->isConnected()) {
+    QTimer::singleShot(5000, this, [this, connectOnStart]() {
+        if (connectOnStart && !m_networkManager->isConnected() && !m_networkManager->isReplaying()) {
             ui->statusbar->showMessage(tr("连接服务器失败，请检查服务器状态"));
             QMessageBox::warning(this, tr("连接失败"), 
                                 tr("无法连接到服务器，请确保服务器已启动"));
         }
     });
 
+    m_predictionClock.start();
+    m_predictionTimer = new QTimer(this);
+    m_predictionTimer->setSingleShot(true);
+    connect(m_predictionTimer, &QTimer::timeout, this, &MainWindow::onPredictionTimeout);
+
     m_roomOperationTimer = new QTimer(this);
     m_roomOperationTimer->setSingleShot(true);
     connect(m_roomOperationTimer, &QTimer::timeout, this, [this]() {
@@ -80,6 +94,17 @@ MainWindow::MainWindow(QWidget *parent)
     // 修改连接信号槽的代码
     connect(m_networkManager, &NetworkManager::connected, this, [this]() { onConnectionStatusChanged(true); });
     connect(m_networkManager, &NetworkManager::disconnected, this, [this]() { onConnectionStatusChanged(false); });
+    connect(m_networkManager, &NetworkManager::connectionLost, this, [this]() {
+        ui->statusbar->showMessage(tr("与服务器的连接已中断（心跳超时）"));
+    });
+    connect(m_networkManager, &NetworkManager::errorOccurred, this, &MainWindow::onErrorOccurred);
+    // 断线后由网络层按退避策略自动重连并恢复会话，界面保持不变
+    connect(m_networkManager, &NetworkManager::reconnectScheduled, this, [this](int attempt, int delayMs) {
+        ui->statusbar->showMessage(tr("连接已断开，%1 秒后第 %2 次重连...")
+                                   .arg(delayMs / 1000.0, 0, 'f', 1).arg(attempt));
+    });
+    connect(m_networkManager, &NetworkManager::sessionRestored, this, &MainWindow::onSessionRestored);
+    connect(m_networkManager, &NetworkManager::sessionLost, this, &MainWindow::onSessionLost);
 
     connect(m_networkManager, &NetworkManager::loginResponseReceived, this, &MainWindow::handleLoginResponse);
     connect(m_networkManager, &NetworkManager::roomResponseReceived, this, &MainWindow::handleRoomResponse);
@@ -90,8 +115,17 @@ MainWindow::MainWindow(QWidget *parent)
     connect(m_networkManager, &NetworkManager::roomListResponseReceived, this, &MainWindow::handleRoomListResponse);
     connect(m_networkManager, &NetworkManager::gameOverReceived, this, &MainWindow::handleGameOver);
 
-    // 连接到服务器，端口号已改为9527
-    m_networkManager->connectToServer("127.0.0.1", 9527);
+    connect(m_networkManager, &NetworkManager::replayFinished, this,
+            [this](quint64 frames, quint64 bytes, qint64 elapsedMs) {
+        ui->statusbar->showMessage(tr("回放结束：%1 帧，%2 字节，用时 %3 ms")
+                                   .arg(frames).arg(bytes).arg(elapsedMs));
+    });
+
+    // 回放录制的会话时不连接服务器
+    if (connectOnStart && !m_networkManager->isReplaying()) {
+        // 连接到服务器，端口号已改为9527
+        m_networkManager->connectToServer("127.0.0.1", 9527);
+    }
 }
 
 MainWindow::~MainWindow()
@@ -99,6 +133,20 @@ MainWindow::~MainWindow()
     delete ui;
 }
 
+bool MainWindow::event(QEvent *event)
+{
+    // 顶层窗口收到 UpdateRequest 时同步绘制所有待重绘的子控件，即状态更新之后的那次重绘
+    if (event->type() != QEvent::UpdateRequest || !Tracer::enabled()) {
+        return QMainWindow::event(event);
+    }
+    TRACE_SPAN("ui", "paint");
+    if (m_pendingPaintFlow != 0) {
+        Tracer::instance().addFlow(Tracer::FlowPhase::End, m_pendingPaintFlow);
+        m_pendingPaintFlow = 0;
+    }
+    return QMainWindow::event(event);
+}
+
 // 实现槽函数
 void MainWindow::onConnectionStatusChanged(bool connected)
 {
@@ -110,15 +158,8 @@ void MainWindow::onConnectionStatusChanged(bool connected)
 // 登录处理
 void MainWindow::onLoginButtonClicked(const QString &username, const QString &password)
 {
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::LOGIN_REQUEST);
-
-    sanguosha::LoginRequest* loginRequest = new sanguosha::LoginRequest();
-    loginRequest->set_username(username.toStdString());
-    loginRequest->set_password(password.toStdString());
-
-    message.set_allocated_login_request(loginRequest);
-    m_networkManager->sendMessage(message);
+    // 由网络层组装登录请求，附带压缩等能力协商
+    m_networkManager->login(username, password);
 }
 
 
@@ -127,43 +168,56 @@ void MainWindow::onLoginButtonClicked(const QString &username, const QString &pa
 void MainWindow::onCreateRoomClicked()
 {
     m_roomOperationTimer->start(5000); // 5秒超时
-
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::ROOM_REQUEST);
-
-    sanguosha::RoomRequest* roomRequest = new sanguosha::RoomRequest();
-    roomRequest->set_action(sanguosha::CREATE_ROOM);
-
-    message.set_allocated_room_request(roomRequest);
-    m_networkManager->sendMessage(message);
+    m_networkManager->createRoom();
 }
 
 // 房间加入
 void MainWindow::onJoinRoomClicked(uint32_t roomId) {
     m_roomOperationTimer->start(5000); // 5秒超时
-    
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::ROOM_REQUEST);
-    
-    sanguosha::RoomRequest* roomRequest = new sanguosha::RoomRequest();
-    roomRequest->set_action(sanguosha::JOIN_ROOM);
-    roomRequest->set_room_id(roomId);
-    
-    message.set_allocated_room_request(roomRequest);
-    m_networkManager->sendMessage(message);
+    m_networkManager->joinRoom(roomId);
     
     qDebug() << "Join room request sent for room:" << roomId;
 }
 
 void MainWindow::onErrorOccurred(const QString &errorString)
 {
-    QMessageBox::critical(this, tr("网络错误"), 
-                         tr("发生网络错误: %1").arg(errorString));
-    
-    // 尝试重新连接
-    QTimer::singleShot(3000, this, [this]() {
-        m_networkManager->connectToServer("127.0.0.1", 9527);
-    });
+    // 重连由网络层负责，这里只提示，不弹出模态框
+    qWarning() << "Network error:" << errorString;
+    ui->statusbar->showMessage(tr("网络错误: %1").arg(errorString));
+}
+
+void MainWindow::onSessionRestored()
+{
+    // 对局界面保留原样，完整状态到达后按正常流程刷新
+    ui->statusbar->showMessage(tr("已重新连接到服务器"), 3000);
+}
+
+void MainWindow::onSessionLost(const QString &reason)
+{
+    if (!m_networkManager->isLoggedIn()) {
+        // 登录无法恢复，回到登录界面
+        if (m_gameScreen) {
+            resetGameState();
+        }
+        showScreen(m_loginScreen);
+        ui->statusbar->showMessage(tr("会话已失效，请重新登录"));
+        QMessageBox::warning(this, tr("重新连接失败"),
+                             tr("无法恢复登录: %1").arg(reason));
+        return;
+    }
+
+    // 登录已恢复但房间不存在了，回到大厅
+    if (m_gameScreen) {
+        resetGameState();
+    }
+    setupLobbyScreen();
+    showScreen(m_lobbyScreen);
+    ui->statusbar->showMessage(tr("无法回到原来的房间: %1").arg(reason));
+
+    QTableWidget* roomTable = m_lobbyScreen->findChild<QTableWidget*>();
+    if (roomTable) {
+        requestRoomList(roomTable);
+    }
 }
 
 // 基本游戏操作
@@ -171,16 +225,15 @@ void MainWindow::onPlayCardClicked(uint32_t cardId, uint32_t targetPlayer) {
     // 根据卡牌类型执行不同的逻辑
     QString cardName = getCardName(cardId);
     
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::GAME_ACTION);
-    
-    sanguosha::GameAction* gameAction = new sanguosha::GameAction();
-    gameAction->set_type(sanguosha::ACTION_PLAY_CARD);
-    gameAction->set_card_id(cardId);
-    gameAction->set_target_player(targetPlayer);
-    
-    message.set_allocated_game_action(gameAction);
-    m_networkManager->sendMessage(message);
+    // 乐观模式下先在本地应用出牌效果，不等服务器的下一份状态
+    uint32_t sequence = m_predictor.predictPlayCard(&m_gameState, cardId, targetPlayer,
+                                                    m_predictionClock.elapsed());
+    m_networkManager->sendGameAction(cardId, targetPlayer, sequence);
+    if (sequence != 0) {
+        updatePlayerInfoTable();
+        updateHandCards();
+        armPredictionTimer();
+    }
     
     // 添加到游戏日志
     addToGameLog(tr("您对玩家%1使用了【%2】").arg(targetPlayer).arg(cardName));
@@ -188,22 +241,21 @@ void MainWindow::onPlayCardClicked(uint32_t cardId, uint32_t targetPlayer) {
 
 void MainWindow::onEndTurnClicked()
 {
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::GAME_ACTION);
-    
-    sanguosha::GameAction* gameAction = new sanguosha::GameAction();
-    gameAction->set_type(sanguosha::ACTION_END_TURN);
-    
-    message.set_allocated_game_action(gameAction);
-    m_networkManager->sendMessage(message);
+    m_networkManager->endTurn();
 }
 
 // 处理登录响应
 void MainWindow::handleLoginResponse(const sanguosha::LoginResponse &response)
 {
     if (response.success()) {
+        static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.login");
+        MetricTimer timer(&updateTime);
+        
         // 保存用户ID
         m_selfUserId = response.user_id();
+        m_gameState.setSelfId(m_selfUserId);
+        // 服务器会回传已处理的操作序号时才启用出牌预测
+        m_predictor.setEnabled(m_networkManager->serverCapabilities() & sanguosha::CAPABILITY_ACTION_SEQUENCE);
         ui->statusbar->showMessage(tr("登录成功！用户ID: %1").arg(m_selfUserId));
         
         // 初始化并切换到大厅界面
@@ -224,6 +276,9 @@ void MainWindow::handleLoginResponse(const sanguosha::LoginResponse &response)
 // 处理房间响应
 void MainWindow::handleRoomResponse(const sanguosha::RoomResponse &response)
 {
+    // 包括结果对话框的停留时间，期间后续消息的分发都被阻塞
+    static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.room_response");
+    MetricTimer timer(&updateTime);
     m_roomOperationTimer->stop();
     
     if (response.success()) {
@@ -261,6 +316,7 @@ void MainWindow::handleGameState(const sanguosha::GameState& state) {
     
     // 确保在UI线程中执行
     if (QThread::currentThread() != this->thread()) {
+        m_networkManager->recordMessageCopy(); // Q_ARG 会深拷贝消息
         QMetaObject::invokeMethod(this, "handleGameStateInUIThread", 
                                   Qt::QueuedConnection,
                                   Q_ARG(sanguosha::GameState, state));
@@ -271,24 +327,42 @@ void MainWindow::handleGameState(const sanguosha::GameState& state) {
 }
 
 void MainWindow::handleGameStateInUIThread(const sanguosha::GameState& state) {
+    static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.game_state");
+    MetricTimer timer(&updateTime);
+    TRACE_SPAN("ui", "handleGameStateInUIThread");
+    
     // 检查游戏界面是否已初始化，如果没有则忽略状态更新
     if (!m_gameScreen || !m_playerInfoTable) {
         qDebug() << "Game screen not ready, ignoring game state update";
         return;
     }
     
+    // 先更新状态存储，界面统一从存储读取；仍在途中的出牌预测重放到新状态上
+    m_gameState.applyState(state);
+    ActionPredictor::ReconcileResult prediction =
+        m_predictor.reconcile(&m_gameState, state.acked_sequence(), m_predictionClock.elapsed());
+    if (prediction.corrected > 0) {
+        ui->statusbar->showMessage(tr("出牌结果与预测不一致，已按服务器状态修正"), 3000);
+    }
+    armPredictionTimer();
+    
     // 更新游戏状态
-    updatePlayerInfoTable(state);
-    updateHandCards(state);
-    updateTurnInfo(state);
+    updatePlayerInfoTable();
+    updateHandCards();
+    updateTurnInfo();
     updateGameLog(state);
     
     // 确定是否是我的回合
-    bool isMyTurn = (state.current_player() == m_selfUserId);
-    updateButtonStates(state.phase(), isMyTurn);
+    updateButtonStates(m_gameState.phase(), m_gameState.isMyTurn());
     
     // 检查游戏结束条件
-    checkGameEndCondition(state);
+    checkGameEndCondition();
+    
+    // 合并后的状态对应最近分发的那条消息，它的跟踪在下一次重绘时结束
+    if (Tracer::enabled() && Tracer::currentFlow() != 0) {
+        Tracer::instance().addFlow(Tracer::FlowPhase::Step, Tracer::currentFlow());
+        m_pendingPaintFlow = Tracer::currentFlow();
+    }
 }
 
 
@@ -302,6 +376,7 @@ void MainWindow::handleGameStart(const sanguosha::GameStart &start)
     
     // 确保在UI线程中执行界面操作
     if (QThread::currentThread() != this->thread()) {
+        m_networkManager->recordMessageCopy(); // Q_ARG 会深拷贝消息
         QMetaObject::invokeMethod(this, "handleGameStartInUIThread", 
                                   Qt::QueuedConnection,
                                   Q_ARG(sanguosha::GameStart, start));
@@ -348,7 +423,10 @@ void MainWindow::showScreen(QWidget *screen)
     QWidget* current = centralWidget();
     
     // 隐藏当前屏幕（如果不是我们要显示的屏幕）
+    // setCentralWidget 会删除原来的中心部件，先取下来交还给主窗口，之后才能再切回这个屏幕
     if (current && current != screen) {
+        takeCentralWidget();
+        current->setParent(this);
         current->hide();
     }
 
@@ -431,11 +509,13 @@ void MainWindow::setupGameScreen()
 
     // 确保所有成员变量都被正确初始化
     m_playerInfoTable = nullptr;
+    m_playerModel = nullptr;
     m_gameLog = nullptr;
+    m_gameLogModel = nullptr;
     m_deckCountLabel = nullptr;
     m_gameArea = nullptr;
     m_turnInfoLabel = nullptr;
-    m_handCardsLayout = nullptr;
+    m_handCards = nullptr;
     m_playCardButton = nullptr;
     m_endTurnButton = nullptr;
     m_cancelButton = nullptr;
@@ -445,14 +525,23 @@ void MainWindow::setupGameScreen()
     
     // 左侧：玩家信息面板
     QVBoxLayout *leftLayout = new QVBoxLayout();
-    m_playerInfoTable = new QTableWidget(0, 3); // 玩家ID, 名称, 血量
-    m_playerInfoTable->setHorizontalHeaderLabels(QStringList() << tr("ID") << tr("名称") << tr("血量"));
+    m_playerModel = new PlayerTableModel(m_gameScreen); // 玩家ID, 名称, 血量
+    m_playerInfoTable = new QTableView();
+    m_playerInfoTable->setModel(m_playerModel);
+    m_playerInfoTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
     m_playerInfoTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
     leftLayout->addWidget(m_playerInfoTable);
     
     // 游戏日志
-    m_gameLog = new QTextEdit();
-    m_gameLog->setReadOnly(true);
+    // 游戏日志只对可见行做布局，容量固定
+    m_gameLogModel = new GameLogModel(1000, m_gameScreen);
+    m_gameLog = new QListView();
+    m_gameLog->setModel(m_gameLogModel);
+    m_gameLog->setUniformItemSizes(true);
+    m_gameLog->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_gameLog->setSelectionMode(QAbstractItemView::NoSelection);
+    connect(m_gameLogModel, &QAbstractItemModel::rowsInserted,
+            m_gameLog, &QListView::scrollToBottom);
     leftLayout->addWidget(m_gameLog);
     mainLayout->addLayout(leftLayout, 1);
     
@@ -484,12 +573,10 @@ void MainWindow::setupGameScreen()
     QVBoxLayout *rightLayout = new QVBoxLayout();
     
     // 手牌区域
-    m_handCardsLayout = new QHBoxLayout(); // 或者 QGridLayout
-    QWidget *handCardsWidget = new QWidget();
-    handCardsWidget->setLayout(m_handCardsLayout);
+    m_handCards = new HandCardsWidget();
     
     QScrollArea *scrollArea = new QScrollArea();
-    scrollArea->setWidget(handCardsWidget);
+    scrollArea->setWidget(m_handCards);
     scrollArea->setWidgetResizable(true);
     rightLayout->addWidget(scrollArea);
     
@@ -507,6 +594,7 @@ void MainWindow::setupGameScreen()
     mainLayout->addLayout(rightLayout, 1);
     
     // 连接信号
+    connect(m_handCards, &HandCardsWidget::cardSelected, this, &MainWindow::onCardSelected);
     connect(m_playCardButton, &QPushButton::clicked, this, &MainWindow::onPlayCardButtonClicked);
     connect(m_endTurnButton, &QPushButton::clicked, this, &MainWindow::onEndTurnClicked);
     connect(m_cancelButton, &QPushButton::clicked, this, &MainWindow::onCancelButtonClicked);
@@ -521,7 +609,7 @@ void MainWindow::setupGameScreen()
     Q_ASSERT(m_deckCountLabel != nullptr);
     Q_ASSERT(m_gameArea != nullptr);
     Q_ASSERT(m_turnInfoLabel != nullptr);
-    Q_ASSERT(m_handCardsLayout != nullptr);
+    Q_ASSERT(m_handCards != nullptr);
     Q_ASSERT(m_playCardButton != nullptr);
     Q_ASSERT(m_endTurnButton != nullptr);
     Q_ASSERT(m_cancelButton != nullptr);
@@ -532,23 +620,11 @@ void MainWindow::setupGameScreen()
 }
 
 //卡牌使用逻辑
-void MainWindow::onCardSelected()
+void MainWindow::onCardSelected(uint32_t cardId)
 {
-    QPushButton *button = qobject_cast<QPushButton*>(sender());
-    if (button) {
-        uint32_t cardId = button->property("cardId").toUInt();
-        m_selectedCard = cardId;
-        
-        // 高亮选中的卡牌
-        for (int i = 0; i < m_handCardsLayout->count(); ++i) {
-            QWidget *widget = m_handCardsLayout->itemAt(i)->widget();
-            if (QPushButton *btn = qobject_cast<QPushButton*>(widget)) {
-                btn->setStyleSheet(btn == button ? "background-color: lightblue;" : "");
-            }
-        }
-        
-        m_playCardButton->setEnabled(true);
-    }
+    // 高亮由手牌区域自行处理
+    m_selectedCard = cardId;
+    m_playCardButton->setEnabled(true);
 }
 
 // 修改onPlayCardButtonClicked，直接确定目标
@@ -562,12 +638,9 @@ void MainWindow::onPlayCardButtonClicked() {
     // 如果是杀，目标是对手
     if (cardName == "杀") {
         // 查找对手ID
-        for (int i = 0; i < m_playerInfoTable->rowCount(); ++i) {
-            int playerId = m_playerInfoTable->item(i, 0)->text().toInt();
-            if (playerId != m_selfUserId) {
-                targetPlayer = playerId;
-                break;
-            }
+        uint32_t opponent = m_gameState.firstOpponent();
+        if (opponent != 0) {
+            targetPlayer = opponent;
         }
     }
 
@@ -585,25 +658,15 @@ void MainWindow::onCancelButtonClicked()
     m_playCardButton->setEnabled(false);
     
     // 清除高亮
-    for (int i = 0; i < m_handCardsLayout->count(); ++i) {
-        if (QPushButton *btn = qobject_cast<QPushButton*>(m_handCardsLayout->itemAt(i)->widget())) {
-            btn->setStyleSheet("");
-        }
-    }
+    m_handCards->clearSelection();
 }
 
 //禁将
 void MainWindow::updateButtonStates(sanguosha::GamePhase phase, bool isMyTurn) {
+    TRACE_SPAN("ui", "updateButtonStates");
     // 检查游戏是否已经结束
-    bool gameEnded = false;
-    for (int i = 0; i < m_playerInfoTable->rowCount(); ++i) {
-        QString hpText = m_playerInfoTable->item(i, 2)->text();
-        int hp = hpText.split('/')[0].toInt();
-        if (hp <= 0) {
-            gameEnded = true;
-            break;
-        }
-    }
+    bool gameEnded = m_gameState.anyPlayerDead();
+    bool isAlive = m_gameState.selfAlive();
     
     if (gameEnded) {
         m_playCardButton->setEnabled(false);
@@ -616,7 +679,7 @@ void MainWindow::updateButtonStates(sanguosha::GamePhase phase, bool isMyTurn) {
     bool canEndTurn = false;
     
     // 根据游戏阶段和是否是自己回合决定按钮状态
-    if (isAlive) { // 使用成员变量
+    if (isAlive) {
         switch (phase) {
         case sanguosha::DRAW_PHASE:
             canPlayCard = false;
@@ -645,9 +708,9 @@ void MainWindow::updateButtonStates(sanguosha::GamePhase phase, bool isMyTurn) {
     m_endTurnButton->setEnabled(canEndTurn);
     
     // 更新状态栏信息
-    if (isMyTurn && isAlive) { // 使用成员变量
+    if (isMyTurn && isAlive) {
         ui->statusbar->showMessage(tr("轮到您的回合，请操作"));
-    } else if (!isAlive) { // 使用成员变量
+    } else if (!isAlive) {
         ui->statusbar->showMessage(tr("您已死亡，无法操作"));
     } else {
         ui->statusbar->showMessage(tr("等待其他玩家操作"));
@@ -657,81 +720,40 @@ void MainWindow::updateButtonStates(sanguosha::GamePhase phase, bool isMyTurn) {
 //玩家信息列表
 
 //手牌显示
-void MainWindow::updateHandCards(const sanguosha::GameState &state)
+void MainWindow::updateHandCards()
 {
-    // 清除现有手牌
-    QLayoutItem *item;
-    while ((item = m_handCardsLayout->takeAt(0)) != nullptr) {
-        delete item->widget();
-        delete item;
-    }
-    
-    // 查找当前玩家手牌
-    for (int i = 0; i < state.players_size(); ++i) {
-        const sanguosha::PlayerState &player = state.players(i);
-        if (player.player_id() == m_selfUserId) {
-            // 添加手牌按钮
-            for (int j = 0; j < player.hand_cards_size(); ++j) {
-                uint32_t cardId = player.hand_cards(j);
-                addCardToHand(cardId);
-            }
-            break;
-        }
-    }
-}
-
-//添加手牌
-void MainWindow::addCardToHand(uint32_t cardId)
-{
-    QPushButton *cardButton = new QPushButton(getCardName(cardId));
-    cardButton->setProperty("cardId", cardId);
-    cardButton->setMinimumSize(80, 120);
-    cardButton->setMaximumSize(80, 120);
-    
-    // 根据卡牌类型设置不同颜色
-    QString style = QString("QPushButton { background-color: %1; border: 2px solid black; }")
-                   .arg(getCardColor(cardId));
-    cardButton->setStyleSheet(style);
-    
-    connect(cardButton, &QPushButton::clicked, this, &MainWindow::onCardSelected);
-    m_handCardsLayout->addWidget(cardButton);
+    TRACE_SPAN("ui", "updateHandCards");
+    // 只对发生变化的槽位增删按钮
+    m_handCards->setCards(m_gameState.hand());
 }
 
 QString MainWindow::getCardName(uint32_t cardId)
 {
-    // 简单的卡牌ID到名称映射
-    static QMap<uint32_t, QString> cardNames = {
-        {1, "杀"}, {2, "闪"}, {3, "桃"},
-        {4, "过河拆桥"}, {5, "顺手牵羊"}, {6, "无中生有"}
-    };
-    return cardNames.value(cardId, QString::number(cardId));
-}
-
-QString MainWindow::getCardColor(uint32_t cardId)
-{
-    // 根据卡牌类型设置颜色
-    if (cardId == 1) return "#ff6666"; // 杀 - 红色
-    if (cardId == 2) return "#66aaff"; // 闪 - 蓝色  
-    if (cardId == 3) return "#66ff66"; // 桃 - 绿色
-    return "#ffff66"; // 其他 - 黄色
+    return HandCardsWidget::cardName(cardId);
 }
 
 //日志系统
 void MainWindow::updateGameLog(const sanguosha::GameState &state) {
+    TRACE_SPAN("ui", "updateGameLog");
     if (!state.game_log().empty()) {
-        addToGameLog(QString::fromStdString(state.game_log()));
+        // 合并后的快照可能带有多行日志，逐行添加
+        const QStringList lines = QString::fromStdString(state.game_log()).split('\n', Qt::SkipEmptyParts);
+        for (const QString &line : lines) {
+            addToGameLog(line);
+        }
     }
 }
 
 //回合管理
-void MainWindow::updateTurnInfo(const sanguosha::GameState &state)
+void MainWindow::updateTurnInfo()
 {
+    TRACE_SPAN("ui", "updateTurnInfo");
     QString phaseName;
     
     // 修复：使用正确的阶段枚举值
     // 根据proto文件，phase是uint32，没有定义具体枚举值
     // 这里需要与服务器协商阶段值的含义
-    uint32_t phase = state.phase();
+    uint32_t phase = m_gameState.phase();
     
     // 假设阶段值约定：
     // 1: 摸牌阶段, 2: 出牌阶段, 3: 弃牌阶段
@@ -743,7 +765,7 @@ void MainWindow::updateTurnInfo(const sanguosha::GameState &state)
     }
     
     m_turnInfoLabel->setText(tr("当前回合: 玩家%1, 阶段: %2")
-                            .arg(state.current_player())
+                            .arg(m_gameState.currentPlayer())
                             .arg(phaseName));
 }
 
@@ -764,6 +786,7 @@ void MainWindow::onMessageReceived(const sanguosha::GameMessage &message)
 void MainWindow::handleGameOver(const sanguosha::GameOver& gameOver) {
     // 确保在UI线程执行
     if (QThread::currentThread() != this->thread()) {
+        m_networkManager->recordMessageCopy(); // Q_ARG 会深拷贝消息
         QMetaObject::invokeMethod(this, "handleGameOverInUIThread", 
                                   Qt::QueuedConnection,
                                   Q_ARG(sanguosha::GameOver, gameOver));
@@ -792,9 +815,38 @@ void MainWindow::debugSendTestMessage()
 }
 
 void MainWindow::addToGameLog(const QString &message) {
-    QString timestamp = QDateTime::currentDateTime().toString("hh:mm:ss");
-    m_gameLog->append(QString("[%1] %2").arg(timestamp).arg(message));
-    m_gameLog->moveCursor(QTextCursor::End);
+    // 批量写入，每帧刷新一次
+    m_gameLogModel->append(message);
+}
+
+void MainWindow::armPredictionTimer() {
+    int64_t deadline = m_predictor.nextDeadlineMs();
+    if (deadline < 0) {
+        m_predictionTimer->stop();
+        return;
+    }
+    int64_t remaining = deadline - m_predictionClock.elapsed();
+    m_predictionTimer->start(static_cast<int>(std::max<int64_t>(0, remaining)));
+}
+
+void MainWindow::onPredictionTimeout() {
+    // 出牌后迟迟没有新的状态：从最近一份权威状态重建，超时的预测随之回退，其余的重新应用
+    const GameStateReconstructor& reconstructor = m_networkManager->stateReconstructor();
+    if (m_gameScreen && reconstructor.hasSnapshot()) {
+        const sanguosha::GameState& state = reconstructor.state();
+        m_gameState.applyState(state);
+        ActionPredictor::ReconcileResult prediction =
+            m_predictor.reconcile(&m_gameState, state.acked_sequence(), m_predictionClock.elapsed());
+        if (prediction.corrected > 0) {
+            ui->statusbar->showMessage(tr("出牌没有得到服务器确认，已撤销"), 3000);
+        }
+        updatePlayerInfoTable();
+        updateHandCards();
+        updateButtonStates(m_gameState.phase(), m_gameState.isMyTurn());
+    } else {
+        m_predictor.reset();
+    }
+    armPredictionTimer();
 }
 
 void MainWindow::resetGameState() {
@@ -804,30 +856,29 @@ void MainWindow::resetGameState() {
     m_cancelButton->setEnabled(false);
     
     // 清空手牌
-    QLayoutItem* item;
-    while ((item = m_handCardsLayout->takeAt(0)) != nullptr) {
-        delete item->widget();
-        delete item;
-    }
+    m_handCards->clear();
     
     // 清空玩家信息
-    m_playerInfoTable->setRowCount(0);
+    m_gameState.reset();
+    m_predictor.reset();
+    m_predictionTimer->stop();
+    m_playerModel->clear();
     
     // 清空游戏日志
-    m_gameLog->clear();
+    m_gameLogModel->clear();
     
     // 重置回合信息
     m_turnInfoLabel->setText("");
 }
 
-void MainWindow::checkGameEndCondition(const sanguosha::GameState &state)
+void MainWindow::checkGameEndCondition()
 {
     // 检查是否有玩家死亡
-    for (int i = 0; i < state.players_size(); ++i) {
-        const sanguosha::PlayerState &player = state.players(i);
-        if (player.hp() <= 0) {
+    for (int i = 0; i < m_gameState.playerCount(); ++i) {
+        const ClientPlayer &player = m_gameState.playerAt(i);
+        if (!player.isAlive()) {
             // 玩家死亡，游戏结束
-            addToGameLog(tr("玩家%1死亡").arg(player.player_id()));
+            addToGameLog(tr("玩家%1死亡").arg(player.playerId));
             // 服务器应该会发送GAME_OVER消息
             return;
         }
@@ -837,20 +888,20 @@ void MainWindow::checkGameEndCondition(const sanguosha::GameState &state)
 // 添加请求房间列表的函数
 void MainWindow::requestRoomList(QTableWidget* roomTable)
 {
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::ROOM_LIST_REQUEST);
-    
     // 清空现有房间列表
     roomTable->setRowCount(0);
     
     // 发送请求
-    m_networkManager->sendMessage(message);
+    m_networkManager->requestRoomList();
     
     ui->statusbar->showMessage(tr("正在获取房间列表..."));
 }
 
 void MainWindow::handleRoomListResponse(const sanguosha::RoomListResponse &response)
 {
+    static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.room_list");
+    MetricTimer timer(&updateTime);
+    
     // 获取大厅界面中的房间表格
     QTableWidget* roomTable = m_lobbyScreen->findChild<QTableWidget*>();
     if (!roomTable) return;
@@ -885,6 +936,9 @@ void MainWindow::handleRoomListResponse(const sanguosha::RoomListResponse &respo
 // mainwindow.cpp - 修改handleGameStartInUIThread函数
 void MainWindow::handleGameStartInUIThread(const sanguosha::GameStart &start)
 {
+    static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.game_start");
+    MetricTimer timer(&updateTime);
+    
     qDebug() << "Handling game start in UI thread";
     
     // 添加更严格的安全检查
@@ -915,8 +969,8 @@ void MainWindow::handleGameStartInUIThread(const sanguosha::GameStart &start)
     showScreen(m_gameScreen);
     
     // 清空游戏日志
-    m_gameLog->clear();
-    m_gameLog->append(tr("游戏开始！"));
+    m_gameLogModel->clear();
+    addToGameLog(tr("游戏开始！"));
     
     // 正确设置自己的用户ID - 从登录响应中获取，而不是从GameStart中获取
     // m_selfUserId 应该在登录响应中已经设置好了
@@ -925,64 +979,34 @@ void MainWindow::handleGameStartInUIThread(const sanguosha::GameStart &start)
     // 添加玩家信息到日志
     for (int i = 0; i < start.player_ids_size(); ++i) {
         uint32_t playerId = start.player_ids(i);
-        m_gameLog->append(tr("玩家 %1 加入游戏").arg(playerId));
+        addToGameLog(tr("玩家 %1 加入游戏").arg(playerId));
     }
 }
 
 //玩家信息列表
-void MainWindow::updatePlayerInfoTable(const sanguosha::GameState &state) {
-    m_playerInfoTable->setRowCount(state.players_size());
-    for (int i = 0; i < state.players_size(); ++i) {
-        const sanguosha::PlayerState &player = state.players(i);
-        
-        // 设置玩家ID
-        m_playerInfoTable->setItem(i, 0, new QTableWidgetItem(QString::number(player.player_id())));
-        
-        // 设置玩家名称
-        m_playerInfoTable->setItem(i, 1, new QTableWidgetItem(QString::fromStdString(player.username())));
-        
-        // 设置玩家血量 - 确保正确显示
-        QString hpText = QString("%1/%2").arg(player.hp()).arg(player.max_hp());
-        QTableWidgetItem* hpItem = new QTableWidgetItem(hpText);
-        
-        // 如果血量为0，特殊标记
-        if (player.hp() <= 0) {
-            hpItem->setBackground(Qt::red);
-            hpItem->setForeground(Qt::white);
-        }
-        
-        m_playerInfoTable->setItem(i, 2, hpItem);
-        
-        // 更新当前玩家的存活状态
-        if (player.player_id() == m_selfUserId) {
-            isAlive = (player.hp() > 0);
-        }
-        
-        // 高亮当前玩家
-        for (int col = 0; col < 3; ++col) {
-            if (player.player_id() == state.current_player()) {
-                m_playerInfoTable->item(i, col)->setBackground(Qt::yellow);
-            } else {
-                m_playerInfoTable->item(i, col)->setBackground(Qt::white);
-            }
-            m_playerInfoTable->item(i, col)->setForeground(Qt::black);
-        }
-    }
+void MainWindow::updatePlayerInfoTable() {
+    TRACE_SPAN("ui", "updatePlayerInfoTable");
+    // 模型只对变化的单元格发出 dataChanged
+    m_playerModel->updateFromState(m_gameState);
 }
 
 void MainWindow::handleGameActionResponse(const sanguosha::GameState& state) {
+    m_gameState.applyState(state);
+    
     // 更新游戏状态
-    updatePlayerInfoTable(state);
-    updateHandCards(state);
-    updateTurnInfo(state);
+    updatePlayerInfoTable();
+    updateHandCards();
+    updateTurnInfo();
     updateGameLog(state);
     
     // 确定是否是我的回合
-    bool isMyTurn = (state.current_player() == m_selfUserId);
-    updateButtonStates(state.phase(), isMyTurn);
+    updateButtonStates(m_gameState.phase(), m_gameState.isMyTurn());
 }
 
 void MainWindow::handleGameOverInUIThread(const sanguosha::GameOver& gameOver) {
+    // 包括结算对话框的停留时间，期间后续消息的分发都被阻塞
+    static MetricHistogram& updateTime = MetricsRegistry::instance().timingHistogram("ui.update_us.game_over");
+    MetricTimer timer(&updateTime);
     if (gameOver.winner_id() == m_selfUserId) {
         addToGameLog("恭喜！你获得了胜利！");
         QMessageBox::information(this, "游戏结束", "你赢了！");
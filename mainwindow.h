@@ -4,8 +4,11 @@
 #include <QMainWindow>
 #include <QDataStream>
 #include <QDateTime>
+#include <QElapsedTimer>
 #include <QMessageBox>
 #include <QTableWidget>
+#include <QTableView>
+#include <QListView>
 #include <QTextEdit>
 #include <QLabel>
 #include <QScrollArea>
@@ -18,6 +21,11 @@
 #include <QLineEdit>
 #include "proto/sanguosha.pb.h"
 #include "network/networkmanager.h"
+#include "handcardswidget.h"
+#include "playertablemodel.h"
+#include "gamelogmodel.h"
+#include "game/actionpredictor.h"
+#include "game/clientgamestate.h"
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -28,13 +36,19 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
-    MainWindow(QWidget *parent = nullptr);
+    // connectOnStart 为 false 时不连接服务器，用于基准测试直接驱动界面更新
+    MainWindow(QWidget *parent = nullptr, bool connectOnStart = true);
     ~MainWindow();
 
+protected:
+    bool event(QEvent *event) override;
+
 private slots:
     void onConnectionStatusChanged(bool connected);
     void onMessageReceived(const sanguosha::GameMessage &message);
     void onErrorOccurred(const QString &errorString);
+    void onSessionRestored();
+    void onSessionLost(const QString &reason);
     
     void onLoginButtonClicked(const QString &username, const QString &password);
     void onCreateRoomClicked();
@@ -47,7 +61,7 @@ private slots:
     void handleGameState(const sanguosha::GameState &state);
     void handleGameStart(const sanguosha::GameStart &start);
     
-    void onCardSelected();
+    void onCardSelected(uint32_t cardId);
     void onPlayCardButtonClicked();
     void onCancelButtonClicked();
     void updateButtonStates(sanguosha::GamePhase phase, bool isMyTurn);
@@ -78,12 +92,14 @@ private:
     void setupGameScreen();
     QWidget *m_gameScreen;
 
-    QTableWidget *m_playerInfoTable;
-    QTextEdit *m_gameLog;
+    QTableView *m_playerInfoTable;
+    PlayerTableModel *m_playerModel;
+    QListView *m_gameLog;
+    GameLogModel *m_gameLogModel;
     QLabel *m_deckCountLabel;
     QLabel *m_gameArea;
     QLabel *m_turnInfoLabel;
-    QHBoxLayout *m_handCardsLayout;
+    HandCardsWidget *m_handCards;
     QPushButton *m_playCardButton;
     QPushButton *m_endTurnButton;
     QPushButton *m_cancelButton;
@@ -92,19 +108,30 @@ private:
     uint32_t m_selectedCard;
     uint32_t m_selfUserId;
 
-    void updatePlayerInfoTable(const sanguosha::GameState &state);
-    void updateHandCards(const sanguosha::GameState &state);
+    void updatePlayerInfoTable();
+    void updateHandCards();
     void updateGameLog(const sanguosha::GameState &state);
-    void updateTurnInfo(const sanguosha::GameState &state);
-    void addCardToHand(uint32_t cardId);
+    void updateTurnInfo();
     QString getCardName(uint32_t cardId);
-    QString getCardColor(uint32_t cardId);
     
     // 添加缺失的函数声明
     void addToGameLog(const QString &message);
     void resetGameState();
-    void checkGameEndCondition(const sanguosha::GameState &state);
-    bool isAlive;
+    void checkGameEndCondition();
+    // 按最早未确认预测的超时时刻重新设置回退定时器
+    void armPredictionTimer();
+    void onPredictionTimeout();
+
+    // 对局状态存储，界面和出牌逻辑都从这里读取
+    ClientGameState m_gameState;
+    ActionPredictor m_predictor;
+    // 预测的发出时刻和超时都按这个单调时钟计算，不受系统时间调整影响
+    QElapsedTimer m_predictionClock;
+    // 服务器丢弃操作且不再发来状态时，由它触发超时回退
+    QTimer *m_predictionTimer;
+    
+    // 最近一次状态更新对应消息的跟踪 flow id，在下一次重绘时结束，0表示没有
+    uint64_t m_pendingPaintFlow;
     
 };
 
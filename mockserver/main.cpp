@@ -0,0 +1,53 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QLoggingCategory>
+#include <cstdio>
+#include "mockserver.h"
+
+// 本地模拟服务器：不需要正式后端即可运行客户端、压测工具和基准测试
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("sanguosha_mockserver");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Scriptable mock Sanguosha game server");
+    parser.addHelpOption();
+    QCommandLineOption portOption("port", "Listen port.", "port", "9527");
+    QCommandLineOption roomsOption("rooms", "Number of empty rooms listed in ROOM_LIST_RESPONSE.", "n", "8");
+    QCommandLineOption playersOption("players", "Players per room; a full room starts a game.", "n", "2");
+    QCommandLineOption handOption("hand-size", "Cards dealt to each player at game start.", "n", "4");
+    QCommandLineOption delayOption("delay", "Delay every response by this many milliseconds.", "ms", "0");
+    QCommandLineOption burstOption("burst", "Extra GAME_STATE messages pushed per interval to every game.", "n", "0");
+    QCommandLineOption burstIntervalOption("burst-interval", "Interval between GAME_STATE bursts.", "ms", "1000");
+    QCommandLineOption disconnectOption("disconnect-after", "Close each connection after sending this many frames.", "n", "0");
+    QCommandLineOption seedOption("seed", "Random seed for dealing cards.", "seed", "1");
+    QCommandLineOption verboseOption("verbose", "Print debug logging.");
+    parser.addOptions({ portOption, roomsOption, playersOption, handOption, delayOption, burstOption,
+                        burstIntervalOption, disconnectOption, seedOption, verboseOption });
+    parser.process(app);
+
+    if (!parser.isSet(verboseOption)) {
+        QLoggingCategory::setFilterRules("*.debug=false");
+    }
+
+    MockServerConfig config;
+    config.roomCount = qMax(0, parser.value(roomsOption).toInt());
+    config.playersPerRoom = qMax(2, parser.value(playersOption).toInt());
+    config.handSize = qMax(0, parser.value(handOption).toInt());
+    config.responseDelayMs = qMax(0, parser.value(delayOption).toInt());
+    config.burstCount = qMax(0, parser.value(burstOption).toInt());
+    config.burstIntervalMs = qMax(1, parser.value(burstIntervalOption).toInt());
+    config.disconnectAfterFrames = qMax(0, parser.value(disconnectOption).toInt());
+    config.seed = parser.value(seedOption).toUInt();
+
+    MockServer server(config);
+    quint16 port = static_cast<quint16>(parser.value(portOption).toUInt());
+    if (!server.listen(QHostAddress::Any, port)) {
+        std::fprintf(stderr, "Failed to listen on port %u: %s\n", port, qPrintable(server.errorString()));
+        return 1;
+    }
+    std::printf("Mock server listening on port %u\n", server.serverPort());
+    std::fflush(stdout);
+    return app.exec();
+}
@@ -0,0 +1,544 @@
+#include "mockserver.h"
+#include <QDebug>
+#include <algorithm>
+#include "framecompression.h"
+#include "networkworker.h"
+
+namespace {
+const uint32_t kInitialHp = 4;
+const uint32_t kCardKinds = 6;   // 1杀 2闪 3桃 4过河拆桥 5顺手牵羊 6无中生有
+const uint32_t kSupportedCapabilities = sanguosha::CAPABILITY_FRAME_COMPRESSION
+                                      | sanguosha::CAPABILITY_MESSAGE_BATCH
+                                      | sanguosha::CAPABILITY_ACTION_SEQUENCE;
+}
+
+MockServer::MockServer(const MockServerConfig& config, QObject *parent)
+    : QObject(parent),
+      m_config(config),
+      m_server(new QTcpServer(this)),
+      m_burstTimer(new QTimer(this)),
+      m_random(config.seed),
+      m_nextUserId(1),
+      m_nextRoomId(1),
+      m_framesReceived(0),
+      m_framesSent(0) {
+
+    connect(m_server, &QTcpServer::newConnection, this, &MockServer::onNewConnection);
+    connect(m_burstTimer, &QTimer::timeout, this, &MockServer::onBurstTick);
+
+    // 预置空房间，用于测试大房间列表
+    for (int i = 0; i < m_config.roomCount; ++i) {
+        Room room;
+        room.roomId = m_nextRoomId++;
+        m_rooms[room.roomId] = room;
+    }
+}
+
+MockServer::~MockServer() {
+}
+
+bool MockServer::listen(const QHostAddress& address, quint16 port) {
+    if (!m_server->listen(address, port)) {
+        return false;
+    }
+    if (m_config.burstCount > 0) {
+        m_burstTimer->start(m_config.burstIntervalMs);
+    }
+    return true;
+}
+
+void MockServer::onNewConnection() {
+    while (QTcpSocket* socket = m_server->nextPendingConnection()) {
+        socket->setSocketOption(QAbstractSocket::LowDelayOption, 1);
+        m_connections.emplace_back(new Connection);
+        Connection* connection = m_connections.back().get();
+        connection->socket = socket;
+
+        connect(socket, &QTcpSocket::readyRead, this, [this, connection]() { onReadyRead(connection); });
+        connect(socket, &QTcpSocket::disconnected, this, [this, connection]() { onDisconnected(connection); });
+        // 套接字销毁后才释放连接对象，延迟发送的回调以套接字为上下文，不会访问已释放的连接
+        connect(socket, &QObject::destroyed, this, [this, connection]() {
+            m_connections.erase(std::remove_if(m_connections.begin(), m_connections.end(),
+                [connection](const std::unique_ptr<Connection>& item) { return item.get() == connection; }),
+                m_connections.end());
+        });
+    }
+}
+
+void MockServer::onDisconnected(Connection* connection) {
+    if (User* user = userOf(connection)) {
+        // 用户保留在房间中，可以用恢复令牌重新登录
+        user->connection = nullptr;
+    }
+    connection->userId = 0;
+    connection->socket->deleteLater();
+}
+
+void MockServer::onReadyRead(Connection* connection) {
+    while (connection->socket->bytesAvailable() > 0) {
+        size_t available = 0;
+        char* dest = connection->decoder.prepareWrite(1, &available);
+        qint64 bytesRead = connection->socket->read(dest, static_cast<qint64>(available));
+        if (bytesRead <= 0) {
+            break;
+        }
+        connection->decoder.commitWrite(static_cast<size_t>(bytesRead));
+    }
+
+    FrameView frame;
+    while (connection->decoder.nextFrame(frame)) {
+        ++m_framesReceived;
+        sanguosha::GameMessage message;
+        if (!decodeFrame(frame, &message)) {
+            qWarning() << "Mock server: failed to parse frame";
+            continue;
+        }
+        if (message.type() == sanguosha::MESSAGE_BATCH) {
+            for (const sanguosha::GameMessage& inner : message.batch().messages()) {
+                handleMessage(connection, inner);
+            }
+        } else {
+            handleMessage(connection, message);
+        }
+        if (!connection->socket->isOpen()) {
+            return;
+        }
+    }
+
+    if (connection->decoder.hasError()) {
+        qWarning() << "Mock server: invalid frame length, closing connection";
+        connection->socket->abort();
+    }
+}
+
+bool MockServer::decodeFrame(const FrameView& frame, sanguosha::GameMessage* message) const {
+    QByteArray body;
+    if (frame.compressed) {
+        if (!decompressFrameBody(frame, 16 * 1024 * 1024, &body)) {
+            return false;
+        }
+    } else {
+        // 模拟服务器不追求零拷贝，拼成一段连续数据再解析
+        body.reserve(static_cast<int>(frame.size()));
+        body.append(frame.first, static_cast<int>(frame.firstSize));
+        body.append(frame.second, static_cast<int>(frame.secondSize));
+    }
+    return message->ParseFromArray(body.constData(), body.size());
+}
+
+void MockServer::handleMessage(Connection* connection, const sanguosha::GameMessage& message) {
+    switch (message.type()) {
+    case sanguosha::HEARTBEAT:
+        // 原样回显，客户端据此计算往返时延
+        send(connection, message);
+        break;
+    case sanguosha::LOGIN_REQUEST:
+        handleLogin(connection, message.login_request());
+        break;
+    case sanguosha::ROOM_REQUEST:
+        handleRoomRequest(connection, message.room_request());
+        break;
+    case sanguosha::ROOM_LIST_REQUEST:
+        handleRoomList(connection);
+        break;
+    case sanguosha::GAME_ACTION:
+        handleGameAction(connection, message.game_action());
+        break;
+    case sanguosha::GAME_STATE_REQUEST:
+        handleStateRequest(connection);
+        break;
+    default:
+        qWarning() << "Mock server: unhandled message type" << message.type();
+        break;
+    }
+}
+
+void MockServer::handleLogin(Connection* connection, const sanguosha::LoginRequest& request) {
+    sanguosha::GameMessage reply;
+    reply.set_type(sanguosha::LOGIN_RESPONSE);
+    sanguosha::LoginResponse* response = reply.mutable_login_response();
+
+    if (request.username().empty()) {
+        response->set_success(false);
+        response->set_error_message("empty username");
+        send(connection, reply);
+        return;
+    }
+
+    // 令牌有效时恢复原来的用户和房间
+    User* user = nullptr;
+    if (!request.resume_token().empty()) {
+        for (auto& entry : m_users) {
+            if (entry.second.resumeToken == request.resume_token()) {
+                user = &entry.second;
+                break;
+            }
+        }
+    }
+    bool resumed = user != nullptr;
+    if (!user) {
+        uint32_t userId = m_nextUserId++;
+        user = &m_users[userId];
+        user->userId = userId;
+        user->username = request.username();
+        user->resumeToken = "mock-" + std::to_string(userId) + "-" + std::to_string(m_random());
+    }
+    if (user->connection && user->connection != connection) {
+        user->connection->userId = 0;
+    }
+    user->connection = connection;
+    connection->userId = user->userId;
+    connection->capabilities = request.capabilities() & kSupportedCapabilities;
+
+    response->set_success(true);
+    response->set_user_id(user->userId);
+    response->set_capabilities(connection->capabilities);
+    response->set_resume_token(user->resumeToken);
+    response->set_resumed(resumed);
+    send(connection, reply);
+}
+
+void MockServer::handleRoomRequest(Connection* connection, const sanguosha::RoomRequest& request) {
+    User* user = userOf(connection);
+    if (!user) {
+        sendRoomResponse(connection, false, "not logged in", nullptr);
+        return;
+    }
+
+    switch (request.action()) {
+    case sanguosha::CREATE_ROOM: {
+        removeFromRoom(user);
+        Room& room = m_rooms[m_nextRoomId];
+        room.roomId = m_nextRoomId++;
+        room.players.push_back(user->userId);
+        user->roomId = room.roomId;
+        sendRoomResponse(connection, true, std::string(), &room);
+        break;
+    }
+    case sanguosha::JOIN_ROOM: {
+        auto it = m_rooms.find(request.room_id());
+        if (it == m_rooms.end()) {
+            sendRoomResponse(connection, false, "room not found", nullptr);
+            return;
+        }
+        Room& room = it->second;
+        bool member = std::find(room.players.begin(), room.players.end(), user->userId) != room.players.end();
+        if (member) {
+            // 重新加入自己所在的房间（断线重连）
+            sendRoomResponse(connection, true, std::string(), &room);
+            return;
+        }
+        if (room.status != sanguosha::WAITING
+                || static_cast<int>(room.players.size()) >= m_config.playersPerRoom) {
+            sendRoomResponse(connection, false, "room is full", &room);
+            return;
+        }
+        removeFromRoom(user);
+        room.players.push_back(user->userId);
+        user->roomId = room.roomId;
+        sendRoomResponse(connection, true, std::string(), &room);
+        if (static_cast<int>(room.players.size()) >= m_config.playersPerRoom) {
+            startGame(&room);
+        }
+        break;
+    }
+    case sanguosha::LEAVE_ROOM:
+        removeFromRoom(user);
+        sendRoomResponse(connection, true, std::string(), nullptr);
+        break;
+    case sanguosha::START_GAME: {
+        auto it = m_rooms.find(user->roomId);
+        if (it == m_rooms.end() || it->second.players.size() < 2 || it->second.status != sanguosha::WAITING) {
+            sendRoomResponse(connection, false, "cannot start game", nullptr);
+            return;
+        }
+        sendRoomResponse(connection, true, std::string(), &it->second);
+        startGame(&it->second);
+        break;
+    }
+    default:
+        sendRoomResponse(connection, false, "unknown room action", nullptr);
+        break;
+    }
+}
+
+void MockServer::handleRoomList(Connection* connection) {
+    sanguosha::GameMessage reply;
+    reply.set_type(sanguosha::ROOM_LIST_RESPONSE);
+    sanguosha::RoomListResponse* response = reply.mutable_room_list_response();
+    for (const auto& entry : m_rooms) {
+        fillRoomInfo(entry.second, response->add_rooms());
+    }
+    send(connection, reply);
+}
+
+void MockServer::handleGameAction(Connection* connection, const sanguosha::GameAction& action) {
+    User* user = userOf(connection);
+    if (!user) {
+        return;
+    }
+    auto it = m_rooms.find(user->roomId);
+    if (it == m_rooms.end() || it->second.status != sanguosha::PLAYING) {
+        return;
+    }
+    Room& room = it->second;
+    if (action.sequence() != 0) {
+        user->ackedSequence = action.sequence();
+    }
+
+    sanguosha::GameState& state = room.state;
+    sanguosha::PlayerState* self = findPlayer(&state, user->userId);
+    // 不是自己的回合时不改变状态，但仍回传一份状态让客户端确认（并回退）预测
+    if (self && state.current_player() == user->userId) {
+        if (action.type() == sanguosha::ACTION_PLAY_CARD) {
+            playCard(&room, self, action);
+        } else if (action.type() == sanguosha::ACTION_END_TURN) {
+            // 轮到下一位存活的玩家，摸两张牌
+            int count = state.players_size();
+            int index = 0;
+            while (index < count && state.players(index).player_id() != user->userId) {
+                ++index;
+            }
+            for (int step = 1; step <= count; ++step) {
+                sanguosha::PlayerState* next = state.mutable_players((index + step) % count);
+                if (next->hp() > 0) {
+                    state.set_current_player(next->player_id());
+                    drawCards(next, 2);
+                    state.set_game_log(next->username() + " 的回合");
+                    break;
+                }
+            }
+        }
+    }
+    if (room.status == sanguosha::PLAYING) {
+        broadcastState(&room);
+    }
+}
+
+void MockServer::playCard(Room* room, sanguosha::PlayerState* self, const sanguosha::GameAction& action) {
+    auto* hand = self->mutable_hand_cards();
+    auto card = std::find(hand->begin(), hand->end(), action.card_id());
+    if (card == hand->end() || action.card_id() == 2) {
+        room->state.set_game_log(self->username() + " 出牌无效");
+        return;
+    }
+    hand->erase(card);
+
+    sanguosha::PlayerState* target = findPlayer(&room->state, action.target_player());
+    std::string log = self->username() + " 使用了 " + std::to_string(action.card_id());
+    switch (action.card_id()) {
+    case 1:  // 杀
+        if (target && target != self && target->hp() > 0) {
+            target->set_hp(target->hp() - 1);
+        }
+        break;
+    case 3:  // 桃
+        self->set_hp(std::min(self->hp() + 1, self->max_hp()));
+        break;
+    case 4:  // 过河拆桥
+    case 5:  // 顺手牵羊
+        if (target && target != self && target->hand_cards_size() > 0) {
+            std::uniform_int_distribution<int> pick(0, target->hand_cards_size() - 1);
+            int index = pick(m_random);
+            uint32_t taken = target->hand_cards(index);
+            target->mutable_hand_cards()->erase(target->mutable_hand_cards()->begin() + index);
+            if (action.card_id() == 5) {
+                self->add_hand_cards(taken);
+            }
+        }
+        break;
+    case 6:  // 无中生有
+        drawCards(self, 2);
+        break;
+    default:
+        break;
+    }
+    room->state.set_game_log(log);
+
+    if (target && target->hp() == 0) {
+        endGame(room, self->player_id());
+    }
+}
+
+void MockServer::handleStateRequest(Connection* connection) {
+    User* user = userOf(connection);
+    if (!user) {
+        return;
+    }
+    auto it = m_rooms.find(user->roomId);
+    if (it != m_rooms.end() && it->second.status == sanguosha::PLAYING) {
+        sendState(user, it->second);
+    }
+}
+
+void MockServer::onBurstTick() {
+    // 对局中的房间一次推送多份状态，用于测试客户端的接收和合并吞吐
+    for (auto& entry : m_rooms) {
+        Room& room = entry.second;
+        if (room.status != sanguosha::PLAYING) {
+            continue;
+        }
+        for (int i = 0; i < m_config.burstCount; ++i) {
+            room.state.set_game_log("burst " + std::to_string(i));
+            broadcastState(&room);
+        }
+    }
+}
+
+void MockServer::startGame(Room* room) {
+    room->status = sanguosha::PLAYING;
+    sanguosha::GameState& state = room->state;
+    state.Clear();
+    for (uint32_t playerId : room->players) {
+        sanguosha::PlayerState* player = state.add_players();
+        player->set_player_id(playerId);
+        player->set_username(m_users[playerId].username);
+        player->set_hp(kInitialHp);
+        player->set_max_hp(kInitialHp);
+        drawCards(player, m_config.handSize);
+        m_users[playerId].ackedSequence = 0;
+    }
+    state.set_current_player(room->players.front());
+    state.set_phase(sanguosha::PLAY_PHASE);
+    state.set_game_log("游戏开始");
+
+    sanguosha::GameMessage start;
+    start.set_type(sanguosha::GAME_START);
+    start.mutable_game_start()->set_room_id(room->roomId);
+    for (uint32_t playerId : room->players) {
+        start.mutable_game_start()->add_player_ids(playerId);
+    }
+    for (uint32_t playerId : room->players) {
+        if (Connection* connection = m_users[playerId].connection) {
+            send(connection, start);
+        }
+    }
+    broadcastState(room);
+}
+
+void MockServer::endGame(Room* room, uint32_t winnerId) {
+    broadcastState(room);
+
+    sanguosha::GameMessage over;
+    over.set_type(sanguosha::GAME_OVER);
+    over.mutable_game_over()->set_winner_id(winnerId);
+    for (uint32_t playerId : room->players) {
+        User& user = m_users[playerId];
+        if (user.connection) {
+            send(user.connection, over);
+        }
+        user.roomId = 0;
+    }
+    room->players.clear();
+    room->status = sanguosha::WAITING;
+    room->state.Clear();
+}
+
+void MockServer::drawCards(sanguosha::PlayerState* player, int count) {
+    std::uniform_int_distribution<uint32_t> card(1, kCardKinds);
+    for (int i = 0; i < count; ++i) {
+        player->add_hand_cards(card(m_random));
+    }
+}
+
+void MockServer::broadcastState(Room* room) {
+    room->state.set_version(room->state.version() + 1);
+    for (uint32_t playerId : room->players) {
+        User& user = m_users[playerId];
+        if (user.connection) {
+            sendState(&user, *room);
+        }
+    }
+}
+
+void MockServer::sendState(User* user, const Room& room) {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    *message.mutable_game_state() = room.state;
+    message.mutable_game_state()->set_acked_sequence(user->ackedSequence);
+    send(user->connection, message);
+}
+
+void MockServer::sendRoomResponse(Connection* connection, bool success, const std::string& error,
+                                  const Room* room) {
+    sanguosha::GameMessage reply;
+    reply.set_type(sanguosha::ROOM_RESPONSE);
+    sanguosha::RoomResponse* response = reply.mutable_room_response();
+    response->set_success(success);
+    response->set_error_message(error);
+    if (room) {
+        fillRoomInfo(*room, response->mutable_room_info());
+    }
+    send(connection, reply);
+}
+
+void MockServer::removeFromRoom(User* user) {
+    auto it = m_rooms.find(user->roomId);
+    user->roomId = 0;
+    if (it == m_rooms.end()) {
+        return;
+    }
+    std::vector<uint32_t>& players = it->second.players;
+    players.erase(std::remove(players.begin(), players.end(), user->userId), players.end());
+    if (it->second.status == sanguosha::PLAYING && players.size() < 2) {
+        endGame(&it->second, players.empty() ? 0 : players.front());
+    }
+}
+
+void MockServer::fillRoomInfo(const Room& room, sanguosha::RoomInfo* info) const {
+    info->set_room_id(room.roomId);
+    for (uint32_t playerId : room.players) {
+        info->add_players(playerId);
+    }
+    info->set_current_players(static_cast<uint32_t>(room.players.size()));
+    info->set_max_players(static_cast<uint32_t>(m_config.playersPerRoom));
+    info->set_status(room.status);
+}
+
+sanguosha::PlayerState* MockServer::findPlayer(sanguosha::GameState* state, uint32_t playerId) {
+    for (sanguosha::PlayerState& player : *state->mutable_players()) {
+        if (player.player_id() == playerId) {
+            return &player;
+        }
+    }
+    return nullptr;
+}
+
+MockServer::User* MockServer::userOf(Connection* connection) {
+    auto it = m_users.find(connection->userId);
+    return it == m_users.end() ? nullptr : &it->second;
+}
+
+void MockServer::send(Connection* connection, const sanguosha::GameMessage& message) {
+    if (m_config.responseDelayMs <= 0) {
+        writeFrame(connection, message);
+        return;
+    }
+    // 以套接字为上下文，连接在延迟期间断开时回调不会执行
+    QTimer::singleShot(m_config.responseDelayMs, connection->socket, [this, connection, message]() {
+        writeFrame(connection, message);
+    });
+}
+
+void MockServer::writeFrame(Connection* connection, const sanguosha::GameMessage& message) {
+    QTcpSocket* socket = connection->socket;
+    if (socket->state() != QAbstractSocket::ConnectedState) {
+        return;
+    }
+
+    // 客户端在登录时声明支持压缩后，大消息按与客户端相同的规则压缩
+    size_t threshold = (connection->capabilities & sanguosha::CAPABILITY_FRAME_COMPRESSION)
+        ? kDefaultCompressThreshold : 0;
+    std::vector<char> frame;
+    if (!NetworkWorker::appendFrame(message, &frame, threshold)) {
+        qWarning() << "Mock server: failed to serialize message";
+        return;
+    }
+    socket->write(frame.data(), static_cast<qint64>(frame.size()));
+    ++m_framesSent;
+
+    if (m_config.disconnectAfterFrames > 0 && ++connection->framesSent >= m_config.disconnectAfterFrames) {
+        qDebug() << "Mock server: disconnecting client after" << connection->framesSent << "frames";
+        socket->disconnectFromHost();
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef MOCK_SERVER_H
+#define MOCK_SERVER_H
+
+#include <QHostAddress>
+#include <QObject>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "framedecoder.h"
+#include "sanguosha.pb.h"
+
+// 模拟服务器的行为参数，用于构造可复现的测试和基准场景
+struct MockServerConfig {
+    int roomCount = 8;               // 预置的空房间数量，房间列表响应随之变大
+    int playersPerRoom = 2;          // 房间满员后自动开局
+    int handSize = 4;                // 开局时每人的手牌数
+    int responseDelayMs = 0;         // 每个响应额外延迟，模拟慢服务器
+    int burstCount = 0;              // 对局中每个周期额外推送的 GAME_STATE 数量
+    int burstIntervalMs = 1000;
+    int disconnectAfterFrames = 0;   // 向每个连接发送这么多帧后主动断开，0表示不断开
+    uint32_t seed = 1;               // 发牌使用的随机种子
+};
+
+// 使用与正式服务器相同的长度前缀 GameMessage 协议的轻量模拟服务器。
+// 支持登录（含会话恢复）、房间列表、创建/加入/离开房间、满员开局、出牌和结束回合，
+// 以及按配置推送成批的游戏状态、延迟响应和主动断开。
+class MockServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit MockServer(const MockServerConfig& config, QObject *parent = nullptr);
+    ~MockServer();
+
+    bool listen(const QHostAddress& address, quint16 port);
+    quint16 serverPort() const { return m_server->serverPort(); }
+    QString errorString() const { return m_server->errorString(); }
+
+    quint64 framesReceived() const { return m_framesReceived; }
+    quint64 framesSent() const { return m_framesSent; }
+
+private slots:
+    void onNewConnection();
+    void onBurstTick();
+
+private:
+    struct Connection {
+        QTcpSocket* socket = nullptr;
+        FrameDecoder decoder;
+        uint32_t userId = 0;
+        uint32_t capabilities = 0;
+        int framesSent = 0;
+    };
+
+    struct User {
+        uint32_t userId = 0;
+        std::string username;
+        std::string resumeToken;
+        uint32_t roomId = 0;
+        uint32_t ackedSequence = 0;
+        Connection* connection = nullptr;
+    };
+
+    struct Room {
+        uint32_t roomId = 0;
+        std::vector<uint32_t> players;
+        sanguosha::RoomStatus status = sanguosha::WAITING;
+        sanguosha::GameState state;
+    };
+
+    void onReadyRead(Connection* connection);
+    void onDisconnected(Connection* connection);
+    bool decodeFrame(const FrameView& frame, sanguosha::GameMessage* message) const;
+    void handleMessage(Connection* connection, const sanguosha::GameMessage& message);
+    void handleLogin(Connection* connection, const sanguosha::LoginRequest& request);
+    void handleRoomRequest(Connection* connection, const sanguosha::RoomRequest& request);
+    void handleRoomList(Connection* connection);
+    void handleGameAction(Connection* connection, const sanguosha::GameAction& action);
+    void handleStateRequest(Connection* connection);
+
+    void sendRoomResponse(Connection* connection, bool success, const std::string& error, const Room* room);
+    void removeFromRoom(User* user);
+    void startGame(Room* room);
+    void endGame(Room* room, uint32_t winnerId);
+    void playCard(Room* room, sanguosha::PlayerState* self, const sanguosha::GameAction& action);
+    void drawCards(sanguosha::PlayerState* player, int count);
+    void broadcastState(Room* room);
+    void sendState(User* user, const Room& room);
+
+    void send(Connection* connection, const sanguosha::GameMessage& message);
+    void writeFrame(Connection* connection, const sanguosha::GameMessage& message);
+
+    static sanguosha::PlayerState* findPlayer(sanguosha::GameState* state, uint32_t playerId);
+    void fillRoomInfo(const Room& room, sanguosha::RoomInfo* info) const;
+    User* userOf(Connection* connection);
+
+    MockServerConfig m_config;
+    QTcpServer* m_server;
+    QTimer* m_burstTimer;
+    std::vector<std::unique_ptr<Connection>> m_connections;
+    std::map<uint32_t, User> m_users;
+    std::map<uint32_t, Room> m_rooms;
+    std::mt19937 m_random;
+    uint32_t m_nextUserId;
+    uint32_t m_nextRoomId;
+    quint64 m_framesReceived;
+    quint64 m_framesSent;
+};
+
+#endif // MOCK_SERVER_H
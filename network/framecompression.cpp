@@ -0,0 +1,95 @@
+#include "framecompression.h"
+#include <cstring>
+
+namespace {
+// 大帧主要是重复度很高的房间列表和状态快照，低压缩级别已经能拿到大部分收益
+const int kCompressionLevel = 1;
+
+// 跨越环形缓冲区末尾的压缩帧需要先拼接成连续数据，每拼接一次计数一次
+MetricCounter& splitFrameCopies() {
+    static MetricCounter& copies = MetricsRegistry::instance().counter("net.split_frame_copies");
+    return copies;
+}
+}
+
+double CompressionCounters::ratio() const {
+    uint64_t raw = rawBytes->value();
+    if (raw == 0) {
+        return 1.0;
+    }
+    return static_cast<double>(wireBytes->value()) / static_cast<double>(raw);
+}
+
+FrameCompressionStats::FrameCompressionStats() {
+    MetricsRegistry& registry = MetricsRegistry::instance();
+    splitFrameCopies();
+    const char* suffixes[2] = { "_out.", "_in." };
+    for (int direction = Sent; direction <= Received; ++direction) {
+        for (int type = 0; type < sanguosha::MessageType_ARRAYSIZE; ++type) {
+            // 枚举值之间的空缺和 UNKNOWN 共用同一组计数器
+            std::string suffix = suffixes[direction] + sanguosha::MessageType_Name(
+                static_cast<sanguosha::MessageType>(indexOf(static_cast<sanguosha::MessageType>(type))));
+            CompressionCounters& counters = m_counters[direction][type];
+            counters.compressedFrames = &registry.counter("net.compressed_frames" + suffix);
+            counters.rawBytes = &registry.counter("net.raw_bytes" + suffix);
+            counters.wireBytes = &registry.counter("net.wire_bytes" + suffix);
+        }
+    }
+}
+
+void FrameCompressionStats::record(Direction direction, sanguosha::MessageType type,
+                                   size_t rawBytes, size_t wireBytes, bool compressed) {
+    const CompressionCounters& counters = m_counters[direction][indexOf(type)];
+    if (compressed) {
+        counters.compressedFrames->add();
+    }
+    counters.rawBytes->add(rawBytes);
+    counters.wireBytes->add(wireBytes);
+}
+
+const CompressionCounters& FrameCompressionStats::counters(Direction direction,
+                                                           sanguosha::MessageType type) const {
+    return m_counters[direction][indexOf(type)];
+}
+
+size_t FrameCompressionStats::indexOf(sanguosha::MessageType type) {
+    // 未知的类型值统一记在 UNKNOWN 下
+    if (!sanguosha::MessageType_IsValid(type)) {
+        return sanguosha::UNKNOWN;
+    }
+    return static_cast<size_t>(type);
+}
+
+bool compressFrameBody(const char* data, size_t size, QByteArray* compressed) {
+    // qCompress 的输出自带4字节原始长度，接收方据此预分配并校验
+    *compressed = qCompress(reinterpret_cast<const uchar*>(data), static_cast<int>(size), kCompressionLevel);
+    return !compressed->isEmpty() && static_cast<size_t>(compressed->size()) < size;
+}
+
+bool decompressFrameBody(const FrameView& frame, size_t maxSize, QByteArray* body) {
+    if (frame.size() < 4) {
+        return false;
+    }
+
+    // 解压需要连续的输入：帧在解码器缓冲区中连续时直接解压，跨越缓冲区末尾时才拼接一次
+    QByteArray packed;
+    const uchar* header = reinterpret_cast<const uchar*>(frame.first);
+    if (!frame.isContiguous()) {
+        packed.resize(static_cast<int>(frame.size()));
+        memcpy(packed.data(), frame.first, frame.firstSize);
+        memcpy(packed.data() + frame.firstSize, frame.second, frame.secondSize);
+        header = reinterpret_cast<const uchar*>(packed.constData());
+        splitFrameCopies().add();
+    }
+
+    size_t declaredSize = (static_cast<size_t>(header[0]) << 24)
+                        | (static_cast<size_t>(header[1]) << 16)
+                        | (static_cast<size_t>(header[2]) << 8)
+                        | static_cast<size_t>(header[3]);
+    if (declaredSize > maxSize) {
+        return false;
+    }
+
+    *body = qUncompress(header, static_cast<int>(frame.size()));
+    return static_cast<size_t>(body->size()) == declaredSize;
+}
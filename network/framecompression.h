@@ -0,0 +1,52 @@
+#ifndef FRAME_COMPRESSION_H
+#define FRAME_COMPRESSION_H
+
+#include <QByteArray>
+#include <cstddef>
+#include <cstdint>
+#include "framedecoder.h"
+#include "metrics.h"
+#include "sanguosha.pb.h"
+
+// 默认压缩阈值：序列化后不小于该字节数的消息才尝试压缩，小包压缩得不偿失
+const size_t kDefaultCompressThreshold = 512;
+
+// 单个消息类型在一个方向上的帧统计，帧数见 net.frames_in/out
+struct CompressionCounters {
+    MetricCounter* compressedFrames;  // 实际以压缩形式传输的帧数
+    MetricCounter* rawBytes;          // 未压缩的消息体字节数
+    MetricCounter* wireBytes;         // 实际传输的消息体字节数
+
+    // 传输字节数占原始字节数的比例，越小压缩效果越好
+    double ratio() const;
+};
+
+// 按消息类型统计的压缩效果，可在任意线程读取。计数器登记在 MetricsRegistry 中，
+// 名为 net.{compressed_frames,raw_bytes,wire_bytes}_{in,out}.<消息类型>，压缩比由 wire_bytes / raw_bytes 得出
+class FrameCompressionStats
+{
+public:
+    enum Direction {
+        Sent,
+        Received
+    };
+
+    FrameCompressionStats();
+
+    void record(Direction direction, sanguosha::MessageType type,
+                size_t rawBytes, size_t wireBytes, bool compressed);
+    const CompressionCounters& counters(Direction direction, sanguosha::MessageType type) const;
+
+private:
+    static size_t indexOf(sanguosha::MessageType type);
+
+    CompressionCounters m_counters[2][sanguosha::MessageType_ARRAYSIZE];
+};
+
+// 压缩消息体；压缩后不比原始数据小时返回 false，调用方应按原样发送
+bool compressFrameBody(const char* data, size_t size, QByteArray* compressed);
+
+// 解压一帧压缩过的消息体；声明的原始长度超过 maxSize 时拒绝解压
+bool decompressFrameBody(const FrameView& frame, size_t maxSize, QByteArray* body);
+
+#endif // FRAME_COMPRESSION_H
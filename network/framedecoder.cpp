@@ -0,0 +1,149 @@
+#include "framedecoder.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+size_t roundUpPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+}
+
+FrameDecoder::FrameDecoder(size_t initialCapacity, size_t maxFrameSize)
+    : m_storage(roundUpPowerOfTwo(std::max<size_t>(initialCapacity, 64))),
+      m_mask(m_storage.size() - 1),
+      m_readPos(0),
+      m_size(0),
+      m_maxFrameSize(maxFrameSize),
+      m_expectedBodySize(0),
+      m_headerRead(false),
+      m_compressed(false),
+      m_error(false) {
+}
+
+void FrameDecoder::append(const char* data, size_t size) {
+    while (size > 0) {
+        size_t available = 0;
+        char* dest = prepareWrite(1, &available);
+        size_t chunk = std::min(size, available);
+        memcpy(dest, data, chunk);
+        commitWrite(chunk);
+        data += chunk;
+        size -= chunk;
+    }
+}
+
+char* FrameDecoder::prepareWrite(size_t minSize, size_t* available) {
+    ensureWritable(minSize);
+    size_t writePos = (m_readPos + m_size) & m_mask;
+    *available = contiguousFreeAtTail();
+    return m_storage.data() + writePos;
+}
+
+void FrameDecoder::commitWrite(size_t size) {
+    m_size += size;
+}
+
+bool FrameDecoder::nextFrame(FrameView& frame) {
+    if (m_error) {
+        return false;
+    }
+
+    if (!m_headerRead) {
+        if (m_size < kHeaderSize) {
+            return false;
+        }
+        // 读取消息头（4字节长度，网络字节序），头部本身也可能跨越缓冲区末尾
+        uint32_t header = (static_cast<uint32_t>(byteAt(0)) << 24)
+                        | (static_cast<uint32_t>(byteAt(1)) << 16)
+                        | (static_cast<uint32_t>(byteAt(2)) << 8)
+                        | static_cast<uint32_t>(byteAt(3));
+        m_compressed = (header & kCompressedFlag) != 0;
+        m_expectedBodySize = header & ~kCompressedFlag;
+        m_readPos = (m_readPos + kHeaderSize) & m_mask;
+        m_size -= kHeaderSize;
+        m_headerRead = true;
+
+        if (m_expectedBodySize > m_maxFrameSize) {
+            m_error = true;
+            return false;
+        }
+    }
+
+    if (m_size < m_expectedBodySize) {
+        return false; // 数据不足，等待下次接收
+    }
+
+    size_t tail = m_storage.size() - m_readPos;
+    frame.compressed = m_compressed;
+    frame.first = m_storage.data() + m_readPos;
+    if (m_expectedBodySize <= tail) {
+        frame.firstSize = m_expectedBodySize;
+        frame.second = nullptr;
+        frame.secondSize = 0;
+    } else {
+        frame.firstSize = tail;
+        frame.second = m_storage.data();
+        frame.secondSize = m_expectedBodySize - tail;
+    }
+
+    // 只移动读游标，不搬移数据
+    m_readPos = (m_readPos + m_expectedBodySize) & m_mask;
+    m_size -= m_expectedBodySize;
+    m_expectedBodySize = 0;
+    m_headerRead = false;
+    m_compressed = false;
+    if (m_size == 0) {
+        m_readPos = 0; // 缓冲区已空，回到起点以获得最大的连续写空间
+    }
+    return true;
+}
+
+void FrameDecoder::reset() {
+    m_readPos = 0;
+    m_size = 0;
+    m_expectedBodySize = 0;
+    m_headerRead = false;
+    m_compressed = false;
+    m_error = false;
+}
+
+void FrameDecoder::ensureWritable(size_t size) {
+    if (contiguousFreeAtTail() >= size) {
+        return;
+    }
+    grow(m_size + size);
+}
+
+void FrameDecoder::grow(size_t required) {
+    size_t newCapacity = roundUpPowerOfTwo(std::max(required, m_storage.size() * 2));
+    std::vector<char> storage(newCapacity);
+
+    // 扩容时把未读数据线性化到新缓冲区起点
+    size_t tail = std::min(m_size, m_storage.size() - m_readPos);
+    memcpy(storage.data(), m_storage.data() + m_readPos, tail);
+    memcpy(storage.data() + tail, m_storage.data(), m_size - tail);
+
+    m_storage.swap(storage);
+    m_mask = newCapacity - 1;
+    m_readPos = 0;
+}
+
+uint8_t FrameDecoder::byteAt(size_t offset) const {
+    return static_cast<uint8_t>(m_storage[(m_readPos + offset) & m_mask]);
+}
+
+size_t FrameDecoder::contiguousFreeAtTail() const {
+    size_t writePos = (m_readPos + m_size) & m_mask;
+    if (m_size == m_storage.size()) {
+        return 0;
+    }
+    if (writePos >= m_readPos) {
+        // 写游标在读游标之后，可写到缓冲区末尾（wrap 后的空间下次再用）
+        return m_storage.size() - writePos;
+    }
+    return m_readPos - writePos;
+}
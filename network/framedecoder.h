@@ -0,0 +1,68 @@
+#ifndef FRAME_DECODER_H
+#define FRAME_DECODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 一帧完整消息体在环形缓冲区中的视图。
+// 消息体可能跨越缓冲区末尾，此时分成 first/second 两段；不跨越时 second 为空。
+struct FrameView {
+    const char* first = nullptr;
+    size_t firstSize = 0;
+    const char* second = nullptr;
+    size_t secondSize = 0;
+    bool compressed = false;   // 帧头带压缩标记，消息体为 qCompress 的输出
+
+    size_t size() const { return firstSize + secondSize; }
+    bool isContiguous() const { return secondSize == 0; }
+};
+
+// 长度前缀（4字节网络字节序）帧解码器。最高位是压缩标记，其余31位为消息体长度。
+// 内部使用可增长的环形缓冲区和读写游标，出帧时只移动读游标，不做前部擦除。
+class FrameDecoder
+{
+public:
+    static const size_t kHeaderSize = 4;
+    static const uint32_t kCompressedFlag = 0x80000000u;
+
+    explicit FrameDecoder(size_t initialCapacity = 64 * 1024,
+                          size_t maxFrameSize = 16 * 1024 * 1024);
+
+    // 追加收到的原始数据
+    void append(const char* data, size_t size);
+
+    // 直接写入接口：返回写游标处至少 minSize 字节的连续可写区域，写完后调用 commitWrite
+    char* prepareWrite(size_t minSize, size_t* available);
+    void commitWrite(size_t size);
+
+    // 取出下一帧完整消息体；数据不足或出错时返回 false。
+    // 返回的视图在下一次 append/prepareWrite/reset 之前有效。
+    bool nextFrame(FrameView& frame);
+
+    void reset();
+
+    // 帧长度超过上限时进入错误状态，调用方应断开连接
+    bool hasError() const { return m_error; }
+    size_t bufferedBytes() const { return m_size; }
+    size_t capacity() const { return m_storage.size(); }
+    size_t maxFrameSize() const { return m_maxFrameSize; }
+
+private:
+    void ensureWritable(size_t size);
+    void grow(size_t required);
+    uint8_t byteAt(size_t offset) const;
+    size_t contiguousFreeAtTail() const;
+
+    std::vector<char> m_storage;   // 容量始终为2的幂
+    size_t m_mask;
+    size_t m_readPos;              // 读游标（绝对下标已取模）
+    size_t m_size;                 // 未读字节数
+    size_t m_maxFrameSize;
+    size_t m_expectedBodySize;
+    bool m_headerRead;
+    bool m_compressed;
+    bool m_error;
+};
+
+#endif // FRAME_DECODER_H
@@ -0,0 +1,70 @@
+#include "gamestatecoalescer.h"
+
+namespace {
+void appendLogLine(std::string& log, const std::string& line) {
+    if (line.empty()) {
+        return;
+    }
+    if (!log.empty()) {
+        log += '\n';
+    }
+    log += line;
+}
+}
+
+GameStateCoalescer::GameStateCoalescer(QObject *parent)
+    : QObject(parent),
+      m_state(nullptr),
+      m_pendingUpdates(0),
+      m_flushTimer(new QTimer(this)),
+      m_frameIntervalMs(16),
+      m_superseded(&MetricsRegistry::instance().counter("dispatch.states_superseded")) {
+    m_flushTimer->setSingleShot(true);
+    connect(m_flushTimer, &QTimer::timeout, this, &GameStateCoalescer::flush);
+}
+
+void GameStateCoalescer::setFrameInterval(int intervalMs) {
+    m_frameIntervalMs = intervalMs;
+}
+
+void GameStateCoalescer::markDirty(const std::string& logLine) {
+    if (m_pendingUpdates > 0) {
+        m_superseded->add(); // 上一次更新不会单独渲染
+    }
+    ++m_pendingUpdates;
+    appendLogLine(m_pendingLog, logLine);
+
+    if (m_flushTimer->isActive()) {
+        return;
+    }
+
+    // 距上次输出已超过一帧时在下一轮事件循环输出，让同一批到达的更新先合并
+    int delay = 0;
+    if (m_sinceLastFlush.isValid()) {
+        qint64 elapsed = m_sinceLastFlush.elapsed();
+        if (elapsed < m_frameIntervalMs) {
+            delay = static_cast<int>(m_frameIntervalMs - elapsed);
+        }
+    }
+    m_flushTimer->start(delay);
+}
+
+void GameStateCoalescer::flush() {
+    m_flushTimer->stop();
+    if (m_pendingUpdates == 0 || !m_state) {
+        return;
+    }
+
+    m_state->mutable_game_log()->swap(m_pendingLog);
+    m_pendingLog.clear();
+    m_pendingUpdates = 0;
+
+    m_sinceLastFlush.start();
+    emit gameStateReady(*m_state);
+}
+
+void GameStateCoalescer::clear() {
+    m_flushTimer->stop();
+    m_pendingLog.clear();
+    m_pendingUpdates = 0;
+}
@@ -0,0 +1,45 @@
+#ifndef GAME_STATE_COALESCER_H
+#define GAME_STATE_COALESCER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <string>
+#include "metrics.h"
+#include "sanguosha.pb.h"
+
+// GAME_STATE 合并器：状态在一帧内多次变化时只输出最新的一份，每个显示刷新周期最多输出一次。
+// 状态本身由重建器持有，这里只记录"有更新"以及每次更新附带的 game_log，
+// 输出时把期间的全部日志按顺序拼接到输出状态的 game_log 中，不会丢失。
+class GameStateCoalescer : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit GameStateCoalescer(QObject *parent = nullptr);
+
+    // 输出间隔（毫秒），默认约等于60Hz的一帧
+    void setFrameInterval(int intervalMs);
+    // 输出时使用的状态对象
+    void setState(sanguosha::GameState* state) { m_state = state; }
+
+    // 状态已更新，logLine 为本次更新附带的日志
+    void markDirty(const std::string& logLine);
+    // 立即输出挂起的状态；其他类型的消息分发前需要先调用，保证顺序
+    void flush();
+    void clear();
+
+signals:
+    void gameStateReady(const sanguosha::GameState& state);
+
+private:
+    sanguosha::GameState* m_state;
+    std::string m_pendingLog;
+    int m_pendingUpdates;
+    QTimer* m_flushTimer;
+    QElapsedTimer m_sinceLastFlush;
+    int m_frameIntervalMs;
+    MetricCounter* m_superseded;   // 被后续更新覆盖、没有单独渲染的状态数
+};
+
+#endif // GAME_STATE_COALESCER_H
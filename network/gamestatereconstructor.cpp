@@ -0,0 +1,96 @@
+#include "gamestatereconstructor.h"
+
+GameStateReconstructor::GameStateReconstructor()
+    : m_state(&m_ownedState),
+      m_hasSnapshot(false),
+      m_awaitingSnapshot(false),
+      m_deltasApplied(&MetricsRegistry::instance().counter("net.deltas_applied")),
+      m_gapsDetected(&MetricsRegistry::instance().counter("net.delta_gaps")) {
+}
+
+void GameStateReconstructor::applySnapshot(sanguosha::GameState* snapshot) {
+    if (snapshot->GetArena() == nullptr) {
+        m_ownedState.Swap(snapshot);
+        m_state = &m_ownedState;
+    } else {
+        // 入站快照在批次 arena 上，直接引用，之后的增量原地应用在这份快照上
+        m_state = snapshot;
+    }
+    m_hasSnapshot = true;
+    m_awaitingSnapshot = false;
+}
+
+GameStateReconstructor::Result GameStateReconstructor::applyDelta(const sanguosha::GameStateDelta& delta) {
+    if (!m_hasSnapshot || delta.base_version() != m_state->version()) {
+        if (m_hasSnapshot && delta.version() <= m_state->version()) {
+            return Result::Stale;
+        }
+        // 丢失了中间的增量，之后的增量在收到完整快照前都无法应用
+        if (!m_awaitingSnapshot) {
+            m_gapsDetected->add();
+        }
+        m_awaitingSnapshot = true;
+        return Result::Gap;
+    }
+
+    if (delta.has_current_player()) {
+        m_state->set_current_player(delta.current_player());
+    }
+    if (delta.has_phase()) {
+        m_state->set_phase(delta.phase());
+    }
+
+    for (const sanguosha::PlayerStateDelta& playerDelta : delta.players()) {
+        sanguosha::PlayerState* player = findOrAddPlayer(playerDelta.player_id());
+        if (playerDelta.has_username()) {
+            player->set_username(playerDelta.username());
+        }
+        if (playerDelta.has_hp()) {
+            player->set_hp(playerDelta.hp());
+        }
+        if (playerDelta.has_max_hp()) {
+            player->set_max_hp(playerDelta.max_hp());
+        }
+        if (playerDelta.hand_cards_changed()) {
+            *player->mutable_hand_cards() = playerDelta.hand_cards();
+        }
+    }
+
+    for (uint32_t playerId : delta.removed_players()) {
+        removePlayer(playerId);
+    }
+
+    // 日志只属于本次更新，不在快照中累积
+    m_state->set_game_log(delta.game_log());
+    m_state->set_version(delta.version());
+    m_state->set_acked_sequence(delta.acked_sequence());
+    m_deltasApplied->add();
+    return Result::Applied;
+}
+
+void GameStateReconstructor::reset() {
+    m_ownedState.Clear();
+    m_state = &m_ownedState;
+    m_hasSnapshot = false;
+    m_awaitingSnapshot = false;
+}
+
+sanguosha::PlayerState* GameStateReconstructor::findOrAddPlayer(uint32_t playerId) {
+    for (int i = 0; i < m_state->players_size(); ++i) {
+        if (m_state->players(i).player_id() == playerId) {
+            return m_state->mutable_players(i);
+        }
+    }
+    sanguosha::PlayerState* player = m_state->add_players();
+    player->set_player_id(playerId);
+    return player;
+}
+
+void GameStateReconstructor::removePlayer(uint32_t playerId) {
+    for (int i = 0; i < m_state->players_size(); ++i) {
+        if (m_state->players(i).player_id() == playerId) {
+            m_state->mutable_players()->DeleteSubrange(i, 1);
+            return;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef GAME_STATE_RECONSTRUCTOR_H
+#define GAME_STATE_RECONSTRUCTOR_H
+
+#include <cstdint>
+#include "metrics.h"
+#include "sanguosha.pb.h"
+
+// 增量游戏状态重建器：保存最近一份完整快照，并把 GAME_STATE_DELTA 原地应用上去。
+// 增量的基准版本与当前版本不一致时报告版本缺口，由调用方请求完整快照。
+// 应用的增量数和缺口数计入指标 net.deltas_applied / net.delta_gaps。
+class GameStateReconstructor
+{
+public:
+    enum class Result {
+        Applied,   // 已应用
+        Gap,       // 版本不连续，需要完整快照
+        Stale      // 过期或重复的增量，已忽略
+    };
+
+    GameStateReconstructor();
+    GameStateReconstructor(const GameStateReconstructor&) = delete;
+    GameStateReconstructor& operator=(const GameStateReconstructor&) = delete;
+
+    // 接管一份完整快照，不做深拷贝：堆上的快照与自有状态交换内容；
+    // arena 上的快照直接引用，调用方保证它在下一次 applySnapshot 或 reset 之前一直有效。
+    // 两种情况下 mutableState() 返回的指针都可能改变。
+    void applySnapshot(sanguosha::GameState* snapshot);
+    Result applyDelta(const sanguosha::GameStateDelta& delta);
+    void reset();
+
+    const sanguosha::GameState& state() const { return *m_state; }
+    sanguosha::GameState* mutableState() { return m_state; }
+    // 当前状态是否引用调用方 arena 上的快照
+    bool referencesSnapshot() const { return m_state != &m_ownedState; }
+
+    bool hasSnapshot() const { return m_hasSnapshot; }
+    uint64_t version() const { return m_state->version(); }
+
+private:
+    sanguosha::PlayerState* findOrAddPlayer(uint32_t playerId);
+    void removePlayer(uint32_t playerId);
+
+    sanguosha::GameState m_ownedState;
+    sanguosha::GameState* m_state;     // 指向 m_ownedState 或调用方 arena 上的快照
+    bool m_hasSnapshot;
+    bool m_awaitingSnapshot;
+    MetricCounter* m_deltasApplied;
+    MetricCounter* m_gapsDetected;
+};
+
+#endif // GAME_STATE_RECONSTRUCTOR_H
@@ -0,0 +1,70 @@
+#include "heartbeatscheduler.h"
+
+HeartbeatScheduler::HeartbeatScheduler(const HeartbeatConfig& config)
+    : m_config(config),
+      m_gameActive(false),
+      m_awaitingEcho(false),
+      m_missedEchoes(0),
+      m_lastSentMs(0),
+      m_lastReceivedMs(0),
+      m_lastHeartbeatMs(0),
+      m_suppressed(0) {
+}
+
+void HeartbeatScheduler::reset(int64_t nowMs) {
+    m_awaitingEcho = false;
+    m_missedEchoes = 0;
+    m_lastSentMs = nowMs;
+    m_lastReceivedMs = nowMs;
+    m_lastHeartbeatMs = nowMs;
+}
+
+void HeartbeatScheduler::onFrameSent(int64_t nowMs) {
+    m_lastSentMs = nowMs;
+}
+
+void HeartbeatScheduler::onFrameReceived(int64_t nowMs) {
+    // 收到任何数据都说明连接仍然存活
+    m_lastReceivedMs = nowMs;
+    m_awaitingEcho = false;
+    m_missedEchoes = 0;
+}
+
+void HeartbeatScheduler::onHeartbeatSent(int64_t nowMs) {
+    m_lastHeartbeatMs = nowMs;
+    m_lastSentMs = nowMs;
+    m_awaitingEcho = true;
+}
+
+HeartbeatScheduler::Action HeartbeatScheduler::poll(int64_t nowMs) {
+    if (m_awaitingEcho) {
+        if (nowMs - m_lastHeartbeatMs < m_config.echoTimeoutMs) {
+            return Action::None;
+        }
+        // 回显超时，连续超时达到上限判定断线，否则立即再探测一次
+        m_awaitingEcho = false;
+        if (++m_missedEchoes >= m_config.maxMissedEchoes) {
+            return Action::LinkDead;
+        }
+        return Action::SendHeartbeat;
+    }
+
+    const int interval = currentIntervalMs();
+    if (nowMs - m_lastReceivedMs >= interval) {
+        return Action::SendHeartbeat; // 太久没收到数据，需要探测
+    }
+    if (nowMs - m_lastSentMs >= interval) {
+        return Action::SendHeartbeat; // 太久没发数据，需要保活
+    }
+
+    // 双向都有近期流量，本次心跳省略
+    if (nowMs - m_lastHeartbeatMs >= interval) {
+        ++m_suppressed;
+        m_lastHeartbeatMs = nowMs;
+    }
+    return Action::None;
+}
+
+int HeartbeatScheduler::currentIntervalMs() const {
+    return m_gameActive ? m_config.activeIntervalMs : m_config.idleIntervalMs;
+}
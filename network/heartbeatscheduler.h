@@ -0,0 +1,57 @@
+#ifndef HEARTBEAT_SCHEDULER_H
+#define HEARTBEAT_SCHEDULER_H
+
+#include <cstdint>
+
+// 心跳参数（毫秒）
+struct HeartbeatConfig {
+    int idleIntervalMs = 25000;     // 大厅等空闲时的心跳间隔
+    int activeIntervalMs = 5000;    // 对局进行中的心跳间隔
+    int echoTimeoutMs = 5000;       // 等待心跳回显的时限
+    int maxMissedEchoes = 3;        // 连续丢失多少次回显判定连接已断
+};
+
+// 随流量自适应的心跳调度策略，不依赖Qt，时间由调用方传入。
+// 最近发过其他帧时不再发送保活心跳；长时间没有收到任何数据时发送探测心跳，
+// 探测连续超时达到上限后判定连接已断。
+class HeartbeatScheduler
+{
+public:
+    enum class Action {
+        None,
+        SendHeartbeat,
+        LinkDead
+    };
+
+    explicit HeartbeatScheduler(const HeartbeatConfig& config = HeartbeatConfig());
+
+    void setConfig(const HeartbeatConfig& config) { m_config = config; }
+    const HeartbeatConfig& config() const { return m_config; }
+
+    void setGameActive(bool active) { m_gameActive = active; }
+    bool isGameActive() const { return m_gameActive; }
+
+    void reset(int64_t nowMs);
+    void onFrameSent(int64_t nowMs);
+    void onFrameReceived(int64_t nowMs);
+    void onHeartbeatSent(int64_t nowMs);
+
+    // 定期调用，返回此刻需要执行的动作
+    Action poll(int64_t nowMs);
+
+    int currentIntervalMs() const;
+    int missedEchoes() const { return m_missedEchoes; }
+    uint64_t suppressedHeartbeats() const { return m_suppressed; }
+
+private:
+    HeartbeatConfig m_config;
+    bool m_gameActive;
+    bool m_awaitingEcho;
+    int m_missedEchoes;
+    int64_t m_lastSentMs;
+    int64_t m_lastReceivedMs;
+    int64_t m_lastHeartbeatMs;
+    uint64_t m_suppressed;
+};
+
+#endif // HEARTBEAT_SCHEDULER_H
@@ -0,0 +1,58 @@
+#include "latencystats.h"
+#include <algorithm>
+#include <cmath>
+
+LatencyStats::LatencyStats(size_t windowSize)
+    : m_samples(std::max<size_t>(windowSize, 1)),
+      m_next(0),
+      m_count(0),
+      m_total(0),
+      m_last(0.0) {
+}
+
+void LatencyStats::addSample(double ms) {
+    m_samples[m_next] = ms;
+    m_next = (m_next + 1) % m_samples.size();
+    if (m_count < m_samples.size()) {
+        ++m_count;
+    }
+    ++m_total;
+    m_last = ms;
+}
+
+void LatencyStats::reset() {
+    m_next = 0;
+    m_count = 0;
+    m_total = 0;
+    m_last = 0.0;
+}
+
+LatencySummary LatencyStats::summary() const {
+    LatencySummary result;
+    result.sampleCount = m_total;
+    if (m_count == 0) {
+        return result;
+    }
+
+    // 窗口很小，查询时排序一份拷贝即可
+    std::vector<double> sorted(m_samples.begin(), m_samples.begin() + static_cast<std::ptrdiff_t>(m_count));
+    std::sort(sorted.begin(), sorted.end());
+
+    double sum = 0.0;
+    for (double sample : sorted) {
+        sum += sample;
+    }
+
+    // 最近秩法计算分位数
+    auto percentile = [&sorted](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+        return sorted[rank == 0 ? 0 : rank - 1];
+    };
+
+    result.minMs = sorted.front();
+    result.avgMs = sum / sorted.size();
+    result.p50Ms = percentile(0.50);
+    result.p99Ms = percentile(0.99);
+    result.lastMs = m_last;
+    return result;
+}
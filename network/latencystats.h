@@ -0,0 +1,38 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 延迟统计摘要，单位毫秒
+struct LatencySummary {
+    uint64_t sampleCount = 0;   // 累计样本数
+    double minMs = 0.0;
+    double avgMs = 0.0;
+    double p50Ms = 0.0;
+    double p99Ms = 0.0;
+    double lastMs = 0.0;
+};
+
+// 滚动窗口延迟统计：保留最近 windowSize 个样本，查询时计算 min/avg/p50/p99
+class LatencyStats
+{
+public:
+    explicit LatencyStats(size_t windowSize = 256);
+
+    void addSample(double ms);
+    void reset();
+
+    LatencySummary summary() const;
+    bool isEmpty() const { return m_count == 0; }
+
+private:
+    std::vector<double> m_samples;   // 环形窗口
+    size_t m_next;
+    size_t m_count;                  // 窗口内的有效样本数
+    uint64_t m_total;
+    double m_last;
+};
+
+#endif // LATENCY_STATS_H
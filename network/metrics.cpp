@@ -0,0 +1,131 @@
+#include "metrics.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+MetricHistogram::MetricHistogram(std::vector<double> bounds)
+    : m_bounds(std::move(bounds)),
+      m_buckets(new std::atomic<uint64_t>[m_bounds.size() + 1]) {
+    std::sort(m_bounds.begin(), m_bounds.end());
+    for (size_t i = 0; i <= m_bounds.size(); ++i) {
+        m_buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+void MetricHistogram::record(double value) {
+    size_t index = static_cast<size_t>(std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin());
+    m_buckets[index].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    double sum = m_sum.load(std::memory_order_relaxed);
+    while (!m_sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+    }
+}
+
+std::vector<double> MetricHistogram::exponentialBounds(double start, double factor, int count) {
+    std::vector<double> bounds;
+    bounds.reserve(static_cast<size_t>(count));
+    double bound = start;
+    for (int i = 0; i < count; ++i) {
+        bounds.push_back(bound);
+        bound *= factor;
+    }
+    return bounds;
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricCounter& MetricsRegistry::counter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<MetricCounter>& metric = m_counters[name];
+    if (!metric) {
+        metric.reset(new MetricCounter);
+    }
+    return *metric;
+}
+
+MetricGauge& MetricsRegistry::gauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<MetricGauge>& metric = m_gauges[name];
+    if (!metric) {
+        metric.reset(new MetricGauge);
+    }
+    return *metric;
+}
+
+MetricHistogram& MetricsRegistry::histogram(const std::string& name, const std::vector<double>& bounds) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<MetricHistogram>& metric = m_histograms[name];
+    if (!metric) {
+        metric.reset(new MetricHistogram(bounds));
+    }
+    return *metric;
+}
+
+MetricHistogram& MetricsRegistry::timingHistogram(const std::string& name) {
+    return histogram(name, MetricHistogram::exponentialBounds(1.0, 2.0, 21));
+}
+
+std::string MetricsRegistry::toJson() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    char number[64];
+    long long nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::snprintf(number, sizeof(number), "%lld", nowMs);
+    std::string json = "{\n  \"timestamp_ms\": ";
+    json += number;
+
+    json += ",\n  \"counters\": {";
+    const char* separator = "\n";
+    for (const auto& entry : m_counters) {
+        std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(entry.second->value()));
+        json += separator;
+        json += "    \"" + entry.first + "\": " + number;
+        separator = ",\n";
+    }
+    json += "\n  },\n  \"gauges\": {";
+    separator = "\n";
+    for (const auto& entry : m_gauges) {
+        std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(entry.second->value()));
+        json += separator;
+        json += "    \"" + entry.first + "\": " + number;
+        separator = ",\n";
+    }
+    json += "\n  },\n  \"histograms\": {";
+    separator = "\n";
+    for (const auto& entry : m_histograms) {
+        const MetricHistogram& histogram = *entry.second;
+        json += separator;
+        std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(histogram.count()));
+        json += "    \"" + entry.first + "\": {\"count\": " + number;
+        std::snprintf(number, sizeof(number), "%.3f", histogram.sum());
+        json += ", \"sum\": ";
+        json += number;
+        json += ", \"buckets\": [";
+        // 只输出非空桶，"le" 为桶的上界，溢出桶为 "+Inf"
+        const char* bucketSeparator = "";
+        for (size_t i = 0; i <= histogram.bounds().size(); ++i) {
+            uint64_t value = histogram.bucketCount(i);
+            if (value == 0) {
+                continue;
+            }
+            if (i < histogram.bounds().size()) {
+                std::snprintf(number, sizeof(number), "{\"le\": %g, \"count\": %llu}",
+                              histogram.bounds()[i], static_cast<unsigned long long>(value));
+            } else {
+                std::snprintf(number, sizeof(number), "{\"le\": \"+Inf\", \"count\": %llu}",
+                              static_cast<unsigned long long>(value));
+            }
+            json += bucketSeparator;
+            json += number;
+            bucketSeparator = ", ";
+        }
+        json += "]}";
+        separator = ",\n";
+    }
+    json += "\n  }\n}\n";
+    return json;
+}
@@ -0,0 +1,101 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 客户端指标，不依赖Qt。
+// 注册时按名称查找一次并保存引用，之后的更新只是原子操作，可以在任意线程调用。
+
+class MetricCounter
+{
+public:
+    void add(uint64_t value = 1) { m_value.fetch_add(value, std::memory_order_relaxed); }
+    uint64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_value{0};
+};
+
+class MetricGauge
+{
+public:
+    void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { m_value.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+// 固定分桶直方图：bounds 为各桶的上界（升序），超过最后一个上界的样本计入溢出桶
+class MetricHistogram
+{
+public:
+    explicit MetricHistogram(std::vector<double> bounds);
+
+    void record(double value);
+
+    const std::vector<double>& bounds() const { return m_bounds; }
+    // 下标 bounds().size() 为溢出桶
+    uint64_t bucketCount(size_t index) const { return m_buckets[index].load(std::memory_order_relaxed); }
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    double sum() const { return m_sum.load(std::memory_order_relaxed); }
+
+    // start, start*factor, ... 共 count 个上界
+    static std::vector<double> exponentialBounds(double start, double factor, int count);
+
+private:
+    std::vector<double> m_bounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_buckets;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<double> m_sum{0.0};
+};
+
+// 作用域计时：析构时把经过的微秒数记入直方图
+class MetricTimer
+{
+public:
+    explicit MetricTimer(MetricHistogram* histogram)
+        : m_histogram(histogram), m_start(std::chrono::steady_clock::now()) {}
+    ~MetricTimer() {
+        std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - m_start;
+        m_histogram->record(elapsed.count());
+    }
+
+private:
+    MetricHistogram* m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+class MetricsRegistry
+{
+public:
+    static MetricsRegistry& instance();
+
+    // 同名指标只创建一次，返回的引用在进程内一直有效
+    MetricCounter& counter(const std::string& name);
+    MetricGauge& gauge(const std::string& name);
+    // 直方图第一次注册时使用 bounds，之后忽略
+    MetricHistogram& histogram(const std::string& name, const std::vector<double>& bounds);
+    // 以微秒计的耗时直方图，1us 到约 1s
+    MetricHistogram& timingHistogram(const std::string& name);
+
+    std::string toJson() const;
+
+private:
+    MetricsRegistry() = default;
+
+    mutable std::mutex m_mutex;   // 只保护注册表本身，指标更新不加锁
+    std::map<std::string, std::unique_ptr<MetricCounter>> m_counters;
+    std::map<std::string, std::unique_ptr<MetricGauge>> m_gauges;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> m_histograms;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,25 @@
+#include "metricsreporter.h"
+#include <QDebug>
+#include <QSaveFile>
+#include "metrics.h"
+
+MetricsReporter::MetricsReporter(const QString& path, int intervalMs, QObject *parent)
+    : QObject(parent),
+      m_path(path),
+      m_timer(new QTimer(this)) {
+    connect(m_timer, &QTimer::timeout, this, &MetricsReporter::writeNow);
+    if (intervalMs > 0) {
+        m_timer->start(intervalMs);
+    }
+}
+
+bool MetricsReporter::writeNow() {
+    std::string json = MetricsRegistry::instance().toJson();
+    QSaveFile file(m_path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Cannot write metrics to" << m_path;
+        return false;
+    }
+    file.write(json.data(), static_cast<qint64>(json.size()));
+    return file.commit();
+}
@@ -0,0 +1,25 @@
+#ifndef METRICS_REPORTER_H
+#define METRICS_REPORTER_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+// 定期把指标注册表写成JSON文件；每次整体替换文件，读取方不会看到写了一半的内容
+class MetricsReporter : public QObject
+{
+    Q_OBJECT
+
+public:
+    // intervalMs 不大于0时只在调用 writeNow 时写出
+    MetricsReporter(const QString& path, int intervalMs, QObject *parent = nullptr);
+
+public slots:
+    bool writeNow();
+
+private:
+    QString m_path;
+    QTimer* m_timer;
+};
+
+#endif // METRICS_REPORTER_H
@@ -1,124 +1,270 @@
 #include "networkmanager.h"
 #include <QHostAddress>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <stdexcept>
-#include <arpa/inet.h>
-#include <cstring>  // 添加这行
+
+bool NetworkManager::s_ioThreadEnabled = false;
 
 NetworkManager& NetworkManager::instance() {
     static NetworkManager instance;
     return instance;
 }
 
+void NetworkManager::setIoThreadEnabled(bool enabled) {
+    s_ioThreadEnabled = enabled;
+}
+
 NetworkManager::NetworkManager(QObject *parent) 
     : QObject(parent), 
-      m_socket(new QTcpSocket(this)),
-      m_heartbeatTimer(new QTimer(this)),
-      m_expectedBodySize(0),
-      m_headerRead(false) {
+      m_ioThread(nullptr),
+      m_worker(nullptr),
+      m_stateCoalescer(new GameStateCoalescer(this)),
+      m_snapshotRequested(false),
+      m_compressionEnabled(true),
+      m_serverCapabilities(0),
+      m_messagesDispatched(&MetricsRegistry::instance().counter("dispatch.messages_dispatched")),
+      m_messageCopies(&MetricsRegistry::instance().counter("dispatch.message_copies")),
+      m_sessionState(SessionState::Disconnected),
+      m_reconnectTimer(new QTimer(this)),
+      m_autoReconnect(false),
+      m_port(0),
+      m_roomId(0),
+      m_gameActive(false),
+      m_rejoinPending(false),
+      m_replaying(false),
+      m_dispatchCursor(0),
+      m_batchCursor(0),
+      m_dispatchDepth(0),
+      m_snapshotSource(nullptr) {
     
-    connect(m_socket, &QTcpSocket::connected, this, &NetworkManager::onConnected);
-    connect(m_socket, &QTcpSocket::readyRead, this, &NetworkManager::onReadyRead);
-    connect(m_socket, &QTcpSocket::disconnected, this, &NetworkManager::disconnected);
-    connect(m_socket, SIGNAL(error(QAbstractSocket::SocketError)),
-        this, SLOT(onErrorOccurred(QAbstractSocket::SocketError)));
+    m_reconnectTimer->setSingleShot(true);
+    connect(m_reconnectTimer, &QTimer::timeout, this, &NetworkManager::onReconnectTimeout);
+    m_stateCoalescer->setState(m_stateReconstructor.mutableState());
+    
+    if (s_ioThreadEnabled) {
+        // 套接字读写、分帧和解析都放到独立线程，UI线程只负责分发
+        m_ioThread = new QThread(this);
+        m_ioThread->setObjectName("NetworkIO");
+        connect(m_ioThread, &QThread::started, []() {
+            Tracer::instance().setThreadName("NetworkIO");
+        });
+        m_worker = new NetworkWorker;
+        m_worker->moveToThread(m_ioThread);
+        m_ioThread->start();
+    } else {
+        m_worker = new NetworkWorker(this);
+    }
     
-    connect(m_heartbeatTimer, &QTimer::timeout, this, &NetworkManager::sendHeartbeat);
-    m_heartbeatTimer->setInterval(25000); // 25秒发送一次心跳
+    connect(m_worker, &NetworkWorker::connected, this, &NetworkManager::onWorkerConnected);
+    connect(m_worker, &NetworkWorker::disconnected, this, &NetworkManager::onWorkerDisconnected);
+    connect(m_worker, &NetworkWorker::errorOccurred, this, &NetworkManager::onWorkerError);
+    connect(m_worker, &NetworkWorker::connectionLost, this, &NetworkManager::connectionLost);
+    // 始终排队到下一次事件循环再统一取出，保证每轮事件循环最多分发一次
+    connect(m_worker, &NetworkWorker::messagesReady,
+            this, &NetworkManager::dispatchPendingMessages, Qt::QueuedConnection);
+    connect(m_stateCoalescer, &GameStateCoalescer::gameStateReady,
+            this, &NetworkManager::gameStateReceived);
+    connect(m_worker, &NetworkWorker::rttSampled, this, &NetworkManager::onRttSampled);
+    connect(m_worker, &NetworkWorker::replayFinished, this,
+            [this](quint64 frames, quint64 bytes, qint64 elapsedMs) {
+        m_replaying = false;
+        emit replayFinished(frames, bytes, elapsedMs);
+    });
 }
 
 NetworkManager::~NetworkManager() {
-    m_heartbeatTimer->stop();
-    if (m_socket->state() == QAbstractSocket::ConnectedState) {
-        m_socket->disconnectFromHost();
+    m_autoReconnect = false;
+    m_reconnectTimer->stop();
+    if (m_ioThread) {
+        QMetaObject::invokeMethod(m_worker, "shutdown", Qt::BlockingQueuedConnection);
+        m_ioThread->quit();
+        m_ioThread->wait();
+        delete m_worker;
+    } else {
+        m_worker->shutdown();
     }
 }
 
 void NetworkManager::connectToServer(const QString& host, quint16 port) {
-    m_socket->connectToHost(host, port);
+    m_host = host;
+    m_port = port;
+    m_autoReconnect = true;
+    m_reconnectTimer->stop();
+    setSessionState(SessionState::Connecting);
+    QMetaObject::invokeMethod(m_worker, "connectToServer", Qt::AutoConnection,
+                              Q_ARG(QString, host), Q_ARG(quint16, port));
 }
 
-bool NetworkManager::isConnected() const {
-    return m_socket->state() == QAbstractSocket::ConnectedState;
+void NetworkManager::disconnectFromServer() {
+    m_autoReconnect = false;
+    m_reconnectTimer->stop();
+    abandonSession();
+    m_reconnectPolicy.reset();
+    setSessionState(SessionState::Disconnected);
+    QMetaObject::invokeMethod(m_worker, "shutdown", Qt::AutoConnection);
 }
 
-void NetworkManager::onConnected() {
-    m_heartbeatTimer->start();
-    m_buffer.clear();
-    m_expectedBodySize = 0;
-    m_headerRead = false;
-    emit connected();
+void NetworkManager::setRecordingPath(const QString& path) {
+    QMetaObject::invokeMethod(m_worker, "setRecordingPath", Qt::AutoConnection, Q_ARG(QString, path));
+}
+
+void NetworkManager::startReplay(const QString& path, double speed) {
+    m_replaying = true;
+    QMetaObject::invokeMethod(m_worker, "startReplay", Qt::AutoConnection,
+                              Q_ARG(QString, path), Q_ARG(double, speed));
 }
 
-void NetworkManager::onReadyRead() {
-    QByteArray data = m_socket->readAll();
-    qDebug() << "Received" << data.size() << "bytes from server";
-    m_buffer.insert(m_buffer.end(), data.begin(), data.end());
+bool NetworkManager::isConnected() const {
+    return m_worker->isConnected();
+}
+
+void NetworkManager::dispatchPendingMessages() {
+    static MetricHistogram& drainSize = MetricsRegistry::instance().histogram(
+        "dispatch.drain_messages", MetricHistogram::exponentialBounds(1.0, 2.0, 12));
+    TRACE_SPAN("dispatch", "dispatchPendingMessages");
+    m_worker->beginDrain();
     
-    while (!m_buffer.empty()) {
-        if (!m_headerRead && m_buffer.size() >= 4) {
-            // 读取消息头（4字节长度）
-            uint32_t net_size;
-            memcpy(&net_size, m_buffer.data(), 4);
-            m_expectedBodySize = ntohl(net_size);
-            m_headerRead = true;
-            
-            // 移除已处理的头数据
-            m_buffer.erase(m_buffer.begin(), m_buffer.begin() + 4);
+    // 槽函数收到的是对批内消息的常量引用。槽函数里嵌套的事件循环（如模态对话框）会再次进入这里，
+    // 嵌套调用从共享的游标处接着分发，消息始终按到达顺序处理；
+    // 分发完的批次等最外层调用返回时才交还网络线程，外层仍在处理的消息不会被释放
+    ++m_dispatchDepth;
+    int drained = 0;
+    for (;;) {
+        if (!m_dispatching) {
+            if (!m_worker->takeBatch(m_dispatching)) {
+                break;
+            }
+            m_dispatchCursor = 0;
+            m_batchCursor = 0;
+        }
+        if (m_dispatchCursor == m_dispatching->messages.size()) {
+            m_finishedBatches.push_back(std::move(m_dispatching));
             continue;
         }
-        
-        if (m_headerRead && m_buffer.size() >= m_expectedBodySize) {
-            // 读取完整的消息体
-            std::vector<char> messageData(m_buffer.begin(), m_buffer.begin() + m_expectedBodySize);
-            parseMessage(messageData);
-            
-            // 移除已处理的消息体数据
-            m_buffer.erase(m_buffer.begin(), m_buffer.begin() + m_expectedBodySize);
-            m_headerRead = false;
-            m_expectedBodySize = 0;
+
+        sanguosha::GameMessage* message = m_dispatching->messages[m_dispatchCursor];
+        if (m_batchCursor == 0) {
+            ++drained;
+            if (Tracer::enabled()) {
+                uint64_t flow = m_dispatching->firstSequence + m_dispatchCursor;
+                Tracer::instance().addFlow(Tracer::FlowPhase::Step, flow);
+                Tracer::setCurrentFlow(flow);
+            }
+        }
+
+        // 游标在分发之前前移，嵌套调用不会重复分发同一条消息
+        if (message->type() == sanguosha::MESSAGE_BATCH) {
+            // 批内的消息是服务器一次性产生的同一个更新：按顺序分发，游戏状态只在批末渲染一次，
+            // 不会出现动作已显示而状态还是旧的中间画面
+            sanguosha::MessageBatch* batch = message->mutable_batch();
+            if (m_batchCursor < batch->messages_size()) {
+                dispatchBatchedMessage(batch->mutable_messages(m_batchCursor++));
+                continue;
+            }
+            ++m_dispatchCursor;
+            m_batchCursor = 0;
+            m_stateCoalescer->flush();
             continue;
         }
-        
-        break; // 数据不足，等待下次接收
+
+        ++m_dispatchCursor;
+        m_messagesDispatched->add();
+        if (applyStateMessage(message)) {
+            continue;
+        }
+        // 其他消息必须排在之前的游戏状态之后处理
+        m_stateCoalescer->flush();
+        dispatchMessage(*message);
+    }
+
+    if (--m_dispatchDepth == 0) {
+        // 交还网络线程，整批消息随 arena 重置一次性释放；
+        // 重建器仍在引用其中快照的批次留下，换出之前保留的那一批
+        for (std::unique_ptr<InboundBatch>& batch : m_finishedBatches) {
+            if (batch.get() == m_snapshotSource) {
+                m_snapshotBatch.swap(batch);
+            }
+            if (batch) {
+                m_worker->recycleBatch(std::move(batch));
+            }
+        }
+        m_finishedBatches.clear();
+        if (m_snapshotBatch && m_snapshotBatch.get() != m_snapshotSource) {
+            m_worker->recycleBatch(std::move(m_snapshotBatch));
+        }
+    }
+    // 每轮分发取出的消息数反映UI线程落后网络线程的程度
+    if (drained > 0) {
+        drainSize.record(drained);
     }
 }
 
-// networkmanager.cpp - 确保消息处理在UI线程
-void NetworkManager::parseMessage(const std::vector<char>& buffer) {
-    sanguosha::GameMessage message;
-    if (!message.ParseFromArray(buffer.data(), buffer.size())) {
-        qWarning() << "Failed to parse message from server";
+void NetworkManager::dispatchBatchedMessage(sanguosha::GameMessage* message) {
+    m_messagesDispatched->add();
+    if (applyStateMessage(message)) {
         return;
     }
-    
-    // 确保在UI线程处理消息
-    QMetaObject::invokeMethod(this, [this, message]() {
-        qDebug() << "Received message type:" << message.type();
-        
-        // 处理消息顺序 - 确保游戏开始消息先处理
-        switch (message.type()) {
+    if (message->type() == sanguosha::GAME_OVER) {
+        // 对局结束会清空重建状态，先渲染最终状态
+        m_stateCoalescer->flush();
+    }
+    dispatchMessage(*message);
+}
+
+bool NetworkManager::applyStateMessage(sanguosha::GameMessage* message) {
+    if (message->type() == sanguosha::GAME_STATE) {
+        // 完整快照交给重建器，合并器保证连续的更新只渲染最新的一份。
+        // 重建器直接引用批次 arena 上的快照，不做拷贝；该批次分发完后保留到下一份快照到来
+        m_stateReconstructor.applySnapshot(message->mutable_game_state());
+        m_snapshotSource = m_stateReconstructor.referencesSnapshot() ? m_dispatching.get() : nullptr;
+        m_stateCoalescer->setState(m_stateReconstructor.mutableState());
+        m_snapshotRequested = false;
+        m_stateCoalescer->markDirty(m_stateReconstructor.state().game_log());
+        return true;
+    }
+    if (message->type() == sanguosha::GAME_STATE_DELTA) {
+        applyGameStateDelta(message->game_state_delta());
+        return true;
+    }
+    return false;
+}
+
+void NetworkManager::dispatchMessage(const sanguosha::GameMessage& message) {
+    // 处理消息顺序 - 确保游戏开始消息先处理
+    switch (message.type()) {
     case sanguosha::GAME_START:
+        m_gameActive = true;
+        if (message.game_start().room_id() != 0) {
+            m_roomId = message.game_start().room_id();
+        }
+        QMetaObject::invokeMethod(m_worker, "setGameActive", Qt::AutoConnection, Q_ARG(bool, true));
         emit gameStartReceived(message.game_start());
         break;
     case sanguosha::GAME_STATE:
-        emit gameStateReceived(message.game_state());
+    case sanguosha::GAME_STATE_DELTA:
+        // 游戏状态已在 applyStateMessage 中交给重建器，经合并器输出，不会走到这里
+        Q_ASSERT_X(false, "NetworkManager::dispatchMessage", "game state must go through applyStateMessage");
         break;
     case sanguosha::LOGIN_RESPONSE:
-        emit loginResponseReceived(message.login_response());
+        handleLoginResponse(message.login_response());
         break;
     case sanguosha::ROOM_RESPONSE:
-        emit roomResponseReceived(message.room_response());
+        if (handleRoomResponse(message.room_response())) {
+            emit roomResponseReceived(message.room_response());
+        }
         break;
     case sanguosha::GAME_OVER:
+        // 对局结束后丢弃重建状态，下一局从完整快照开始
+        resetGameState();
+        m_gameActive = false;
+        QMetaObject::invokeMethod(m_worker, "setGameActive", Qt::AutoConnection, Q_ARG(bool, false));
         emit gameOverReceived(message.game_over());
         break;
     case sanguosha::ROOM_LIST_RESPONSE:
         emit roomListResponseReceived(message.room_list_response());
         break;
     case sanguosha::HEARTBEAT:
-        // 心跳包，无需处理
+    case sanguosha::MESSAGE_BATCH:
+        // 心跳回显已在网络工作者中处理，批量消息在 dispatchPendingMessages 中展开
         break;
     case sanguosha::GAME_ACTION:
         // 添加对GAME_ACTION的处理
@@ -127,67 +273,295 @@ void NetworkManager::parseMessage(const std::vector<char>& buffer) {
     default:
         qWarning() << "Unknown message type received:" << message.type();
         break;
+    }
+}
+
+void NetworkManager::applyGameStateDelta(const sanguosha::GameStateDelta& delta) {
+    switch (m_stateReconstructor.applyDelta(delta)) {
+    case GameStateReconstructor::Result::Applied:
+        m_stateCoalescer->markDirty(m_stateReconstructor.state().game_log());
+        break;
+    case GameStateReconstructor::Result::Gap:
+        // 版本缺口只请求一次完整快照，之后的增量在快照到达前丢弃
+        if (!m_snapshotRequested) {
+            qWarning() << "Game state version gap at" << m_stateReconstructor.version()
+                       << "delta base" << delta.base_version() << ", requesting snapshot";
+            m_snapshotRequested = true;
+            requestGameState();
+        }
+        break;
+    case GameStateReconstructor::Result::Stale:
+        break;
+    }
+}
+
+void NetworkManager::requestGameState() {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE_REQUEST);
+    message.mutable_game_state_request()->set_known_version(m_stateReconstructor.version());
+    sendMessage(message, SendPriority::Immediate);
+}
+
+void NetworkManager::handleLoginResponse(const sanguosha::LoginResponse& response) {
+    bool resuming = m_sessionState == SessionState::Resuming;
+    if (response.success()) {
+        m_serverCapabilities = response.capabilities();
+        m_resumeToken = response.resume_token();
+        m_reconnectPolicy.reset();
+    }
+    // 服务器确认支持后才开始发送压缩帧
+    if (m_compressionEnabled && (m_serverCapabilities & sanguosha::CAPABILITY_FRAME_COMPRESSION)) {
+        m_worker->setCompressThreshold(kDefaultCompressThreshold);
+    }
+
+    if (!resuming) {
+        if (response.success()) {
+            setSessionState(SessionState::LoggedIn);
+        } else {
+            m_username.clear();
+            m_password.clear();
+        }
+        emit loginResponseReceived(response);
+        return;
+    }
+
+    // 自动重新登录的结果不再交给界面，避免重建大厅或对局界面
+    if (!response.success()) {
+        abandonSession();
+        setSessionState(SessionState::Connected);
+        emit sessionLost(QString::fromStdString(response.error_message()));
+        return;
+    }
+    if (response.resumed() || m_roomId == 0) {
+        // 令牌有效时服务器已恢复房间和对局成员身份
+        finishResume();
+        return;
+    }
+
+    // 会话没能恢复，按原来的房间号重新加入
+    m_rejoinPending = true;
+    sendRoomRequest(sanguosha::JOIN_ROOM, m_roomId, SendPriority::Immediate);
+}
+
+bool NetworkManager::handleRoomResponse(const sanguosha::RoomResponse& response) {
+    if (response.success() && response.has_room_info()) {
+        m_roomId = response.room_info().room_id();
+    }
+    if (!m_rejoinPending) {
+        return true;
+    }
+
+    m_rejoinPending = false;
+    if (response.success()) {
+        finishResume();
+        return false;
+    }
+
+    // 房间已解散或对局已结束：保留登录，回到大厅
+    qWarning() << "Failed to rejoin room" << m_roomId << ":"
+               << QString::fromStdString(response.error_message());
+    m_roomId = 0;
+    m_gameActive = false;
+    resetGameState();
+    QMetaObject::invokeMethod(m_worker, "setGameActive", Qt::AutoConnection, Q_ARG(bool, false));
+    setSessionState(SessionState::LoggedIn);
+    emit sessionLost(QString::fromStdString(response.error_message()));
+    return false;
+}
+
+void NetworkManager::resetGameState() {
+    m_stateReconstructor.reset();
+    m_stateCoalescer->clear();
+    m_stateCoalescer->setState(m_stateReconstructor.mutableState());
+    // 保留的快照批次在下一次分发结束时交还
+    m_snapshotSource = nullptr;
+    m_snapshotRequested = false;
 }
-    }, Qt::QueuedConnection);
+
+void NetworkManager::finishResume() {
+    setSessionState(SessionState::LoggedIn);
+    if (m_gameActive) {
+        // 立即请求快照补齐断线期间错过的状态；之后的增量在快照到达前丢弃
+        QMetaObject::invokeMethod(m_worker, "setGameActive", Qt::AutoConnection, Q_ARG(bool, true));
+        m_snapshotRequested = true;
+        requestGameState();
+    }
+    emit sessionRestored();
+}
+
+void NetworkManager::abandonSession() {
+    m_username.clear();
+    m_password.clear();
+    m_resumeToken.clear();
+    m_roomId = 0;
+    m_gameActive = false;
+    m_rejoinPending = false;
+}
+
+void NetworkManager::onWorkerConnected() {
+    // 能力位按连接协商，重连后要等新的登录响应
+    m_serverCapabilities = 0;
+    m_rejoinPending = false;
+    emit connected();
+
+    if (!m_username.isEmpty()) {
+        // 之前已登录：带上恢复令牌自动重新登录
+        setSessionState(SessionState::Resuming);
+        sendLoginRequest(true);
+    } else {
+        setSessionState(SessionState::Connected);
+    }
+}
+
+void NetworkManager::onWorkerDisconnected() {
+    emit disconnected();
+    // 正在建立新连接时断开的是旧连接，新连接失败会在 onWorkerError 中处理
+    if (m_sessionState != SessionState::Connecting) {
+        scheduleReconnect();
+    }
+}
+
+void NetworkManager::onWorkerError(const QString& errorString) {
+    emit errorOccurred(errorString);
+    // 连接失败不会触发 disconnected，在这里安排下一次重连；
+    // 已建立的连接出错时随后会收到 disconnected
+    if (m_sessionState == SessionState::Connecting && !isConnected()) {
+        scheduleReconnect();
+    }
+}
+
+void NetworkManager::scheduleReconnect() {
+    if (!m_autoReconnect || m_reconnectTimer->isActive()) {
+        return;
+    }
+    // 带抖动的指数退避，服务器重启后客户端的重连会被错开
+    int delayMs = m_reconnectPolicy.nextDelayMs();
+    setSessionState(SessionState::WaitingRetry);
+    m_reconnectTimer->start(delayMs);
+    qDebug() << "Reconnect attempt" << m_reconnectPolicy.attempts() << "in" << delayMs << "ms";
+    emit reconnectScheduled(m_reconnectPolicy.attempts(), delayMs);
+}
+
+void NetworkManager::onReconnectTimeout() {
+    setSessionState(SessionState::Connecting);
+    QMetaObject::invokeMethod(m_worker, "connectToServer", Qt::AutoConnection,
+                              Q_ARG(QString, m_host), Q_ARG(quint16, m_port));
+}
+
+void NetworkManager::setSessionState(SessionState state) {
+    if (m_sessionState == state) {
+        return;
+    }
+    m_sessionState = state;
+    emit sessionStateChanged(state);
+}
+
+void NetworkManager::onRttSampled(double rttMs) {
+    // 样本在网络线程测得，这里只负责汇总
+    m_latencyStats.addSample(rttMs);
+    emit rttSampled(rttMs);
 }
 
 // 在NetworkManager::sendMessage中，确保编码正确
-void NetworkManager::sendMessage(const sanguosha::GameMessage& message) {
+void NetworkManager::sendMessage(const sanguosha::GameMessage& message, SendPriority priority) {
     if (!isConnected()) {
         qWarning() << "Not connected to server";
         return;
     }
     
-    // 计算消息体大小
-    size_t body_size = message.ByteSizeLong();
-    size_t total_size = 4 + body_size;
-    
-    std::vector<char> buffer(total_size);
-    
-    // 写入消息头（长度）- 使用网络字节序
-    uint32_t net_size = htonl(static_cast<uint32_t>(body_size));
-    memcpy(buffer.data(), &net_size, 4);  // 去掉 std:: 前缀
-    
-    // 写入消息体
-    if (!message.SerializeToArray(buffer.data() + 4, body_size)) {
+    // 直接序列化进网络工作者的发送缓冲区，写套接字在其所在线程合并完成
+    if (!m_worker->queueMessage(message, priority)) {
         qWarning() << "Failed to serialize message";
+    }
+}
+
+void NetworkManager::sendBatch(sanguosha::MessageBatch* batch, SendPriority priority) {
+    if (batch->messages_size() == 0) {
         return;
     }
-    
-    // 发送完整消息
-    qint64 bytesWritten = m_socket->write(buffer.data(), total_size);
-    if (bytesWritten == -1) {
-        qWarning() << "Write error:" << m_socket->errorString();
-    } else if (bytesWritten != total_size) {
-        qWarning() << "Incomplete write:" << bytesWritten << "of" << total_size;
+    if (!(m_serverCapabilities & sanguosha::CAPABILITY_MESSAGE_BATCH)) {
+        // 服务器不支持批量消息时逐条发送，仍会在同一次写入中发出
+        for (const sanguosha::GameMessage& message : batch->messages()) {
+            sendMessage(message, priority);
+        }
+        batch->Clear();
+        return;
     }
-    
-    m_socket->flush(); // 确保数据被发送
+
+    sanguosha::GameMessage envelope;
+    envelope.set_type(sanguosha::MESSAGE_BATCH);
+    envelope.mutable_batch()->Swap(batch);
+    sendMessage(envelope, priority);
 }
 
-void NetworkManager::sendHeartbeat() {
-    sanguosha::GameMessage message;
-    message.set_type(sanguosha::HEARTBEAT);
-    sendMessage(message);
+void NetworkManager::setHeartbeatConfig(const HeartbeatConfig& config) {
+    NetworkWorker* worker = m_worker;
+    QMetaObject::invokeMethod(m_worker, [worker, config]() {
+        worker->setHeartbeatConfig(config);
+    }, Qt::AutoConnection);
+}
+
+void NetworkManager::setLowDelay(bool enabled) {
+    QMetaObject::invokeMethod(m_worker, "setLowDelay", Qt::AutoConnection, Q_ARG(bool, enabled));
 }
 
-void NetworkManager::login(const QString& username) {
+void NetworkManager::login(const QString& username, const QString& password) {
+    // 保存凭据，断线重连后自动重新登录
+    m_username = username;
+    m_password = password;
+    m_resumeToken.clear();
+    m_roomId = 0;
+    sendLoginRequest(false);
+}
+
+void NetworkManager::sendLoginRequest(bool resume) {
     sanguosha::GameMessage message;
     message.set_type(sanguosha::LOGIN_REQUEST);
-    message.mutable_login_request()->set_username(username.toStdString());
-    sendMessage(message);
+    sanguosha::LoginRequest* request = message.mutable_login_request();
+    request->set_username(m_username.toStdString());
+    request->set_password(m_password.toStdString());
+    if (resume) {
+        request->set_resume_token(m_resumeToken);
+    }
+    uint32_t capabilities = sanguosha::CAPABILITY_MESSAGE_BATCH | sanguosha::CAPABILITY_ACTION_SEQUENCE;
+    if (m_compressionEnabled) {
+        capabilities |= sanguosha::CAPABILITY_FRAME_COMPRESSION;
+    }
+    request->set_capabilities(capabilities);
+    sendMessage(message, resume ? SendPriority::Immediate : SendPriority::Batched);
 }
 
-void NetworkManager::onDisconnected() {
-    m_heartbeatTimer->stop();
-    emit disconnected();
+void NetworkManager::sendRoomRequest(sanguosha::RoomAction action, uint32_t roomId,
+                                     SendPriority priority) {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::ROOM_REQUEST);
+    sanguosha::RoomRequest* request = message.mutable_room_request();
+    request->set_action(action);
+    request->set_room_id(roomId);
+    sendMessage(message, priority);
+}
+
+void NetworkManager::createRoom() {
+    sendRoomRequest(sanguosha::CREATE_ROOM, 0);
+}
+
+void NetworkManager::joinRoom(uint32_t roomId) {
+    sendRoomRequest(sanguosha::JOIN_ROOM, roomId);
+}
+
+void NetworkManager::leaveRoom() {
+    // 主动离开后断线重连不再尝试回到该房间
+    sendRoomRequest(sanguosha::LEAVE_ROOM, m_roomId);
+    m_roomId = 0;
 }
 
-void NetworkManager::onErrorOccurred(QAbstractSocket::SocketError error) {
-    emit errorOccurred(m_socket->errorString());
+void NetworkManager::requestRoomList() {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::ROOM_LIST_REQUEST);
+    sendMessage(message);
 }
 
-void NetworkManager::sendGameAction(uint32_t cardId, uint32_t targetPlayer) {
+void NetworkManager::sendGameAction(uint32_t cardId, uint32_t targetPlayer, uint32_t sequence) {
     sanguosha::GameMessage message;
     message.set_type(sanguosha::GAME_ACTION);
     
@@ -195,6 +569,15 @@ void NetworkManager::sendGameAction(uint32_t cardId, uint32_t targetPlayer) {
     gameAction->set_type(sanguosha::ACTION_PLAY_CARD);
     gameAction->set_card_id(cardId);
     gameAction->set_target_player(targetPlayer);
+    gameAction->set_sequence(sequence);
     
-    sendMessage(message);
+    sendMessage(message, SendPriority::Immediate);
+}
+
+void NetworkManager::endTurn(uint32_t sequence) {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_ACTION);
+    message.mutable_game_action()->set_type(sanguosha::ACTION_END_TURN);
+    message.mutable_game_action()->set_sequence(sequence);
+    sendMessage(message, SendPriority::Immediate);
 }
\ No newline at end of file
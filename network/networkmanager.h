@@ -2,31 +2,110 @@
 #define NETWORK_MANAGER_H
 
 #include <QObject>
-#include <QTcpSocket>
+#include <QThread>
 #include <QTimer>
+#include "gamestatecoalescer.h"
+#include "gamestatereconstructor.h"
+#include "latencystats.h"
+#include "networkworker.h"
+#include "reconnectpolicy.h"
 #include "sanguosha.pb.h"
 
+// 连接与会话状态
+enum class SessionState {
+    Disconnected,   // 未连接，且不会自动重连
+    Connecting,     // 正在建立连接（首次连接或重连）
+    Connected,      // 已连接，尚未登录
+    LoggedIn,       // 已登录
+    Resuming,       // 重连成功，正在自动登录、重新加入房间
+    WaitingRetry    // 连接已断开，等待退避时间后重连
+};
+
 class NetworkManager : public QObject
 {
     Q_OBJECT
 
 public:
+    // 界面使用全局实例；压测等需要在一个进程内建立多个连接时可以直接构造
     static NetworkManager& instance();
+    explicit NetworkManager(QObject *parent = nullptr);
     ~NetworkManager();
 
+    // 是否把套接字I/O、分帧和解析放到独立线程；必须在第一次调用 instance() 之前设置
+    static void setIoThreadEnabled(bool enabled);
+
+    // 连接断开或连接失败后会按退避策略自动重连，直到调用 disconnectFromServer()
     void connectToServer(const QString& host, quint16 port);
-    void sendMessage(const sanguosha::GameMessage& message);
+    // 主动断开：停止自动重连并丢弃会话
+    void disconnectFromServer();
+    void sendMessage(const sanguosha::GameMessage& message,
+                     SendPriority priority = SendPriority::Batched);
+    // 把多条消息打包成一帧发送，服务器未声明支持批量消息时退化为逐条发送。
+    // 发送后 batch 被清空。
+    void sendBatch(sanguosha::MessageBatch* batch,
+                   SendPriority priority = SendPriority::Batched);
+    // 登录响应中服务器声明的能力位（Capability 按位或），未登录时为0
+    uint32_t serverCapabilities() const { return m_serverCapabilities; }
+    // 是否启用 TCP_NODELAY（默认启用，小包由发送队列自行合并）
+    void setLowDelay(bool enabled);
+    // 心跳间隔与断线判定参数；对局开始/结束时自动切换心跳间隔
+    void setHeartbeatConfig(const HeartbeatConfig& config);
     bool isConnected() const;
 
-    // 登录相关
-    void login(const QString& username);
-    void sendGameAction(uint32_t cardId, uint32_t targetPlayer);
+    SessionState sessionState() const { return m_sessionState; }
+    bool isLoggedIn() const { return m_sessionState == SessionState::LoggedIn; }
+
+    // 录制收发的全部帧到文件，用于复现问题；path 为空时停止录制
+    void setRecordingPath(const QString& path);
+    // 回放录制文件中的入站数据，代替连接服务器；speed 为倍速，不大于0时全速回放
+    void startReplay(const QString& path, double speed = 1.0);
+    bool isReplaying() const { return m_replaying; }
+
+    // 是否在登录时声明支持压缩帧（默认支持），需在登录前设置
+    void setCompressionEnabled(bool enabled) { m_compressionEnabled = enabled; }
+    const FrameCompressionStats& compressionStats() const { return m_worker->compressionStats(); }
+
+    // 登录相关；登录请求同时携带客户端支持的能力位
+    void login(const QString& username, const QString& password = QString());
+    // 房间操作，结果通过 roomResponseReceived / roomListResponseReceived 返回
+    void createRoom();
+    void joinRoom(uint32_t roomId);
+    void leaveRoom();
+    void requestRoomList();
+    // sequence 非0时服务器会在之后的游戏状态中回传，用于确认本地预测
+    void sendGameAction(uint32_t cardId, uint32_t targetPlayer, uint32_t sequence = 0);
+    void endTurn(uint32_t sequence = 0);
+    // 请求完整游戏状态快照
+    void requestGameState();
+
+    // 消息被整体深拷贝一次（如跨线程 Q_ARG 转交）时调用；消息都在UI线程分发时 dispatch.message_copies 应保持为0
+    void recordMessageCopy() { m_messageCopies->add(); }
+
+    // 基于心跳回显的往返时延统计（最近256个样本）
+    LatencySummary latencySummary() const { return m_latencyStats.summary(); }
+    void resetLatencyStats() { m_latencyStats.reset(); }
+
+    // GAME_STATE 合并器，可调整输出间隔或查看被合并的快照数量
+    GameStateCoalescer* stateCoalescer() const { return m_stateCoalescer; }
+    // 增量状态重建器，保存最近一次完整的游戏状态
+    const GameStateReconstructor& stateReconstructor() const { return m_stateReconstructor; }
 
 signals:
     // 连接状态信号
     void connected();
     void disconnected();
     void errorOccurred(const QString& errorString);
+    // 心跳连续超时，连接被判定为已断开（随后还会收到 disconnected）
+    void connectionLost();
+    // 已安排第 attempt 次重连，delayMs 毫秒后发起
+    void reconnectScheduled(int attempt, int delayMs);
+    // 重连后已自动登录并回到原来的房间，完整游戏状态已请求；界面无需重建
+    void sessionRestored();
+    // 重连后无法恢复登录或房间，isLoggedIn() 表示是否仍处于登录状态
+    void sessionLost(const QString& reason);
+    void sessionStateChanged(SessionState state);
+    // 回放结束，附带交付的帧数、字节数和耗时
+    void replayFinished(quint64 frames, quint64 bytes, qint64 elapsedMs);
 
     // 服务器消息信号
     void loginResponseReceived(const sanguosha::LoginResponse& response);
@@ -38,22 +117,71 @@ signals:
     void roomListResponseReceived(const sanguosha::RoomListResponse &response);
     void gameActionReceived(const sanguosha::GameAction& action);
 
+    // 每得到一个往返时延样本发出一次
+    void rttSampled(double rttMs);
+
 private slots:
-    void onConnected();
-    void onReadyRead();
-    void onDisconnected();
-    void onErrorOccurred(QAbstractSocket::SocketError error);
-    void sendHeartbeat();
+    void dispatchPendingMessages();
+    void onWorkerConnected();
+    void onWorkerDisconnected();
+    void onWorkerError(const QString& errorString);
+    void onReconnectTimeout();
+    void onRttSampled(double rttMs);
 
 private:
-    explicit NetworkManager(QObject *parent = nullptr);
-    void parseMessage(const std::vector<char>& buffer);
+    void dispatchMessage(const sanguosha::GameMessage& message);
+    // 分发 MESSAGE_BATCH 中的一条消息，批末的渲染由调用方负责
+    void dispatchBatchedMessage(sanguosha::GameMessage* message);
+    bool applyStateMessage(sanguosha::GameMessage* message);
+    void applyGameStateDelta(const sanguosha::GameStateDelta& delta);
+    void sendLoginRequest(bool resume);
+    void sendRoomRequest(sanguosha::RoomAction action, uint32_t roomId,
+                         SendPriority priority = SendPriority::Batched);
+    void handleLoginResponse(const sanguosha::LoginResponse& response);
+    bool handleRoomResponse(const sanguosha::RoomResponse& response);
+    void finishResume();
+    // 丢弃重建的对局状态，下一局或重新加入后从完整快照开始
+    void resetGameState();
+    void abandonSession();
+    void scheduleReconnect();
+    void setSessionState(SessionState state);
+
+    static bool s_ioThreadEnabled;
+
+    QThread* m_ioThread;
+    NetworkWorker* m_worker;
+    GameStateCoalescer* m_stateCoalescer;
+    GameStateReconstructor m_stateReconstructor;
+    bool m_snapshotRequested;
+    bool m_compressionEnabled;
+    uint32_t m_serverCapabilities;
+    MetricCounter* m_messagesDispatched;
+    MetricCounter* m_messageCopies;
+    LatencyStats m_latencyStats;
+
+    // 断线重连与会话恢复
+    SessionState m_sessionState;
+    ReconnectPolicy m_reconnectPolicy;
+    QTimer* m_reconnectTimer;
+    bool m_autoReconnect;
+    QString m_host;
+    quint16 m_port;
+    QString m_username;
+    QString m_password;
+    std::string m_resumeToken;
+    uint32_t m_roomId;          // 当前所在房间，0表示不在房间中
+    bool m_gameActive;
+    bool m_rejoinPending;       // 已自动发出加入房间请求，等待房间响应
+    bool m_replaying;
 
-    QTcpSocket* m_socket;
-    QTimer* m_heartbeatTimer;
-    std::vector<char> m_buffer;
-    size_t m_expectedBodySize;
-    bool m_headerRead;
+    // 正在分发的批次及其游标，嵌套进入 dispatchPendingMessages 时从这里接着分发
+    std::unique_ptr<InboundBatch> m_dispatching;
+    size_t m_dispatchCursor;      // 批次中下一条要分发的消息
+    int m_batchCursor;            // 当前 MESSAGE_BATCH 中下一条要分发的内部消息
+    int m_dispatchDepth;          // dispatchPendingMessages 的嵌套层数
+    std::vector<std::unique_ptr<InboundBatch>> m_finishedBatches;   // 已分发完、等最外层调用交还的批次
+    InboundBatch* m_snapshotSource;                  // 重建器当前引用的快照所在的批次，nullptr 表示快照不在批次上
+    std::unique_ptr<InboundBatch> m_snapshotBatch;   // 已分发完但快照仍被重建器引用的批次
 };
 
 #endif // NETWORK_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,500 @@
+#include "networkworker.h"
+#include <QThread>
+#include "trafficreplayer.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cstring>
+
+namespace {
+// 为每种消息类型注册一个计数器，名称如 net.frames_in.GAME_STATE
+std::vector<MetricCounter*> registerFrameCounters(const std::string& prefix) {
+    std::vector<MetricCounter*> counters(sanguosha::MessageType_MAX + 1, nullptr);
+    for (int type = sanguosha::MessageType_MIN; type <= sanguosha::MessageType_MAX; ++type) {
+        if (sanguosha::MessageType_IsValid(type)) {
+            counters[type] = &MetricsRegistry::instance().counter(
+                prefix + sanguosha::MessageType_Name(static_cast<sanguosha::MessageType>(type)));
+        }
+    }
+    return counters;
+}
+
+void countFrame(const std::vector<MetricCounter*>& counters, int type) {
+    if (type >= 0 && static_cast<size_t>(type) < counters.size() && counters[type]) {
+        counters[type]->add();
+    }
+}
+
+// 足以容纳一次读取中的若干份8人局完整游戏状态；超出时 arena 再按块向堆申请
+const size_t kBatchInitialBlockSize = 64 * 1024;
+
+google::protobuf::ArenaOptions batchArenaOptions(std::vector<char>* block) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block->data();
+    options.initial_block_size = block->size();
+    return options;
+}
+}
+
+InboundBatch::InboundBatch()
+    : initialBlock(kBatchInitialBlockSize),
+      arena(batchArenaOptions(&initialBlock)),
+      firstSequence(0) {
+}
+
+void InboundBatch::reset() {
+    messages.clear();
+    arena.Reset();
+    firstSequence = 0;
+}
+
+NetworkWorker::NetworkWorker(QObject *parent)
+    : QObject(parent),
+      m_socket(new QTcpSocket(this)),
+      m_heartbeatTimer(new QTimer(this)),
+      m_drainScheduled(false),
+      m_connected(false),
+      m_flushScheduled(false),
+      m_urgentFlush(false),
+      m_lowDelay(true),
+      m_compressThreshold(0),
+      m_replayer(nullptr),
+      m_bytesIn(&MetricsRegistry::instance().counter("net.bytes_in")),
+      m_bytesOut(&MetricsRegistry::instance().counter("net.bytes_out")),
+      m_framesIn(registerFrameCounters("net.frames_in.")),
+      m_framesOut(registerFrameCounters("net.frames_out.")),
+      m_parseTime(&MetricsRegistry::instance().timingHistogram("net.parse_us")),
+      m_rtt(&MetricsRegistry::instance().histogram("net.rtt_ms", MetricHistogram::exponentialBounds(0.25, 2.0, 18))),
+      m_queueDepth(&MetricsRegistry::instance().gauge("dispatch.queue_depth")),
+      m_messagesParsed(&MetricsRegistry::instance().counter("dispatch.messages_parsed")),
+      m_pushedSequence(0) {
+
+    connect(m_socket, &QTcpSocket::connected, this, &NetworkWorker::onConnected);
+    connect(m_socket, &QTcpSocket::readyRead, this, &NetworkWorker::onReadyRead);
+    connect(m_socket, &QTcpSocket::disconnected, this, &NetworkWorker::onDisconnected);
+    connect(m_socket, SIGNAL(error(QAbstractSocket::SocketError)),
+        this, SLOT(onErrorOccurred(QAbstractSocket::SocketError)));
+
+    // 每秒检查一次是否需要心跳，实际发送频率由调度策略决定
+    connect(m_heartbeatTimer, &QTimer::timeout, this, &NetworkWorker::onHeartbeatTick);
+    m_heartbeatTimer->setInterval(1000);
+    m_clock.start();
+}
+
+NetworkWorker::~NetworkWorker() {
+}
+
+bool NetworkWorker::appendFrame(const sanguosha::GameMessage& message, std::vector<char>* buffer,
+                                size_t compressThreshold, FrameCompressionStats* stats) {
+    // 计算消息体大小
+    size_t body_size = message.ByteSizeLong();
+    if (compressThreshold != 0 && body_size >= compressThreshold) {
+        return appendCompressedFrame(message, body_size, buffer, stats);
+    }
+
+    size_t offset = buffer->size();
+    buffer->resize(offset + 4 + body_size);
+    char* frame = buffer->data() + offset;
+
+    // 写入消息头（长度）- 使用网络字节序
+    uint32_t net_size = htonl(static_cast<uint32_t>(body_size));
+    memcpy(frame, &net_size, 4);
+
+    // 写入消息体
+    if (!message.SerializeToArray(frame + 4, static_cast<int>(body_size))) {
+        buffer->resize(offset);
+        return false;
+    }
+    if (stats) {
+        stats->record(FrameCompressionStats::Sent, message.type(), body_size, body_size, false);
+    }
+    return true;
+}
+
+bool NetworkWorker::appendCompressedFrame(const sanguosha::GameMessage& message, size_t body_size,
+                                          std::vector<char>* buffer, FrameCompressionStats* stats) {
+    // 大消息先序列化到临时缓冲区再压缩；压缩后没有变小就按原样发送
+    QByteArray raw(static_cast<int>(body_size), Qt::Uninitialized);
+    if (!message.SerializeToArray(raw.data(), raw.size())) {
+        return false;
+    }
+
+    QByteArray compressed;
+    bool useCompressed = compressFrameBody(raw.constData(), body_size, &compressed);
+    const QByteArray& body = useCompressed ? compressed : raw;
+    size_t wire_size = static_cast<size_t>(body.size());
+
+    uint32_t header = static_cast<uint32_t>(wire_size);
+    if (useCompressed) {
+        header |= FrameDecoder::kCompressedFlag;
+    }
+    uint32_t net_header = htonl(header);
+
+    size_t offset = buffer->size();
+    buffer->resize(offset + 4 + wire_size);
+    char* frame = buffer->data() + offset;
+    memcpy(frame, &net_header, 4);
+    memcpy(frame + 4, body.constData(), wire_size);
+
+    if (stats) {
+        stats->record(FrameCompressionStats::Sent, message.type(), body_size, wire_size, useCompressed);
+    }
+    return true;
+}
+
+bool NetworkWorker::queueMessage(const sanguosha::GameMessage& message, SendPriority priority) {
+    {
+        std::lock_guard<std::mutex> lock(m_outboundMutex);
+        if (!appendFrame(message, &m_outbound,
+                         m_compressThreshold.load(std::memory_order_acquire), &m_compressionStats)) {
+            return false;
+        }
+    }
+    countFrame(m_framesOut, message.type());
+
+    if (priority == SendPriority::Immediate) {
+        m_urgentFlush.store(true, std::memory_order_release);
+        if (QThread::currentThread() == thread()) {
+            // 同一线程时直接写出，不等下一轮事件循环
+            flushOutbound();
+            return true;
+        }
+    }
+
+    // 本轮事件循环内的消息只安排一次写出
+    if (!m_flushScheduled.exchange(true, std::memory_order_acq_rel)) {
+        QMetaObject::invokeMethod(this, "flushOutbound", Qt::QueuedConnection);
+    }
+    return true;
+}
+
+bool NetworkWorker::takeBatch(std::unique_ptr<InboundBatch>& batch) {
+    if (!m_inbound.pop(batch)) {
+        return false;
+    }
+    m_queueDepth->add(-static_cast<int64_t>(batch->messages.size()));
+    return true;
+}
+
+void NetworkWorker::recycleBatch(std::unique_ptr<InboundBatch> batch) {
+    m_recycled.push(std::move(batch));
+}
+
+InboundBatch* NetworkWorker::pendingBatch() {
+    if (!m_pending) {
+        // 优先复用UI线程交还的批次，arena 在网络线程上重置
+        if (m_recycled.pop(m_pending)) {
+            m_pending->reset();
+        } else {
+            m_pending.reset(new InboundBatch);
+        }
+    }
+    return m_pending.get();
+}
+
+void NetworkWorker::beginDrain() {
+    m_drainScheduled.store(false, std::memory_order_release);
+}
+
+void NetworkWorker::connectToServer(const QString& host, quint16 port) {
+    // 重连时套接字可能还停留在上一次失败的连接状态
+    if (m_socket->state() != QAbstractSocket::UnconnectedState) {
+        m_socket->abort();
+    }
+    m_socket->connectToHost(host, port);
+}
+
+void NetworkWorker::flushOutbound() {
+    m_flushScheduled.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_outboundMutex);
+        m_writing.swap(m_outbound);
+    }
+    if (m_writing.empty()) {
+        return;
+    }
+
+    if (m_socket->state() != QAbstractSocket::ConnectedState) {
+        qWarning() << "Not connected to server, dropping" << m_writing.size() << "bytes";
+        m_writing.clear();
+        return;
+    }
+
+    // 整批数据一次写入
+    qint64 total_size = static_cast<qint64>(m_writing.size());
+    qint64 bytesWritten = m_socket->write(m_writing.data(), total_size);
+    if (bytesWritten == -1) {
+        qWarning() << "Write error:" << m_socket->errorString();
+    } else {
+        m_bytesOut->add(static_cast<uint64_t>(bytesWritten));
+        if (bytesWritten != total_size) {
+            qWarning() << "Incomplete write:" << bytesWritten << "of" << total_size;
+        }
+    }
+    if (m_recorder) {
+        m_recorder->recordData(TrafficDirection::Outbound, static_cast<uint64_t>(m_clock.nsecsElapsed() / 1000),
+                               m_writing.data(), m_writing.size());
+    }
+    m_writing.clear();
+    m_heartbeat.onFrameSent(m_clock.elapsed());
+
+    // 只有低延迟消息才立即交给操作系统，其余的由事件循环写出
+    if (m_urgentFlush.exchange(false, std::memory_order_acq_rel)) {
+        m_socket->flush();
+    }
+}
+
+void NetworkWorker::setGameActive(bool active) {
+    m_heartbeat.setGameActive(active);
+}
+
+void NetworkWorker::setHeartbeatConfig(const HeartbeatConfig& config) {
+    m_heartbeat.setConfig(config);
+}
+
+void NetworkWorker::setLowDelay(bool enabled) {
+    m_lowDelay = enabled;
+    m_socket->setSocketOption(QAbstractSocket::LowDelayOption, enabled ? 1 : 0);
+}
+
+void NetworkWorker::setRecordingPath(const QString& path) {
+    m_recorder.reset();
+    if (path.isEmpty()) {
+        return;
+    }
+    m_recorder.reset(new TrafficRecorder);
+    if (!m_recorder->open(path.toStdString())) {
+        m_recorder.reset();
+        emit errorOccurred(QString("Cannot open traffic recording %1").arg(path));
+        return;
+    }
+    qDebug() << "Recording traffic to" << path;
+}
+
+void NetworkWorker::startReplay(const QString& path, double speed) {
+    if (!m_replayer) {
+        // 回放数据直接写入帧解码器，后续处理与从套接字读到的数据相同
+        m_replayer = new TrafficReplayer([this](const char* data, size_t size) {
+            m_decoder.append(data, size);
+            processInbound();
+        }, this);
+        connect(m_replayer, &TrafficReplayer::finished, this, &NetworkWorker::replayFinished);
+    }
+    m_decoder.reset();
+    if (!m_replayer->start(path, speed)) {
+        emit errorOccurred(QString("Cannot open traffic replay %1").arg(path));
+        emit replayFinished(0, 0, 0);
+    }
+}
+
+void NetworkWorker::shutdown() {
+    if (m_replayer) {
+        m_replayer->stop();
+    }
+    m_recorder.reset();
+    m_heartbeatTimer->stop();
+    if (m_socket->state() == QAbstractSocket::ConnectedState) {
+        m_socket->disconnectFromHost();
+    }
+}
+
+void NetworkWorker::onConnected() {
+    // 压缩帧要等登录响应确认后才启用，旧服务器不会收到带压缩标记的帧
+    m_compressThreshold.store(0, std::memory_order_release);
+    m_outstandingHeartbeats.clear();
+    m_heartbeat.reset(m_clock.elapsed());
+    m_socket->setSocketOption(QAbstractSocket::LowDelayOption, m_lowDelay ? 1 : 0);
+    m_heartbeatTimer->start();
+    m_decoder.reset();
+    m_connected.store(true, std::memory_order_release);
+    emit connected();
+}
+
+void NetworkWorker::onReadyRead() {
+    TRACE_SPAN("net", "onReadyRead");
+    // 直接从套接字读入解码器的环形缓冲区，避免经过 QByteArray 中转
+    qint64 totalRead = 0;
+    while (m_socket->bytesAvailable() > 0) {
+        size_t available = 0;
+        char* dest = m_decoder.prepareWrite(1, &available);
+        qint64 bytesRead = m_socket->read(dest, static_cast<qint64>(available));
+        if (bytesRead <= 0) {
+            break;
+        }
+        m_decoder.commitWrite(static_cast<size_t>(bytesRead));
+        totalRead += bytesRead;
+    }
+    if (totalRead > 0) {
+        m_bytesIn->add(static_cast<uint64_t>(totalRead));
+        m_heartbeat.onFrameReceived(m_clock.elapsed());
+    }
+
+    processInbound();
+}
+
+void NetworkWorker::processInbound() {
+    FrameView frame;
+    bool queued = false;
+    while (m_decoder.nextFrame(frame)) {
+        if (m_recorder) {
+            m_recorder->recordFrame(TrafficDirection::Inbound,
+                                    static_cast<uint64_t>(m_clock.nsecsElapsed() / 1000), frame);
+        }
+        parseMessage(frame);
+    }
+
+    if (m_pending) {
+        if (!m_pending->messages.empty()) {
+            m_queueDepth->add(static_cast<int64_t>(m_pending->messages.size()));
+            m_inbound.push(std::move(m_pending));
+            queued = true;
+        } else {
+            // 只有心跳回显时不必交给UI线程，释放掉解析心跳占用的 arena 内存
+            m_pending->reset();
+        }
+    }
+
+    // 一批数据只通知一次；UI线程开始取消息之前不重复通知
+    if (queued && !m_drainScheduled.exchange(true, std::memory_order_acq_rel)) {
+        emit messagesReady();
+    }
+
+    if (m_decoder.hasError()) {
+        qWarning() << "Invalid frame length from server, disconnecting";
+        m_socket->abort();
+    }
+}
+
+void NetworkWorker::parseMessage(const FrameView& frame) {
+    TRACE_SPAN("net", "parseMessage");
+    // 消息分配在当前批次的 arena 上，随批次整体交给UI线程，不再拷贝
+    InboundBatch* batch = pendingBatch();
+    sanguosha::GameMessage* message = google::protobuf::Arena::CreateMessage<sanguosha::GameMessage>(&batch->arena);
+    m_messagesParsed->add();
+
+    // 压缩帧先解压到临时缓冲区，之后按一段连续数据解析
+    QByteArray decompressed;
+    FrameView body = frame;
+    {
+        // 解析耗时包括解压
+        MetricTimer timer(m_parseTime);
+        if (frame.compressed) {
+            if (!decompressFrameBody(frame, m_decoder.maxFrameSize(), &decompressed)) {
+                qWarning() << "Failed to decompress frame from server";
+                return;
+            }
+            body = FrameView();
+            body.first = decompressed.constData();
+            body.firstSize = static_cast<size_t>(decompressed.size());
+        }
+
+        // 直接从解码器的缓冲区解析，消息体跨越环形缓冲区末尾时拼接两段输入流
+        google::protobuf::io::ArrayInputStream firstPart(body.first, static_cast<int>(body.firstSize));
+        google::protobuf::io::ArrayInputStream secondPart(body.second, static_cast<int>(body.secondSize));
+        google::protobuf::io::ZeroCopyInputStream* parts[] = { &firstPart, &secondPart };
+        google::protobuf::io::ConcatenatingInputStream input(parts, body.isContiguous() ? 1 : 2);
+
+        google::protobuf::io::CodedInputStream coded(&input);
+        if (!message->ParseFromCodedStream(&coded) || !coded.ConsumedEntireMessage()) {
+            qWarning() << "Failed to parse message from server";
+            return;
+        }
+    }
+    countFrame(m_framesIn, message->type());
+    m_compressionStats.record(FrameCompressionStats::Received, message->type(),
+                              body.size(), frame.size(), frame.compressed);
+
+    // 心跳回显在网络线程直接处理，时延不受UI线程排队影响，也不再进入分发队列
+    if (message->type() == sanguosha::HEARTBEAT) {
+        handleHeartbeatEcho(*message);
+        return;
+    }
+    if (message->type() == sanguosha::MESSAGE_BATCH) {
+        // 批量消息整体交给UI线程，其中的心跳回显仍在这里计时
+        for (const sanguosha::GameMessage& inner : message->batch().messages()) {
+            if (inner.type() == sanguosha::HEARTBEAT) {
+                handleHeartbeatEcho(inner);
+            }
+        }
+    }
+
+    ++m_pushedSequence;
+    if (batch->messages.empty()) {
+        batch->firstSequence = m_pushedSequence;
+    }
+    if (Tracer::enabled()) {
+        Tracer::instance().addFlow(Tracer::FlowPhase::Start, m_pushedSequence);
+    }
+    batch->messages.push_back(message);
+}
+
+void NetworkWorker::onDisconnected() {
+    m_heartbeatTimer->stop();
+    m_connected.store(false, std::memory_order_release);
+    emit disconnected();
+}
+
+void NetworkWorker::onErrorOccurred(QAbstractSocket::SocketError error) {
+    Q_UNUSED(error);
+    emit errorOccurred(m_socket->errorString());
+}
+
+void NetworkWorker::onHeartbeatTick() {
+    switch (m_heartbeat.poll(m_clock.elapsed())) {
+    case HeartbeatScheduler::Action::SendHeartbeat:
+        sendHeartbeat();
+        break;
+    case HeartbeatScheduler::Action::LinkDead:
+        qWarning() << "Heartbeat echo missed" << m_heartbeat.missedEchoes()
+                   << "times, connection considered dead";
+        emit connectionLost();
+        m_socket->abort();
+        break;
+    case HeartbeatScheduler::Action::None:
+        break;
+    }
+}
+
+void NetworkWorker::sendHeartbeat() {
+    uint64_t timestamp = static_cast<uint64_t>(m_clock.nsecsElapsed() / 1000);
+
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::HEARTBEAT);
+    message.mutable_heartbeat()->set_timestamp(timestamp);
+
+    // 只保留最近几个未回显的心跳，服务器丢弃的心跳不会无限累积
+    m_outstandingHeartbeats.push_back(timestamp);
+    while (m_outstandingHeartbeats.size() > 8) {
+        m_outstandingHeartbeats.pop_front();
+    }
+
+    // 立即写出，避免合并写入的等待计入往返时延
+    m_heartbeat.onHeartbeatSent(m_clock.elapsed());
+    queueMessage(message, SendPriority::Immediate);
+}
+
+void NetworkWorker::handleHeartbeatEcho(const sanguosha::GameMessage& message) {
+    if (m_outstandingHeartbeats.empty()) {
+        return;
+    }
+
+    // 优先按回显的时间戳匹配；服务器回显不带时间戳时按发送顺序匹配最早的一个
+    uint64_t echoed = message.heartbeat().timestamp();
+    auto it = m_outstandingHeartbeats.begin();
+    if (echoed != 0) {
+        it = std::find(m_outstandingHeartbeats.begin(), m_outstandingHeartbeats.end(), echoed);
+        if (it == m_outstandingHeartbeats.end()) {
+            return;
+        }
+    }
+
+    uint64_t sentAt = *it;
+    m_outstandingHeartbeats.erase(m_outstandingHeartbeats.begin(), it + 1);
+
+    uint64_t now = static_cast<uint64_t>(m_clock.nsecsElapsed() / 1000);
+    double rttMs = static_cast<double>(now - sentAt) / 1000.0;
+    m_rtt->record(rttMs);
+    emit rttSampled(rttMs);
+}
@@ -0,0 +1,163 @@
+#ifndef NETWORK_WORKER_H
+#define NETWORK_WORKER_H
+
+#include <QObject>
+#include <QElapsedTimer>
+#include <QTcpSocket>
+#include <QTimer>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "framecompression.h"
+#include "framedecoder.h"
+#include "heartbeatscheduler.h"
+#include "metrics.h"
+#include "spscqueue.h"
+#include "tracing.h"
+#include "trafficrecorder.h"
+#include "sanguosha.pb.h"
+#include <google/protobuf/arena.h>
+
+class TrafficReplayer;
+
+// 一次读取中解析出的全部入站消息。消息及其嵌套的玩家状态、手牌和字符串都分配在 arena 上，
+// 解析一份游戏状态只是在 arena 的内存块上顺序分配；整批分发完后交还网络线程，复用时一次性释放。
+// arena 的初始块随批次保留，稳定运行时解析不再向堆申请内存。
+struct InboundBatch {
+    InboundBatch();
+    void reset();
+
+    std::vector<char> initialBlock;   // 必须先于 arena 构造
+    google::protobuf::Arena arena;
+    std::vector<sanguosha::GameMessage*> messages;
+    uint64_t firstSequence;           // 第一条消息进入分发队列的序号，后续消息依次加1
+};
+
+// 发送优先级：Batched 的消息在本轮事件循环结束时合并成一次写入；
+// Immediate 用于玩家操作等对延迟敏感的消息，写入后立即把数据交给操作系统。
+enum class SendPriority {
+    Batched,
+    Immediate
+};
+
+// 套接字读写、分帧和解析的执行者。
+// 可以与 NetworkManager 处于同一线程，也可以被移到独立的网络I/O线程；
+// 解析好的消息通过无锁队列交给 NetworkManager 所在的UI线程。
+class NetworkWorker : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit NetworkWorker(QObject *parent = nullptr);
+    ~NetworkWorker();
+
+    // 把消息编码为带4字节长度头的完整帧，追加到 buffer 末尾。
+    // compressThreshold 非0时，不小于该大小的消息体会尝试压缩并在帧头置压缩标记。
+    static bool appendFrame(const sanguosha::GameMessage& message, std::vector<char>* buffer,
+                            size_t compressThreshold = 0, FrameCompressionStats* stats = nullptr);
+
+    // 可在任意线程调用：把消息直接序列化进发送缓冲区，并安排一次合并写出
+    bool queueMessage(const sanguosha::GameMessage& message, SendPriority priority);
+
+    // 可在任意线程调用
+    bool isConnected() const { return m_connected.load(std::memory_order_acquire); }
+
+    // 可在任意线程调用：服务器在登录响应中确认支持压缩帧后开启，0表示不压缩。
+    // 每次建立连接都会重置为0，需要重新协商。
+    void setCompressThreshold(size_t threshold) { m_compressThreshold.store(threshold, std::memory_order_release); }
+    const FrameCompressionStats& compressionStats() const { return m_compressionStats; }
+
+    // UI线程调用：取出一批已解析的消息，分发完后必须用 recycleBatch 交还
+    bool takeBatch(std::unique_ptr<InboundBatch>& batch);
+    void recycleBatch(std::unique_ptr<InboundBatch> batch);
+    // UI线程调用：开始一轮分发，之后新到达的消息会再次触发 messagesReady
+    void beginDrain();
+
+public slots:
+    void connectToServer(const QString& host, quint16 port);
+    void shutdown();
+    // 开关 TCP_NODELAY；关闭时由内核的 Nagle 算法合并小包
+    void setLowDelay(bool enabled);
+    // 对局进行中缩短心跳间隔
+    void setGameActive(bool active);
+    void setHeartbeatConfig(const HeartbeatConfig& config);
+    // 把收发的每一帧连同单调时间戳追加到录制文件；path 为空时停止录制
+    void setRecordingPath(const QString& path);
+    // 回放录制文件中的入站数据，经过与真实连接相同的分帧、解析和分发；speed 不大于0时全速回放
+    void startReplay(const QString& path, double speed);
+
+signals:
+    void connected();
+    void disconnected();
+    void errorOccurred(const QString& errorString);
+    // 有新消息进入队列；在UI线程取走之前只发出一次
+    void messagesReady();
+    // 收到心跳回显，得到一次往返时延样本（毫秒）
+    void rttSampled(double rttMs);
+    // 连续多次心跳没有回显，判定连接已断
+    void connectionLost();
+    void replayFinished(quint64 frames, quint64 bytes, qint64 elapsedMs);
+
+private slots:
+    void onConnected();
+    void onReadyRead();
+    void onDisconnected();
+    void onErrorOccurred(QAbstractSocket::SocketError error);
+    void onHeartbeatTick();
+    void sendHeartbeat();
+    void flushOutbound();
+
+private:
+    static bool appendCompressedFrame(const sanguosha::GameMessage& message, size_t body_size,
+                                      std::vector<char>* buffer, FrameCompressionStats* stats);
+    void processInbound();
+    void parseMessage(const FrameView& frame);
+    InboundBatch* pendingBatch();
+    void handleHeartbeatEcho(const sanguosha::GameMessage& message);
+
+    QTcpSocket* m_socket;
+    QTimer* m_heartbeatTimer;
+    HeartbeatScheduler m_heartbeat;
+    FrameDecoder m_decoder;
+    SpscQueue<std::unique_ptr<InboundBatch>> m_inbound;
+    SpscQueue<std::unique_ptr<InboundBatch>> m_recycled;   // UI线程分发完交还的批次
+    std::unique_ptr<InboundBatch> m_pending;               // 网络线程正在填充的批次
+    std::atomic<bool> m_drainScheduled;
+    std::atomic<bool> m_connected;
+
+    // 心跳时间戳取自单调时钟（微秒），记录已发出但尚未收到回显的时间戳
+    QElapsedTimer m_clock;
+    std::deque<uint64_t> m_outstandingHeartbeats;
+
+    // 发送缓冲区：调用方线程写入 m_outbound，网络线程与 m_writing 交换后整体写出，
+    // 两块缓冲区都反复复用，不再每条消息分配一次
+    std::mutex m_outboundMutex;
+    std::vector<char> m_outbound;
+    std::vector<char> m_writing;
+    std::atomic<bool> m_flushScheduled;
+    std::atomic<bool> m_urgentFlush;
+    bool m_lowDelay;
+
+    std::atomic<size_t> m_compressThreshold;
+    FrameCompressionStats m_compressionStats;
+
+    std::unique_ptr<TrafficRecorder> m_recorder;
+    TrafficReplayer* m_replayer;
+
+    // 指标在构造时注册一次，收发路径上只做原子累加；按消息类型计数的数组以类型值为下标
+    MetricCounter* m_bytesIn;
+    MetricCounter* m_bytesOut;
+    std::vector<MetricCounter*> m_framesIn;
+    std::vector<MetricCounter*> m_framesOut;
+    MetricHistogram* m_parseTime;
+    MetricHistogram* m_rtt;
+    MetricGauge* m_queueDepth;     // 已解析、等待UI线程分发的消息数
+    MetricCounter* m_messagesParsed; // 解析出的 GameMessage 数量，每条分配在批次 arena 上
+
+    // 进入分发队列的消息序号，用作跟踪的 flow id
+    uint64_t m_pushedSequence;
+};
+
+#endif // NETWORK_WORKER_H
@@ -0,0 +1,18 @@
+#include "reconnectpolicy.h"
+#include <algorithm>
+#include <cmath>
+
+ReconnectPolicy::ReconnectPolicy(const ReconnectConfig& config)
+    : m_config(config),
+      m_attempts(0),
+      m_random(std::random_device{}()) {
+}
+
+int ReconnectPolicy::nextDelayMs() {
+    double ceiling = m_config.initialDelayMs * std::pow(m_config.multiplier, m_attempts);
+    ceiling = std::min(ceiling, static_cast<double>(m_config.maxDelayMs));
+    ++m_attempts;
+
+    std::uniform_real_distribution<double> jitter(ceiling / 2.0, ceiling);
+    return static_cast<int>(jitter(m_random));
+}
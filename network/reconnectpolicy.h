@@ -0,0 +1,34 @@
+#ifndef RECONNECT_POLICY_H
+#define RECONNECT_POLICY_H
+
+#include <cstdint>
+#include <random>
+
+// 重连参数（毫秒）
+struct ReconnectConfig {
+    int initialDelayMs = 500;      // 第一次重连前的等待
+    int maxDelayMs = 30000;        // 等待上限
+    double multiplier = 2.0;       // 每次失败后的放大倍数
+};
+
+// 带随机抖动的指数退避，不依赖Qt。
+// 每次的等待在 [上限/2, 上限] 之间均匀取值，服务器重启后所有客户端不会同时重连。
+class ReconnectPolicy
+{
+public:
+    explicit ReconnectPolicy(const ReconnectConfig& config = ReconnectConfig());
+
+    // 返回下一次重连前应等待的时间，并累加失败次数
+    int nextDelayMs();
+    // 连接并登录成功后调用
+    void reset() { m_attempts = 0; }
+
+    int attempts() const { return m_attempts; }
+
+private:
+    ReconnectConfig m_config;
+    int m_attempts;
+    std::mt19937 m_random;
+};
+
+#endif // RECONNECT_POLICY_H
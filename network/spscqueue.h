@@ -0,0 +1,83 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+// 单生产者/单消费者无锁队列（无界链表实现）。
+// push 只能由一个线程调用，pop 只能由另一个线程调用，两端互不加锁。
+// 消费者越过的节点留在链表头部，由生产者在下次 push 时复用，
+// 稳定运行后队列不再分配内存，节点数只取决于同时在队列中的最大元素数。
+template <typename T>
+class SpscQueue
+{
+public:
+    SpscQueue()
+        : m_head(new Node),
+          m_tail(m_head.load(std::memory_order_relaxed)),
+          m_first(m_tail),
+          m_headCopy(m_tail) {
+    }
+
+    ~SpscQueue() {
+        // 已回收和仍在队列中的节点都在 m_first 开始的同一条链表上
+        while (m_first) {
+            Node* next = m_first->next.load(std::memory_order_relaxed);
+            delete m_first;
+            m_first = next;
+        }
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // 生产者线程调用
+    void push(T value) {
+        Node* node = allocateNode();
+        node->next.store(nullptr, std::memory_order_relaxed);
+        node->value = std::move(value);
+        m_tail->next.store(node, std::memory_order_release);
+        m_tail = node;
+    }
+
+    // 消费者线程调用；队列为空时返回 false
+    bool pop(T& value) {
+        Node* head = m_head.load(std::memory_order_relaxed);
+        Node* next = head->next.load(std::memory_order_acquire);
+        if (!next) {
+            return false;
+        }
+        value = std::move(next->value);
+        // next 成为新的哨兵节点，旧哨兵交给生产者复用
+        m_head.store(next, std::memory_order_release);
+        return true;
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    // 生产者线程调用：优先取消费者已经越过的节点，只在没有可复用节点时分配
+    Node* allocateNode() {
+        if (m_first == m_headCopy) {
+            m_headCopy = m_head.load(std::memory_order_acquire);
+            if (m_first == m_headCopy) {
+                return new Node;
+            }
+        }
+        Node* node = m_first;
+        m_first = m_first->next.load(std::memory_order_relaxed);
+        return node;
+    }
+
+    // 消费者与生产者各自独占的游标放在不同缓存行，避免伪共享。
+    // m_head 由消费者推进、生产者读取；其余成员只由生产者访问
+    alignas(64) std::atomic<Node*> m_head;
+    alignas(64) Node* m_tail;
+    Node* m_first;      // 最早的可复用节点
+    Node* m_headCopy;   // 生产者缓存的 m_head，减少跨核读取
+};
+
+#endif // SPSC_QUEUE_H
@@ -0,0 +1,119 @@
+#include "tracing.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace {
+std::atomic<uint32_t> g_nextThreadId{1};
+thread_local uint32_t t_threadId = 0;
+thread_local uint64_t t_currentFlow = 0;
+
+const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+}
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+Tracer::Tracer()
+    : m_maxEvents(0),
+      m_dropped(0) {
+}
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::start(size_t maxEvents) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.clear();
+    m_events.reserve(std::min<size_t>(maxEvents, 64 * 1024));
+    m_maxEvents = maxEvents;
+    m_dropped = 0;
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+bool Tracer::stop(const std::string& path) {
+    s_enabled.store(false, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    const char* separator = "";
+    for (const auto& entry : m_threadNames) {
+        std::fprintf(file, "%s{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                     separator, entry.first, entry.second.c_str());
+        separator = ",\n";
+    }
+    for (const Event& event : m_events) {
+        if (event.phase == 'X') {
+            std::fprintf(file, "%s{\"ph\":\"X\",\"cat\":\"%s\",\"name\":\"%s\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"dur\":%llu}",
+                         separator, event.category, event.name, event.tid,
+                         static_cast<unsigned long long>(event.timestampUs),
+                         static_cast<unsigned long long>(event.durationUs));
+        } else {
+            // 流事件绑定到同一线程上包含它的区间，结束事件用 "bp":"e" 绑定到包含它的区间而不是下一个区间
+            std::fprintf(file, "%s{\"ph\":\"%c\",\"cat\":\"message\",\"name\":\"GameMessage\",\"pid\":1,\"tid\":%u,\"ts\":%llu,\"id\":%llu%s}",
+                         separator, event.phase, event.tid,
+                         static_cast<unsigned long long>(event.timestampUs),
+                         static_cast<unsigned long long>(event.id),
+                         event.phase == static_cast<char>(FlowPhase::End) ? ",\"bp\":\"e\"" : "");
+        }
+        separator = ",\n";
+    }
+    std::fprintf(file, "\n],\"otherData\":{\"droppedEvents\":%llu}}\n", static_cast<unsigned long long>(m_dropped));
+    bool ok = std::ferror(file) == 0;
+    ok = std::fclose(file) == 0 && ok;
+    m_events.clear();
+    m_events.shrink_to_fit();
+    return ok;
+}
+
+uint64_t Tracer::nowUs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - g_epoch).count());
+}
+
+void Tracer::addComplete(const char* category, const char* name, uint64_t startUs, uint64_t durationUs) {
+    append(Event{ category, name, 'X', currentThreadId(), startUs, durationUs, 0 });
+}
+
+void Tracer::addFlow(FlowPhase phase, uint64_t id) {
+    append(Event{ nullptr, nullptr, static_cast<char>(phase), currentThreadId(), nowUs(), 0, id });
+}
+
+void Tracer::setThreadName(const std::string& name) {
+    uint32_t tid = currentThreadId();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_threadNames[tid] = name;
+}
+
+void Tracer::setCurrentFlow(uint64_t id) {
+    t_currentFlow = id;
+}
+
+uint64_t Tracer::currentFlow() {
+    return t_currentFlow;
+}
+
+void Tracer::append(const Event& event) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // 停止之后仍在进行的区间不再记录
+    if (!s_enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (m_events.size() >= m_maxEvents) {
+        ++m_dropped;
+        return;
+    }
+    m_events.push_back(event);
+}
+
+uint32_t Tracer::currentThreadId() {
+    if (t_threadId == 0) {
+        t_threadId = g_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+    return t_threadId;
+}
@@ -0,0 +1,105 @@
+#ifndef TRACING_H
+#define TRACING_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// 按 Chrome trace_event 格式记录耗时区间，结果可以直接在 Perfetto / chrome://tracing 中打开。
+// 默认关闭，关闭时每个埋点只有一次原子读；定义 SANGUOSHA_NO_TRACING 时埋点在编译期完全去掉。
+// 一条入站消息从解析到分发再到重绘用同一个 flow id 串起来，id 为该消息进入分发队列的序号。
+
+class Tracer
+{
+public:
+    // 流事件的阶段：开始、中间步骤、结束
+    enum class FlowPhase : char {
+        Start = 's',
+        Step = 't',
+        End = 'f'
+    };
+
+    static Tracer& instance();
+
+#ifdef SANGUOSHA_NO_TRACING
+    static bool enabled() { return false; }
+#else
+    static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+#endif
+
+    // 开始收集；超过 maxEvents 的事件被丢弃并计数，长时间开启也不会无限占用内存
+    void start(size_t maxEvents = 1 << 20);
+    // 停止收集并把已收集的事件写成JSON
+    bool stop(const std::string& path);
+
+    // 单调时钟，微秒
+    static uint64_t nowUs();
+
+    // name/category 必须是字符串字面量，只保存指针
+    void addComplete(const char* category, const char* name, uint64_t startUs, uint64_t durationUs);
+    void addFlow(FlowPhase phase, uint64_t id);
+
+    // 为当前线程命名，显示在轨道标题上；可以在开始收集之前调用
+    void setThreadName(const std::string& name);
+
+    // 当前线程最近分发的消息的 flow id，供界面更新和重绘接续
+    static void setCurrentFlow(uint64_t id);
+    static uint64_t currentFlow();
+
+private:
+    Tracer();
+
+    struct Event {
+        const char* category;
+        const char* name;
+        char phase;
+        uint32_t tid;
+        uint64_t timestampUs;
+        uint64_t durationUs;
+        uint64_t id;
+    };
+
+    void append(const Event& event);
+    static uint32_t currentThreadId();
+
+    static std::atomic<bool> s_enabled;
+
+    std::mutex m_mutex;
+    std::vector<Event> m_events;
+    std::map<uint32_t, std::string> m_threadNames;
+    size_t m_maxEvents;
+    uint64_t m_dropped;
+};
+
+// 作用域内的耗时区间；开始时未开启跟踪则析构时什么也不做
+class TraceSpan
+{
+public:
+    TraceSpan(const char* category, const char* name)
+        : m_category(category),
+          m_name(Tracer::enabled() ? name : nullptr),
+          m_startUs(m_name ? Tracer::nowUs() : 0) {}
+    ~TraceSpan() {
+        if (m_name) {
+            Tracer::instance().addComplete(m_category, m_name, m_startUs, Tracer::nowUs() - m_startUs);
+        }
+    }
+
+private:
+    const char* m_category;
+    const char* m_name;
+    uint64_t m_startUs;
+};
+
+#ifdef SANGUOSHA_NO_TRACING
+#define TRACE_SPAN(category, name) ((void)0)
+#else
+#define TRACE_SPAN_CONCAT_INNER(a, b) a##b
+#define TRACE_SPAN_CONCAT(a, b) TRACE_SPAN_CONCAT_INNER(a, b)
+#define TRACE_SPAN(category, name) TraceSpan TRACE_SPAN_CONCAT(traceSpan_, __LINE__)(category, name)
+#endif
+
+#endif // TRACING_H
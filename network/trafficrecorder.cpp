@@ -0,0 +1,173 @@
+#include "trafficrecorder.h"
+#include <cstring>
+
+namespace {
+const char kMagic[8] = { 'S', 'G', 'S', 'T', 'R', 'A', 'C', 'E' };
+const uint8_t kVersion = 1;
+const size_t kWriteBufferSize = 64 * 1024;
+// 单条记录的上限，损坏的文件不会导致超大分配。入站记录是一帧，不超过帧解码器的最大帧（16 MiB）；
+// 出站记录是一次合并写出的若干帧，可能超过单帧上限，所以这里放宽到 64 MiB
+const uint64_t kMaxRecordSize = 64 * 1024 * 1024;
+}
+
+TrafficRecorder::TrafficRecorder()
+    : m_file(nullptr),
+      m_lastTimestampUs(0) {
+}
+
+TrafficRecorder::~TrafficRecorder() {
+    close();
+}
+
+bool TrafficRecorder::open(const std::string& path) {
+    close();
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        return false;
+    }
+    m_buffer.resize(kWriteBufferSize);
+    std::setvbuf(m_file, m_buffer.data(), _IOFBF, m_buffer.size());
+    std::fwrite(kMagic, 1, sizeof(kMagic), m_file);
+    std::fputc(kVersion, m_file);
+    m_lastTimestampUs = 0;
+    return true;
+}
+
+void TrafficRecorder::close() {
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+void TrafficRecorder::recordFrame(TrafficDirection direction, uint64_t timestampUs, const FrameView& frame) {
+    if (!m_file) {
+        return;
+    }
+    // 按线上格式还原帧头，录制文件可以原样交给帧解码器
+    uint32_t header = static_cast<uint32_t>(frame.size());
+    if (frame.compressed) {
+        header |= FrameDecoder::kCompressedFlag;
+    }
+    const unsigned char netHeader[4] = {
+        static_cast<unsigned char>(header >> 24), static_cast<unsigned char>(header >> 16),
+        static_cast<unsigned char>(header >> 8), static_cast<unsigned char>(header)
+    };
+
+    writeHeader(direction, timestampUs, sizeof(netHeader) + frame.size());
+    std::fwrite(netHeader, 1, sizeof(netHeader), m_file);
+    std::fwrite(frame.first, 1, frame.firstSize, m_file);
+    if (frame.secondSize > 0) {
+        std::fwrite(frame.second, 1, frame.secondSize, m_file);
+    }
+}
+
+void TrafficRecorder::recordData(TrafficDirection direction, uint64_t timestampUs, const char* data, size_t size) {
+    if (!m_file) {
+        return;
+    }
+    writeHeader(direction, timestampUs, size);
+    std::fwrite(data, 1, size, m_file);
+}
+
+void TrafficRecorder::writeHeader(TrafficDirection direction, uint64_t timestampUs, size_t size) {
+    uint64_t delta = timestampUs >= m_lastTimestampUs ? timestampUs - m_lastTimestampUs : 0;
+    m_lastTimestampUs = timestampUs >= m_lastTimestampUs ? timestampUs : m_lastTimestampUs;
+    writeVarint(delta);
+    std::fputc(static_cast<int>(direction), m_file);
+    writeVarint(size);
+}
+
+void TrafficRecorder::writeVarint(uint64_t value) {
+    while (value >= 0x80) {
+        std::fputc(static_cast<int>((value & 0x7f) | 0x80), m_file);
+        value >>= 7;
+    }
+    std::fputc(static_cast<int>(value), m_file);
+}
+
+TrafficReader::TrafficReader()
+    : m_file(nullptr),
+      m_timestampUs(0),
+      m_error(false) {
+}
+
+TrafficReader::~TrafficReader() {
+    close();
+}
+
+bool TrafficReader::open(const std::string& path) {
+    close();
+    m_error = false;
+    m_timestampUs = 0;
+    m_file = std::fopen(path.c_str(), "rb");
+    if (!m_file) {
+        return false;
+    }
+    char magic[sizeof(kMagic)];
+    int version = 0;
+    if (std::fread(magic, 1, sizeof(magic), m_file) != sizeof(magic)
+            || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0
+            || (version = std::fgetc(m_file)) != kVersion) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void TrafficReader::close() {
+    if (m_file) {
+        std::fclose(m_file);
+        m_file = nullptr;
+    }
+}
+
+bool TrafficReader::next(TrafficRecord* record) {
+    if (!m_file || m_error) {
+        return false;
+    }
+
+    uint64_t delta = 0;
+    if (!readVarint(&delta)) {
+        // 在记录边界处结束是正常的文件末尾
+        if (!std::feof(m_file)) {
+            m_error = true;
+        }
+        return false;
+    }
+    int direction = std::fgetc(m_file);
+    uint64_t size = 0;
+    if (direction < 0 || direction > 1 || !readVarint(&size) || size > kMaxRecordSize) {
+        m_error = true;
+        return false;
+    }
+
+    record->data.resize(static_cast<size_t>(size));
+    if (size > 0 && std::fread(record->data.data(), 1, record->data.size(), m_file) != record->data.size()) {
+        m_error = true;
+        return false;
+    }
+    m_timestampUs += delta;
+    record->timestampUs = m_timestampUs;
+    record->direction = static_cast<TrafficDirection>(direction);
+    return true;
+}
+
+bool TrafficReader::readVarint(uint64_t* value) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        int byte = std::fgetc(m_file);
+        if (byte < 0) {
+            if (shift > 0) {
+                m_error = true;
+            }
+            return false;
+        }
+        *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    m_error = true;
+    return false;
+}
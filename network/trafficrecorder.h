@@ -0,0 +1,71 @@
+#ifndef TRAFFIC_RECORDER_H
+#define TRAFFIC_RECORDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "framedecoder.h"
+
+// 会话录制文件格式（不依赖Qt）：
+//   文件头：8字节魔数 "SGSTRACE"，1字节版本号
+//   每条记录：varint 距上一条的时间差（微秒）、1字节方向、varint 数据长度、数据
+// 入站记录是一帧完整的线上数据（含4字节帧头），出站记录是一次合并写出的若干完整帧。
+enum class TrafficDirection : uint8_t {
+    Inbound = 0,
+    Outbound = 1
+};
+
+struct TrafficRecord {
+    uint64_t timestampUs = 0;   // 相对录制开始的单调时间
+    TrafficDirection direction = TrafficDirection::Inbound;
+    std::vector<char> data;
+};
+
+// 追加写入的录制器：数据经过固定大小的 stdio 缓冲区直接流向文件，内存占用有上限
+class TrafficRecorder
+{
+public:
+    TrafficRecorder();
+    ~TrafficRecorder();
+
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_file != nullptr; }
+
+    void recordFrame(TrafficDirection direction, uint64_t timestampUs, const FrameView& frame);
+    void recordData(TrafficDirection direction, uint64_t timestampUs, const char* data, size_t size);
+
+private:
+    void writeHeader(TrafficDirection direction, uint64_t timestampUs, size_t size);
+    void writeVarint(uint64_t value);
+
+    std::FILE* m_file;
+    std::vector<char> m_buffer;   // 交给 setvbuf 的写缓冲区
+    uint64_t m_lastTimestampUs;
+};
+
+// 顺序读取录制文件，每次只在内存中保留一条记录
+class TrafficReader
+{
+public:
+    TrafficReader();
+    ~TrafficReader();
+
+    bool open(const std::string& path);
+    void close();
+
+    // 读到文件末尾或文件损坏时返回 false，可用 hasError() 区分
+    bool next(TrafficRecord* record);
+    bool hasError() const { return m_error; }
+
+private:
+    bool readVarint(uint64_t* value);
+
+    std::FILE* m_file;
+    uint64_t m_timestampUs;
+    bool m_error;
+};
+
+#endif // TRAFFIC_RECORDER_H
@@ -0,0 +1,49 @@
+#ifndef TRAFFIC_REPLAYER_H
+#define TRAFFIC_REPLAYER_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+#include <functional>
+#include "trafficrecorder.h"
+
+// 把录制文件中的入站数据按原始时间间隔（或按倍速、或尽可能快）交给 sink，
+// sink 通常是网络工作者的帧解码器，之后的解析、分发和界面更新与真实连接完全相同。
+class TrafficReplayer : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Sink = std::function<void(const char* data, size_t size)>;
+
+    explicit TrafficReplayer(Sink sink, QObject *parent = nullptr);
+
+    // speed 为回放倍速，不大于0时不等待、以最快速度回放
+    bool start(const QString& path, double speed);
+    void stop();
+    bool isRunning() const { return m_running; }
+
+signals:
+    // 回放结束，frames/bytes 为交给 sink 的入站帧数和字节数
+    void finished(quint64 frames, quint64 bytes, qint64 elapsedMs);
+
+private slots:
+    void deliverDue();
+
+private:
+    void finish();
+
+    Sink m_sink;
+    TrafficReader m_reader;
+    TrafficRecord m_next;
+    QTimer* m_timer;
+    QElapsedTimer m_clock;
+    double m_speed;
+    uint64_t m_baseUs;
+    quint64 m_frames;
+    quint64 m_bytes;
+    bool m_hasNext;
+    bool m_running;
+};
+
+#endif // TRAFFIC_REPLAYER_H
@@ -0,0 +1,122 @@
+#include "playertablemodel.h"
+#include <QBrush>
+#include <QColor>
+
+PlayerTableModel::PlayerTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+int PlayerTableModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+int PlayerTableModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : ColumnCount;
+}
+
+QVariant PlayerTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size()) {
+        return QVariant();
+    }
+
+    const PlayerRow &row = m_rows[index.row()];
+    const bool dead = (row.hp == 0);
+
+    switch (role) {
+    case Qt::DisplayRole:
+        switch (index.column()) {
+        case IdColumn: return QString::number(row.playerId);
+        case NameColumn: return row.username;
+        case HpColumn: return QString("%1/%2").arg(row.hp).arg(row.maxHp);
+        default: return QVariant();
+        }
+    case Qt::BackgroundRole:
+        // 血量为0特殊标记，当前玩家整行高亮
+        if (index.column() == HpColumn && dead) {
+            return QBrush(Qt::red);
+        }
+        return QBrush(row.isCurrent ? Qt::yellow : Qt::white);
+    case Qt::ForegroundRole:
+        if (index.column() == HpColumn && dead) {
+            return QBrush(Qt::white);
+        }
+        return QBrush(Qt::black);
+    default:
+        return QVariant();
+    }
+}
+
+QVariant PlayerTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if (orientation != Qt::Horizontal || role != Qt::DisplayRole) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+
+    switch (section) {
+    case IdColumn: return tr("ID");
+    case NameColumn: return tr("名称");
+    case HpColumn: return tr("血量");
+    default: return QVariant();
+    }
+}
+
+void PlayerTableModel::updateFromState(const ClientGameState &state)
+{
+    const int newCount = state.playerCount();
+
+    // 行数变化时只在末尾插入或删除
+    if (newCount > m_rows.size()) {
+        beginInsertRows(QModelIndex(), m_rows.size(), newCount - 1);
+        m_rows.resize(newCount);
+        endInsertRows();
+    } else if (newCount < m_rows.size()) {
+        beginRemoveRows(QModelIndex(), newCount, m_rows.size() - 1);
+        m_rows.resize(newCount);
+        endRemoveRows();
+    }
+
+    for (int i = 0; i < newCount; ++i) {
+        const ClientPlayer &player = state.playerAt(i);
+        PlayerRow &row = m_rows[i];
+        const bool isCurrent = (player.playerId == state.currentPlayer());
+
+        // 当前玩家变化影响整行背景
+        if (row.isCurrent != isCurrent) {
+            row.isCurrent = isCurrent;
+            emitCellChanged(i, IdColumn, HpColumn);
+        }
+        if (row.playerId != player.playerId) {
+            row.playerId = player.playerId;
+            emitCellChanged(i, IdColumn, IdColumn);
+        }
+        if (row.rawUsername != player.username) {
+            row.rawUsername = player.username;
+            row.username = QString::fromStdString(row.rawUsername);
+            emitCellChanged(i, NameColumn, NameColumn);
+        }
+        if (row.hp != player.hp || row.maxHp != player.maxHp) {
+            row.hp = player.hp;
+            row.maxHp = player.maxHp;
+            emitCellChanged(i, HpColumn, HpColumn);
+        }
+    }
+}
+
+void PlayerTableModel::clear()
+{
+    if (m_rows.isEmpty()) {
+        return;
+    }
+    beginRemoveRows(QModelIndex(), 0, m_rows.size() - 1);
+    m_rows.clear();
+    endRemoveRows();
+}
+
+void PlayerTableModel::emitCellChanged(int row, int firstColumn, int lastColumn)
+{
+    emit dataChanged(index(row, firstColumn), index(row, lastColumn));
+}
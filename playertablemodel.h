@@ -0,0 +1,49 @@
+#ifndef PLAYERTABLEMODEL_H
+#define PLAYERTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QVector>
+#include <string>
+#include "game/clientgamestate.h"
+
+// 玩家信息表的数据模型。每次对局状态更新后原地更新各行，
+// 只对 ID/名称/血量/当前玩家高亮真正变化的单元格发出 dataChanged。
+class PlayerTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum Column {
+        IdColumn = 0,
+        NameColumn,
+        HpColumn,
+        ColumnCount
+    };
+
+    explicit PlayerTableModel(QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation,
+                        int role = Qt::DisplayRole) const override;
+
+    void updateFromState(const ClientGameState &state);
+    void clear();
+
+private:
+    struct PlayerRow {
+        uint32_t playerId = 0;
+        QString username;
+        std::string rawUsername;   // 用于比较，避免每次更新都转换编码
+        uint32_t hp = 0;
+        uint32_t maxHp = 0;
+        bool isCurrent = false;
+    };
+
+    void emitCellChanged(int row, int firstColumn, int lastColumn);
+
+    QVector<PlayerRow> m_rows;
+};
+
+#endif // PLAYERTABLEMODEL_H
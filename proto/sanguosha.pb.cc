@@ -5,565 +5,626 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace protobuf_sanguosha_2eproto {
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_GameAction;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_GameOver;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_GameStart;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_Heartbeat;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_LoginRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_LoginResponse;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_PlayerState;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RoomInfo;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<0> scc_info_RoomRequest;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_GameState;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_RoomListResponse;
-extern PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto ::google::protobuf::internal::SCCInfo<1> scc_info_RoomResponse;
-}  // namespace protobuf_sanguosha_2eproto
-namespace sanguosha {
-class LoginRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<LoginRequest>
-      _instance;
-} _LoginRequest_default_instance_;
-class LoginResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<LoginResponse>
-      _instance;
-} _LoginResponse_default_instance_;
-class HeartbeatDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<Heartbeat>
-      _instance;
-} _Heartbeat_default_instance_;
-class RoomInfoDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RoomInfo>
-      _instance;
-} _RoomInfo_default_instance_;
-class RoomRequestDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RoomRequest>
-      _instance;
-} _RoomRequest_default_instance_;
-class RoomResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RoomResponse>
-      _instance;
-} _RoomResponse_default_instance_;
-class RoomListResponseDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<RoomListResponse>
-      _instance;
-} _RoomListResponse_default_instance_;
-class GameActionDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GameAction>
-      _instance;
-} _GameAction_default_instance_;
-class PlayerStateDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<PlayerState>
-      _instance;
-} _PlayerState_default_instance_;
-class GameStateDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GameState>
-      _instance;
-} _GameState_default_instance_;
-class GameStartDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GameStart>
-      _instance;
-} _GameStart_default_instance_;
-class GameMessageDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GameMessage>
-      _instance;
-  const ::sanguosha::LoginRequest* login_request_;
-  const ::sanguosha::LoginResponse* login_response_;
-  const ::sanguosha::Heartbeat* heartbeat_;
-  const ::sanguosha::RoomRequest* room_request_;
-  const ::sanguosha::RoomResponse* room_response_;
-  const ::sanguosha::GameAction* game_action_;
-  const ::sanguosha::GameState* game_state_;
-  const ::sanguosha::GameStart* game_start_;
-  const ::sanguosha::GameOver* game_over_;
-  const ::sanguosha::RoomListResponse* room_list_response_;
-} _GameMessage_default_instance_;
-class GameOverDefaultTypeInternal {
- public:
-  ::google::protobuf::internal::ExplicitlyConstructed<GameOver>
-      _instance;
-} _GameOver_default_instance_;
-}  // namespace sanguosha
-namespace protobuf_sanguosha_2eproto {
-static void InitDefaultsLoginRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_LoginRequest_default_instance_;
-    new (ptr) ::sanguosha::LoginRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::LoginRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_LoginRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsLoginRequest}, {}};
-
-static void InitDefaultsLoginResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_LoginResponse_default_instance_;
-    new (ptr) ::sanguosha::LoginResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::LoginResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_LoginResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsLoginResponse}, {}};
-
-static void InitDefaultsHeartbeat() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_Heartbeat_default_instance_;
-    new (ptr) ::sanguosha::Heartbeat();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::Heartbeat::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_Heartbeat =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsHeartbeat}, {}};
-
-static void InitDefaultsRoomInfo() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_RoomInfo_default_instance_;
-    new (ptr) ::sanguosha::RoomInfo();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::RoomInfo::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RoomInfo =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRoomInfo}, {}};
-
-static void InitDefaultsRoomRequest() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_RoomRequest_default_instance_;
-    new (ptr) ::sanguosha::RoomRequest();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::RoomRequest::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_RoomRequest =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsRoomRequest}, {}};
-
-static void InitDefaultsRoomResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_RoomResponse_default_instance_;
-    new (ptr) ::sanguosha::RoomResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::RoomResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_RoomResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsRoomResponse}, {
-      &protobuf_sanguosha_2eproto::scc_info_RoomInfo.base,}};
-
-static void InitDefaultsRoomListResponse() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_RoomListResponse_default_instance_;
-    new (ptr) ::sanguosha::RoomListResponse();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::RoomListResponse::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_RoomListResponse =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsRoomListResponse}, {
-      &protobuf_sanguosha_2eproto::scc_info_RoomInfo.base,}};
-
-static void InitDefaultsGameAction() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_GameAction_default_instance_;
-    new (ptr) ::sanguosha::GameAction();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::GameAction::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GameAction =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGameAction}, {}};
-
-static void InitDefaultsPlayerState() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_PlayerState_default_instance_;
-    new (ptr) ::sanguosha::PlayerState();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::PlayerState::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_PlayerState =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsPlayerState}, {}};
-
-static void InitDefaultsGameState() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_GameState_default_instance_;
-    new (ptr) ::sanguosha::GameState();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::GameState::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<1> scc_info_GameState =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsGameState}, {
-      &protobuf_sanguosha_2eproto::scc_info_PlayerState.base,}};
-
-static void InitDefaultsGameStart() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_GameStart_default_instance_;
-    new (ptr) ::sanguosha::GameStart();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::GameStart::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GameStart =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGameStart}, {}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsGameMessage() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::sanguosha::_GameMessage_default_instance_;
-    new (ptr) ::sanguosha::GameMessage();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::GameMessage::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<10> scc_info_GameMessage =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 10, InitDefaultsGameMessage}, {
-      &protobuf_sanguosha_2eproto::scc_info_LoginRequest.base,
-      &protobuf_sanguosha_2eproto::scc_info_LoginResponse.base,
-      &protobuf_sanguosha_2eproto::scc_info_Heartbeat.base,
-      &protobuf_sanguosha_2eproto::scc_info_RoomRequest.base,
-      &protobuf_sanguosha_2eproto::scc_info_RoomResponse.base,
-      &protobuf_sanguosha_2eproto::scc_info_GameAction.base,
-      &protobuf_sanguosha_2eproto::scc_info_GameState.base,
-      &protobuf_sanguosha_2eproto::scc_info_GameStart.base,
-      &protobuf_sanguosha_2eproto::scc_info_GameOver.base,
-      &protobuf_sanguosha_2eproto::scc_info_RoomListResponse.base,}};
-
-static void InitDefaultsGameOver() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::sanguosha::_GameOver_default_instance_;
-    new (ptr) ::sanguosha::GameOver();
-    ::google::protobuf::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::sanguosha::GameOver::InitAsDefaultInstance();
-}
-
-::google::protobuf::internal::SCCInfo<0> scc_info_GameOver =
-    {{ATOMIC_VAR_INIT(::google::protobuf::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsGameOver}, {}};
-
-void InitDefaults() {
-  ::google::protobuf::internal::InitSCC(&scc_info_LoginRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_LoginResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_Heartbeat.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RoomInfo.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RoomRequest.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RoomResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_RoomListResponse.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GameAction.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_PlayerState.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GameState.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GameStart.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GameMessage.base);
-  ::google::protobuf::internal::InitSCC(&scc_info_GameOver.base);
-}
-
-::google::protobuf::Metadata file_level_metadata[13];
-const ::google::protobuf::EnumDescriptor* file_level_enum_descriptors[6];
+namespace sanguosha {
+PROTOBUF_CONSTEXPR LoginRequest::LoginRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.password_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.resume_token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.capabilities_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LoginRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LoginRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LoginRequestDefaultTypeInternal() {}
+  union {
+    LoginRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
+PROTOBUF_CONSTEXPR LoginResponse::LoginResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.resume_token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/0u
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.resumed_)*/false
+  , /*decltype(_impl_.capabilities_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LoginResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LoginResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LoginResponseDefaultTypeInternal() {}
+  union {
+    LoginResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
+PROTOBUF_CONSTEXPR Heartbeat::Heartbeat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.timestamp_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HeartbeatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeartbeatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeartbeatDefaultTypeInternal() {}
+  union {
+    Heartbeat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
+PROTOBUF_CONSTEXPR RoomInfo::RoomInfo(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.players_)*/{}
+  , /*decltype(_impl_._players_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.room_id_)*/0u
+  , /*decltype(_impl_.current_players_)*/0u
+  , /*decltype(_impl_.max_players_)*/0u
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomInfoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomInfoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomInfoDefaultTypeInternal() {}
+  union {
+    RoomInfo _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
+PROTOBUF_CONSTEXPR RoomRequest::RoomRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.action_)*/0
+  , /*decltype(_impl_.room_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomRequestDefaultTypeInternal() {}
+  union {
+    RoomRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
+PROTOBUF_CONSTEXPR RoomResponse::RoomResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.error_message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.room_info_)*/nullptr
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomResponseDefaultTypeInternal() {}
+  union {
+    RoomResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomResponseDefaultTypeInternal _RoomResponse_default_instance_;
+PROTOBUF_CONSTEXPR RoomListResponse::RoomListResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rooms_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomListResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomListResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomListResponseDefaultTypeInternal() {}
+  union {
+    RoomListResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomListResponseDefaultTypeInternal _RoomListResponse_default_instance_;
+PROTOBUF_CONSTEXPR GameAction::GameAction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.card_id_)*/0u
+  , /*decltype(_impl_.target_player_)*/0u
+  , /*decltype(_impl_.sequence_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameActionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameActionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameActionDefaultTypeInternal() {}
+  union {
+    GameAction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameActionDefaultTypeInternal _GameAction_default_instance_;
+PROTOBUF_CONSTEXPR PlayerState::PlayerState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.hand_cards_)*/{}
+  , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.hp_)*/0u
+  , /*decltype(_impl_.max_hp_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PlayerStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerStateDefaultTypeInternal() {}
+  union {
+    PlayerState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerStateDefaultTypeInternal _PlayerState_default_instance_;
+PROTOBUF_CONSTEXPR GameState::GameState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.players_)*/{}
+  , /*decltype(_impl_.game_log_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.current_player_)*/0u
+  , /*decltype(_impl_.phase_)*/0
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.acked_sequence_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStateDefaultTypeInternal() {}
+  union {
+    GameState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStateDefaultTypeInternal _GameState_default_instance_;
+PROTOBUF_CONSTEXPR PlayerStateDelta::PlayerStateDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hand_cards_)*/{}
+  , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.player_id_)*/0u
+  , /*decltype(_impl_.hp_)*/0u
+  , /*decltype(_impl_.max_hp_)*/0u
+  , /*decltype(_impl_.hand_cards_changed_)*/false} {}
+struct PlayerStateDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PlayerStateDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PlayerStateDeltaDefaultTypeInternal() {}
+  union {
+    PlayerStateDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PlayerStateDeltaDefaultTypeInternal _PlayerStateDelta_default_instance_;
+PROTOBUF_CONSTEXPR GameStateDelta::GameStateDelta(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.players_)*/{}
+  , /*decltype(_impl_.removed_players_)*/{}
+  , /*decltype(_impl_._removed_players_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.game_log_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.base_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.current_player_)*/0u
+  , /*decltype(_impl_.phase_)*/0
+  , /*decltype(_impl_.acked_sequence_)*/0u} {}
+struct GameStateDeltaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStateDeltaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStateDeltaDefaultTypeInternal() {}
+  union {
+    GameStateDelta _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStateDeltaDefaultTypeInternal _GameStateDelta_default_instance_;
+PROTOBUF_CONSTEXPR GameStateRequest::GameStateRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.known_version_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameStateRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStateRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStateRequestDefaultTypeInternal() {}
+  union {
+    GameStateRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStateRequestDefaultTypeInternal _GameStateRequest_default_instance_;
+PROTOBUF_CONSTEXPR GameStart::GameStart(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.player_ids_)*/{}
+  , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.room_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameStartDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameStartDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameStartDefaultTypeInternal() {}
+  union {
+    GameStart _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameStartDefaultTypeInternal _GameStart_default_instance_;
+PROTOBUF_CONSTEXPR MessageBatch::MessageBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct MessageBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MessageBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MessageBatchDefaultTypeInternal() {}
+  union {
+    MessageBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
+PROTOBUF_CONSTEXPR GameMessage::GameMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.content_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct GameMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameMessageDefaultTypeInternal() {}
+  union {
+    GameMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameMessageDefaultTypeInternal _GameMessage_default_instance_;
+PROTOBUF_CONSTEXPR GameOver::GameOver(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.winner_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GameOverDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GameOverDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GameOverDefaultTypeInternal() {}
+  union {
+    GameOver _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GameOverDefaultTypeInternal _GameOver_default_instance_;
+}  // namespace sanguosha
+static ::_pb::Metadata file_level_metadata_sanguosha_2eproto[17];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_sanguosha_2eproto[7];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_sanguosha_2eproto = nullptr;
 
-const ::google::protobuf::uint32 TableStruct::offsets[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
+const uint32_t TableStruct_sanguosha_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginRequest, _impl_.password_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginRequest, _impl_.capabilities_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginRequest, _impl_.resume_token_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.error_message_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.capabilities_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.resume_token_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::LoginResponse, _impl_.resumed_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::Heartbeat, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginRequest, username_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginRequest, password_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::Heartbeat, _impl_.timestamp_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginResponse, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginResponse, error_message_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::LoginResponse, user_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _impl_.room_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _impl_.players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _impl_.current_players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _impl_.max_players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomInfo, _impl_.status_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::Heartbeat, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::Heartbeat, timestamp_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomRequest, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomRequest, _impl_.room_id_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, room_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, players_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, current_players_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, max_players_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomInfo, status_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomResponse, _impl_.success_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomResponse, _impl_.error_message_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomResponse, _impl_.room_info_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomRequest, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomListResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomRequest, action_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomRequest, room_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::RoomListResponse, _impl_.rooms_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameAction, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomResponse, success_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomResponse, error_message_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomResponse, room_info_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameAction, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameAction, _impl_.card_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameAction, _impl_.target_player_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameAction, _impl_.sequence_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomListResponse, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::RoomListResponse, rooms_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _impl_.hp_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _impl_.max_hp_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerState, _impl_.hand_cards_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameAction, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.current_player_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.game_log_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameState, _impl_.acked_sequence_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameAction, type_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameAction, card_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameAction, target_player_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.player_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.hp_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.max_hp_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.hand_cards_changed_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::PlayerStateDelta, _impl_.hand_cards_),
+  ~0u,
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.base_version_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.current_player_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.phase_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.removed_players_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.game_log_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateDelta, _impl_.acked_sequence_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, player_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, username_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, hp_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, max_hp_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::PlayerState, hand_cards_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStateRequest, _impl_.known_version_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameState, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStart, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameState, current_player_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameState, players_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameState, phase_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameState, game_log_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStart, _impl_.room_id_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameStart, _impl_.player_ids_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameStart, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::MessageBatch, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameStart, room_id_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameStart, player_ids_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::MessageBatch, _impl_.messages_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameMessage, _internal_metadata_),
   ~0u,  // no _extensions_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameMessage, _oneof_case_[0]),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameMessage, _impl_._oneof_case_[0]),
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameMessage, type_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, login_request_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, login_response_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, heartbeat_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, room_request_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, room_response_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, game_action_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, game_state_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, game_start_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, game_over_),
-  offsetof(::sanguosha::GameMessageDefaultTypeInternal, room_list_response_),
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameMessage, content_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameMessage, _impl_.type_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameMessage, _impl_.content_),
   ~0u,  // no _has_bits_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameOver, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameOver, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(::sanguosha::GameOver, winner_id_),
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::sanguosha::GameOver, _impl_.winner_id_),
 };
-static const ::google::protobuf::internal::MigrationSchema schemas[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::sanguosha::LoginRequest)},
-  { 7, -1, sizeof(::sanguosha::LoginResponse)},
-  { 15, -1, sizeof(::sanguosha::Heartbeat)},
-  { 21, -1, sizeof(::sanguosha::RoomInfo)},
-  { 31, -1, sizeof(::sanguosha::RoomRequest)},
-  { 38, -1, sizeof(::sanguosha::RoomResponse)},
-  { 46, -1, sizeof(::sanguosha::RoomListResponse)},
-  { 52, -1, sizeof(::sanguosha::GameAction)},
-  { 60, -1, sizeof(::sanguosha::PlayerState)},
-  { 70, -1, sizeof(::sanguosha::GameState)},
-  { 79, -1, sizeof(::sanguosha::GameStart)},
-  { 86, -1, sizeof(::sanguosha::GameMessage)},
-  { 103, -1, sizeof(::sanguosha::GameOver)},
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::sanguosha::LoginRequest)},
+  { 10, -1, -1, sizeof(::sanguosha::LoginResponse)},
+  { 22, -1, -1, sizeof(::sanguosha::Heartbeat)},
+  { 29, -1, -1, sizeof(::sanguosha::RoomInfo)},
+  { 40, -1, -1, sizeof(::sanguosha::RoomRequest)},
+  { 48, -1, -1, sizeof(::sanguosha::RoomResponse)},
+  { 57, -1, -1, sizeof(::sanguosha::RoomListResponse)},
+  { 64, -1, -1, sizeof(::sanguosha::GameAction)},
+  { 74, -1, -1, sizeof(::sanguosha::PlayerState)},
+  { 85, -1, -1, sizeof(::sanguosha::GameState)},
+  { 97, 109, -1, sizeof(::sanguosha::PlayerStateDelta)},
+  { 115, 129, -1, sizeof(::sanguosha::GameStateDelta)},
+  { 137, -1, -1, sizeof(::sanguosha::GameStateRequest)},
+  { 144, -1, -1, sizeof(::sanguosha::GameStart)},
+  { 152, -1, -1, sizeof(::sanguosha::MessageBatch)},
+  { 159, -1, -1, sizeof(::sanguosha::GameMessage)},
+  { 180, -1, -1, sizeof(::sanguosha::GameOver)},
 };
 
-static ::google::protobuf::Message const * const file_default_instances[] = {
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_LoginRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_LoginResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_Heartbeat_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_RoomInfo_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_RoomRequest_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_RoomResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_RoomListResponse_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_GameAction_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_PlayerState_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_GameState_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_GameStart_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_GameMessage_default_instance_),
-  reinterpret_cast<const ::google::protobuf::Message*>(&::sanguosha::_GameOver_default_instance_),
+static const ::_pb::Message* const file_default_instances[] = {
+  &::sanguosha::_LoginRequest_default_instance_._instance,
+  &::sanguosha::_LoginResponse_default_instance_._instance,
+  &::sanguosha::_Heartbeat_default_instance_._instance,
+  &::sanguosha::_RoomInfo_default_instance_._instance,
+  &::sanguosha::_RoomRequest_default_instance_._instance,
+  &::sanguosha::_RoomResponse_default_instance_._instance,
+  &::sanguosha::_RoomListResponse_default_instance_._instance,
+  &::sanguosha::_GameAction_default_instance_._instance,
+  &::sanguosha::_PlayerState_default_instance_._instance,
+  &::sanguosha::_GameState_default_instance_._instance,
+  &::sanguosha::_PlayerStateDelta_default_instance_._instance,
+  &::sanguosha::_GameStateDelta_default_instance_._instance,
+  &::sanguosha::_GameStateRequest_default_instance_._instance,
+  &::sanguosha::_GameStart_default_instance_._instance,
+  &::sanguosha::_MessageBatch_default_instance_._instance,
+  &::sanguosha::_GameMessage_default_instance_._instance,
+  &::sanguosha::_GameOver_default_instance_._instance,
 };
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  AssignDescriptors(
-      "sanguosha.proto", schemas, file_default_instances, TableStruct::offsets,
-      file_level_metadata, file_level_enum_descriptors, NULL);
-}
-
-void protobuf_AssignDescriptorsOnce() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, protobuf_AssignDescriptors);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::internal::RegisterAllTypes(file_level_metadata, 13);
-}
-
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\017sanguosha.proto\022\tsanguosha\"2\n\014LoginReq"
-      "uest\022\020\n\010username\030\001 \001(\t\022\020\n\010password\030\002 \001(\t"
-      "\"H\n\rLoginResponse\022\017\n\007success\030\001 \001(\010\022\025\n\rer"
-      "ror_message\030\002 \001(\t\022\017\n\007user_id\030\003 \001(\r\"\036\n\tHe"
-      "artbeat\022\021\n\ttimestamp\030\001 \001(\004\"\201\001\n\010RoomInfo\022"
-      "\017\n\007room_id\030\001 \001(\r\022\017\n\007players\030\002 \003(\r\022\027\n\017cur"
-      "rent_players\030\003 \001(\r\022\023\n\013max_players\030\004 \001(\r\022"
-      "%\n\006status\030\005 \001(\0162\025.sanguosha.RoomStatus\"E"
-      "\n\013RoomRequest\022%\n\006action\030\001 \001(\0162\025.sanguosh"
-      "a.RoomAction\022\017\n\007room_id\030\002 \001(\r\"^\n\014RoomRes"
-      "ponse\022\017\n\007success\030\001 \001(\010\022\025\n\rerror_message\030"
-      "\002 \001(\t\022&\n\troom_info\030\003 \001(\0132\023.sanguosha.Roo"
-      "mInfo\"6\n\020RoomListResponse\022\"\n\005rooms\030\001 \003(\013"
-      "2\023.sanguosha.RoomInfo\"Y\n\nGameAction\022#\n\004t"
-      "ype\030\001 \001(\0162\025.sanguosha.ActionType\022\017\n\007card"
-      "_id\030\002 \001(\r\022\025\n\rtarget_player\030\003 \001(\r\"b\n\013Play"
-      "erState\022\021\n\tplayer_id\030\001 \001(\r\022\020\n\010username\030\002"
-      " \001(\t\022\n\n\002hp\030\003 \001(\r\022\016\n\006max_hp\030\004 \001(\r\022\022\n\nhand"
-      "_cards\030\005 \003(\r\"\203\001\n\tGameState\022\026\n\016current_pl"
-      "ayer\030\001 \001(\r\022\'\n\007players\030\002 \003(\0132\026.sanguosha."
-      "PlayerState\022#\n\005phase\030\003 \001(\0162\024.sanguosha.G"
-      "amePhase\022\020\n\010game_log\030\004 \001(\t\"0\n\tGameStart\022"
-      "\017\n\007room_id\030\001 \001(\r\022\022\n\nplayer_ids\030\002 \003(\r\"\234\004\n"
-      "\013GameMessage\022$\n\004type\030\001 \001(\0162\026.sanguosha.M"
-      "essageType\0220\n\rlogin_request\030\002 \001(\0132\027.sang"
-      "uosha.LoginRequestH\000\0222\n\016login_response\030\003"
-      " \001(\0132\030.sanguosha.LoginResponseH\000\022)\n\thear"
-      "tbeat\030\004 \001(\0132\024.sanguosha.HeartbeatH\000\022.\n\014r"
-      "oom_request\030\005 \001(\0132\026.sanguosha.RoomReques"
-      "tH\000\0220\n\rroom_response\030\006 \001(\0132\027.sanguosha.R"
-      "oomResponseH\000\022,\n\013game_action\030\007 \001(\0132\025.san"
-      "guosha.GameActionH\000\022*\n\ngame_state\030\010 \001(\0132"
-      "\024.sanguosha.GameStateH\000\022*\n\ngame_start\030\t "
-      "\001(\0132\024.sanguosha.GameStartH\000\022(\n\tgame_over"
-      "\030\n \001(\0132\023.sanguosha.GameOverH\000\0229\n\022room_li"
-      "st_response\030\016 \001(\0132\033.sanguosha.RoomListRe"
-      "sponseH\000B\t\n\007content\"\035\n\010GameOver\022\021\n\twinne"
-      "r_id\030\001 \001(\r*\374\001\n\013MessageType\022\013\n\007UNKNOWN\020\000\022"
-      "\021\n\rLOGIN_REQUEST\020\001\022\022\n\016LOGIN_RESPONSE\020\002\022\r"
-      "\n\tHEARTBEAT\020\003\022\020\n\014ROOM_REQUEST\020\004\022\021\n\rROOM_"
-      "RESPONSE\020\005\022\017\n\013GAME_ACTION\020\006\022\016\n\nGAME_STAT"
-      "E\020\007\022\016\n\nGAME_START\020\010\022\r\n\tGAME_OVER\020\t\022\026\n\022GA"
-      "ME_STATE_REQUEST\020\n\022\025\n\021ROOM_LIST_REQUEST\020"
-      "\013\022\026\n\022ROOM_LIST_RESPONSE\020\014*L\n\nRoomAction\022"
-      "\017\n\013CREATE_ROOM\020\000\022\r\n\tJOIN_ROOM\020\001\022\016\n\nLEAVE"
-      "_ROOM\020\002\022\016\n\nSTART_GAME\020\003*&\n\nRoomStatus\022\013\n"
-      "\007WAITING\020\000\022\013\n\007PLAYING\020\001*M\n\010CardType\022\020\n\014C"
-      "ARD_UNKNOWN\020\000\022\017\n\013CARD_ATTACK\020\001\022\017\n\013CARD_D"
-      "EFEND\020\002\022\r\n\tCARD_HEAL\020\003*Q\n\tGamePhase\022\021\n\rP"
-      "HASE_UNKNOWN\020\000\022\016\n\nDRAW_PHASE\020\001\022\016\n\nPLAY_P"
-      "HASE\020\002\022\021\n\rDISCARD_PHASE\020\003*7\n\nActionType\022"
-      "\024\n\020ACTION_PLAY_CARD\020\000\022\023\n\017ACTION_END_TURN"
-      "\020\001b\006proto3"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 2090);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "sanguosha.proto", &protobuf_RegisterTypes);
+const char descriptor_table_protodef_sanguosha_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\017sanguosha.proto\022\tsanguosha\"^\n\014LoginReq"
+  "uest\022\020\n\010username\030\001 \001(\t\022\020\n\010password\030\002 \001(\t"
+  "\022\024\n\014capabilities\030\003 \001(\r\022\024\n\014resume_token\030\004"
+  " \001(\t\"\205\001\n\rLoginResponse\022\017\n\007success\030\001 \001(\010\022"
+  "\025\n\rerror_message\030\002 \001(\t\022\017\n\007user_id\030\003 \001(\r\022"
+  "\024\n\014capabilities\030\004 \001(\r\022\024\n\014resume_token\030\005 "
+  "\001(\t\022\017\n\007resumed\030\006 \001(\010\"\036\n\tHeartbeat\022\021\n\ttim"
+  "estamp\030\001 \001(\004\"\201\001\n\010RoomInfo\022\017\n\007room_id\030\001 \001"
+  "(\r\022\017\n\007players\030\002 \003(\r\022\027\n\017current_players\030\003"
+  " \001(\r\022\023\n\013max_players\030\004 \001(\r\022%\n\006status\030\005 \001("
+  "\0162\025.sanguosha.RoomStatus\"E\n\013RoomRequest\022"
+  "%\n\006action\030\001 \001(\0162\025.sanguosha.RoomAction\022\017"
+  "\n\007room_id\030\002 \001(\r\"^\n\014RoomResponse\022\017\n\007succe"
+  "ss\030\001 \001(\010\022\025\n\rerror_message\030\002 \001(\t\022&\n\troom_"
+  "info\030\003 \001(\0132\023.sanguosha.RoomInfo\"6\n\020RoomL"
+  "istResponse\022\"\n\005rooms\030\001 \003(\0132\023.sanguosha.R"
+  "oomInfo\"k\n\nGameAction\022#\n\004type\030\001 \001(\0162\025.sa"
+  "nguosha.ActionType\022\017\n\007card_id\030\002 \001(\r\022\025\n\rt"
+  "arget_player\030\003 \001(\r\022\020\n\010sequence\030\004 \001(\r\"b\n\013"
+  "PlayerState\022\021\n\tplayer_id\030\001 \001(\r\022\020\n\010userna"
+  "me\030\002 \001(\t\022\n\n\002hp\030\003 \001(\r\022\016\n\006max_hp\030\004 \001(\r\022\022\n\n"
+  "hand_cards\030\005 \003(\r\"\254\001\n\tGameState\022\026\n\016curren"
+  "t_player\030\001 \001(\r\022\'\n\007players\030\002 \003(\0132\026.sanguo"
+  "sha.PlayerState\022#\n\005phase\030\003 \001(\0162\024.sanguos"
+  "ha.GamePhase\022\020\n\010game_log\030\004 \001(\t\022\017\n\007versio"
+  "n\030\005 \001(\004\022\026\n\016acked_sequence\030\006 \001(\r\"\261\001\n\020Play"
+  "erStateDelta\022\021\n\tplayer_id\030\001 \001(\r\022\025\n\010usern"
+  "ame\030\002 \001(\tH\000\210\001\001\022\017\n\002hp\030\003 \001(\rH\001\210\001\001\022\023\n\006max_h"
+  "p\030\004 \001(\rH\002\210\001\001\022\032\n\022hand_cards_changed\030\005 \001(\010"
+  "\022\022\n\nhand_cards\030\006 \003(\rB\013\n\t_usernameB\005\n\003_hp"
+  "B\t\n\007_max_hp\"\214\002\n\016GameStateDelta\022\024\n\014base_v"
+  "ersion\030\001 \001(\004\022\017\n\007version\030\002 \001(\004\022\033\n\016current"
+  "_player\030\003 \001(\rH\000\210\001\001\022(\n\005phase\030\004 \001(\0162\024.sang"
+  "uosha.GamePhaseH\001\210\001\001\022,\n\007players\030\005 \003(\0132\033."
+  "sanguosha.PlayerStateDelta\022\027\n\017removed_pl"
+  "ayers\030\006 \003(\r\022\020\n\010game_log\030\007 \001(\t\022\026\n\016acked_s"
+  "equence\030\010 \001(\rB\021\n\017_current_playerB\010\n\006_pha"
+  "se\")\n\020GameStateRequest\022\025\n\rknown_version\030"
+  "\001 \001(\004\"0\n\tGameStart\022\017\n\007room_id\030\001 \001(\r\022\022\n\np"
+  "layer_ids\030\002 \003(\r\"8\n\014MessageBatch\022(\n\010messa"
+  "ges\030\001 \003(\0132\026.sanguosha.GameMessage\"\270\005\n\013Ga"
+  "meMessage\022$\n\004type\030\001 \001(\0162\026.sanguosha.Mess"
+  "ageType\0220\n\rlogin_request\030\002 \001(\0132\027.sanguos"
+  "ha.LoginRequestH\000\0222\n\016login_response\030\003 \001("
+  "\0132\030.sanguosha.LoginResponseH\000\022)\n\theartbe"
+  "at\030\004 \001(\0132\024.sanguosha.HeartbeatH\000\022.\n\014room"
+  "_request\030\005 \001(\0132\026.sanguosha.RoomRequestH\000"
+  "\0220\n\rroom_response\030\006 \001(\0132\027.sanguosha.Room"
+  "ResponseH\000\022,\n\013game_action\030\007 \001(\0132\025.sanguo"
+  "sha.GameActionH\000\022*\n\ngame_state\030\010 \001(\0132\024.s"
+  "anguosha.GameStateH\000\022*\n\ngame_start\030\t \001(\013"
+  "2\024.sanguosha.GameStartH\000\022(\n\tgame_over\030\n "
+  "\001(\0132\023.sanguosha.GameOverH\000\0225\n\020game_state"
+  "_delta\030\013 \001(\0132\031.sanguosha.GameStateDeltaH"
+  "\000\0229\n\022game_state_request\030\014 \001(\0132\033.sanguosh"
+  "a.GameStateRequestH\000\0229\n\022room_list_respon"
+  "se\030\016 \001(\0132\033.sanguosha.RoomListResponseH\000\022"
+  "(\n\005batch\030\017 \001(\0132\027.sanguosha.MessageBatchH"
+  "\000B\t\n\007content\"\035\n\010GameOver\022\021\n\twinner_id\030\001 "
+  "\001(\r*\245\002\n\013MessageType\022\013\n\007UNKNOWN\020\000\022\021\n\rLOGI"
+  "N_REQUEST\020\001\022\022\n\016LOGIN_RESPONSE\020\002\022\r\n\tHEART"
+  "BEAT\020\003\022\020\n\014ROOM_REQUEST\020\004\022\021\n\rROOM_RESPONS"
+  "E\020\005\022\017\n\013GAME_ACTION\020\006\022\016\n\nGAME_STATE\020\007\022\016\n\n"
+  "GAME_START\020\010\022\r\n\tGAME_OVER\020\t\022\026\n\022GAME_STAT"
+  "E_REQUEST\020\n\022\025\n\021ROOM_LIST_REQUEST\020\013\022\026\n\022RO"
+  "OM_LIST_RESPONSE\020\014\022\024\n\020GAME_STATE_DELTA\020\r"
+  "\022\021\n\rMESSAGE_BATCH\020\016*\201\001\n\nCapability\022\023\n\017CA"
+  "PABILITY_NONE\020\000\022 \n\034CAPABILITY_FRAME_COMP"
+  "RESSION\020\001\022\034\n\030CAPABILITY_MESSAGE_BATCH\020\002\022"
+  "\036\n\032CAPABILITY_ACTION_SEQUENCE\020\004*L\n\nRoomA"
+  "ction\022\017\n\013CREATE_ROOM\020\000\022\r\n\tJOIN_ROOM\020\001\022\016\n"
+  "\nLEAVE_ROOM\020\002\022\016\n\nSTART_GAME\020\003*&\n\nRoomSta"
+  "tus\022\013\n\007WAITING\020\000\022\013\n\007PLAYING\020\001*M\n\010CardTyp"
+  "e\022\020\n\014CARD_UNKNOWN\020\000\022\017\n\013CARD_ATTACK\020\001\022\017\n\013"
+  "CARD_DEFEND\020\002\022\r\n\tCARD_HEAL\020\003*Q\n\tGamePhas"
+  "e\022\021\n\rPHASE_UNKNOWN\020\000\022\016\n\nDRAW_PHASE\020\001\022\016\n\n"
+  "PLAY_PHASE\020\002\022\021\n\rDISCARD_PHASE\020\003*7\n\nActio"
+  "nType\022\024\n\020ACTION_PLAY_CARD\020\000\022\023\n\017ACTION_EN"
+  "D_TURN\020\001B\003\370\001\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_sanguosha_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_sanguosha_2eproto = {
+    false, false, 3141, descriptor_table_protodef_sanguosha_2eproto,
+    "sanguosha.proto",
+    &descriptor_table_sanguosha_2eproto_once, nullptr, 0, 17,
+    schemas, file_default_instances, TableStruct_sanguosha_2eproto::offsets,
+    file_level_metadata_sanguosha_2eproto, file_level_enum_descriptors_sanguosha_2eproto,
+    file_level_service_descriptors_sanguosha_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_sanguosha_2eproto_getter() {
+  return &descriptor_table_sanguosha_2eproto;
 }
 
-void AddDescriptors() {
-  static ::google::protobuf::internal::once_flag once;
-  ::google::protobuf::internal::call_once(once, AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_sanguosha_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_sanguosha_2eproto(&descriptor_table_sanguosha_2eproto);
 namespace sanguosha {
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[0];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[0];
 }
 bool MessageType_IsValid(int value) {
   switch (value) {
@@ -580,15 +641,33 @@ bool MessageType_IsValid(int value) {
     case 10:
     case 11:
     case 12:
+    case 13:
+    case 14:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Capability_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[1];
+}
+bool Capability_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 4:
       return true;
     default:
       return false;
   }
 }
 
-const ::google::protobuf::EnumDescriptor* RoomAction_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[1];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomAction_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[2];
 }
 bool RoomAction_IsValid(int value) {
   switch (value) {
@@ -602,9 +681,9 @@ bool RoomAction_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* RoomStatus_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[2];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[3];
 }
 bool RoomStatus_IsValid(int value) {
   switch (value) {
@@ -616,9 +695,9 @@ bool RoomStatus_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* CardType_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[3];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CardType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[4];
 }
 bool CardType_IsValid(int value) {
   switch (value) {
@@ -632,9 +711,9 @@ bool CardType_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* GamePhase_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[4];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GamePhase_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[5];
 }
 bool GamePhase_IsValid(int value) {
   switch (value) {
@@ -648,9 +727,9 @@ bool GamePhase_IsValid(int value) {
   }
 }
 
-const ::google::protobuf::EnumDescriptor* ActionType_descriptor() {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return protobuf_sanguosha_2eproto::file_level_enum_descriptors[5];
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_sanguosha_2eproto);
+  return file_level_enum_descriptors_sanguosha_2eproto[6];
 }
 bool ActionType_IsValid(int value) {
   switch (value) {
@@ -665,202 +744,225 @@ bool ActionType_IsValid(int value) {
 
 // ===================================================================
 
-void LoginRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LoginRequest::kUsernameFieldNumber;
-const int LoginRequest::kPasswordFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class LoginRequest::_Internal {
+ public:
+};
 
-LoginRequest::LoginRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_LoginRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.LoginRequest)
+LoginRequest::LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.LoginRequest)
 }
 LoginRequest::LoginRequest(const LoginRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.password().size() > 0) {
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
-  }
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LoginRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.password_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.capabilities_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_password().empty()) {
+    _this->_impl_.password_.Set(from._internal_password(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_resume_token().empty()) {
+    _this->_impl_.resume_token_.Set(from._internal_resume_token(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.capabilities_ = from._impl_.capabilities_;
   // @@protoc_insertion_point(copy_constructor:sanguosha.LoginRequest)
 }
 
-void LoginRequest::SharedCtor() {
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LoginRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.password_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.capabilities_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.password_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.password_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LoginRequest::~LoginRequest() {
   // @@protoc_insertion_point(destructor:sanguosha.LoginRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LoginRequest::SharedDtor() {
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LoginRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.password_.Destroy();
+  _impl_.resume_token_.Destroy();
 }
 
 void LoginRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* LoginRequest::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const LoginRequest& LoginRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_LoginRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void LoginRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.LoginRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  _internal_metadata_.Clear();
-}
-
-bool LoginRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.LoginRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.username_.ClearToEmpty();
+  _impl_.password_.ClearToEmpty();
+  _impl_.resume_token_.ClearToEmpty();
+  _impl_.capabilities_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LoginRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // string username = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.LoginRequest.username"));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.LoginRequest.username"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string password = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_password()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->password().data(), static_cast<int>(this->password().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.LoginRequest.password"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_password();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.LoginRequest.password"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint32 capabilities = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.capabilities_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string resume_token = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_resume_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.LoginRequest.resume_token"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.LoginRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.LoginRequest)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void LoginRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.LoginRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* LoginRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.LoginRequest)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // string username = 1;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.LoginRequest.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
   }
 
   // string password = 2;
-  if (this->password().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->password().data(), static_cast<int>(this->password().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_password().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_password().data(), static_cast<int>(this->_internal_password().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.LoginRequest.password");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->password(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_password(), target);
   }
-  // @@protoc_insertion_point(serialize_end:sanguosha.LoginRequest)
-}
-
-::google::protobuf::uint8* LoginRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.LoginRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  // string username = 1;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.LoginRequest.username");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->username(), target);
+  // uint32 capabilities = 3;
+  if (this->_internal_capabilities() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_capabilities(), target);
   }
 
-  // string password = 2;
-  if (this->password().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->password().data(), static_cast<int>(this->password().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.LoginRequest.password");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->password(), target);
+  // string resume_token = 4;
+  if (!this->_internal_resume_token().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_resume_token().data(), static_cast<int>(this->_internal_resume_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sanguosha.LoginRequest.resume_token");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_resume_token(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.LoginRequest)
   return target;
@@ -870,67 +972,67 @@ size_t LoginRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.LoginRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string username = 1;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // string password = 2;
-  if (this->password().size() > 0) {
+  if (!this->_internal_password().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->password());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_password());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // string resume_token = 4;
+  if (!this->_internal_resume_token().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_resume_token());
+  }
 
-void LoginRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.LoginRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LoginRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LoginRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.LoginRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.LoginRequest)
-    MergeFrom(*source);
+  // uint32 capabilities = 3;
+  if (this->_internal_capabilities() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_capabilities());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LoginRequest::MergeFrom(const LoginRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.LoginRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LoginRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LoginRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LoginRequest::GetClassData() const { return &_class_data_; }
 
-  if (from.username().size() > 0) {
 
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  if (from.password().size() > 0) {
+void LoginRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LoginRequest*>(&to_msg);
+  auto& from = static_cast<const LoginRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.LoginRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    password_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.password_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-}
-
-void LoginRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.LoginRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (!from._internal_password().empty()) {
+    _this->_internal_set_password(from._internal_password());
+  }
+  if (!from._internal_resume_token().empty()) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
+  }
+  if (from._internal_capabilities() != 0) {
+    _this->_internal_set_capabilities(from._internal_capabilities());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LoginRequest::CopyFrom(const LoginRequest& from) {
@@ -944,237 +1046,269 @@ bool LoginRequest::IsInitialized() const {
   return true;
 }
 
-void LoginRequest::Swap(LoginRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void LoginRequest::InternalSwap(LoginRequest* other) {
   using std::swap;
-  username_.Swap(&other->username_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  password_.Swap(&other->password_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata LoginRequest::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.password_, lhs_arena,
+      &other->_impl_.password_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resume_token_, lhs_arena,
+      &other->_impl_.resume_token_, rhs_arena
+  );
+  swap(_impl_.capabilities_, other->_impl_.capabilities_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LoginRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[0]);
 }
 
-
 // ===================================================================
 
-void LoginResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int LoginResponse::kSuccessFieldNumber;
-const int LoginResponse::kErrorMessageFieldNumber;
-const int LoginResponse::kUserIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class LoginResponse::_Internal {
+ public:
+};
 
-LoginResponse::LoginResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_LoginResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.LoginResponse)
+LoginResponse::LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.LoginResponse)
 }
 LoginResponse::LoginResponse(const LoginResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  ::memcpy(&success_, &from.success_,
-    static_cast<size_t>(reinterpret_cast<char*>(&user_id_) -
-    reinterpret_cast<char*>(&success_)) + sizeof(user_id_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LoginResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.resumed_){}
+    , decltype(_impl_.capabilities_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_resume_token().empty()) {
+    _this->_impl_.resume_token_.Set(from._internal_resume_token(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.user_id_, &from._impl_.user_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.capabilities_) -
+    reinterpret_cast<char*>(&_impl_.user_id_)) + sizeof(_impl_.capabilities_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.LoginResponse)
 }
 
-void LoginResponse::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&user_id_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(user_id_));
+inline void LoginResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.user_id_){0u}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.resumed_){false}
+    , decltype(_impl_.capabilities_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 LoginResponse::~LoginResponse() {
   // @@protoc_insertion_point(destructor:sanguosha.LoginResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void LoginResponse::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void LoginResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+  _impl_.resume_token_.Destroy();
 }
 
 void LoginResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* LoginResponse::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const LoginResponse& LoginResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_LoginResponse.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void LoginResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.LoginResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&success_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&user_id_) -
-      reinterpret_cast<char*>(&success_)) + sizeof(user_id_));
-  _internal_metadata_.Clear();
-}
-
-bool LoginResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.LoginResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  _impl_.resume_token_.ClearToEmpty();
+  ::memset(&_impl_.user_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.capabilities_) -
+      reinterpret_cast<char*>(&_impl_.user_id_)) + sizeof(_impl_.capabilities_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LoginResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.LoginResponse.error_message"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.LoginResponse.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 user_id = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &user_id_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint32 capabilities = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.capabilities_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string resume_token = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_resume_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.LoginResponse.resume_token"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool resumed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.resumed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.LoginResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.LoginResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void LoginResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.LoginResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* LoginResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.LoginResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string error_message = 2;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.LoginResponse.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->error_message(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error_message(), target);
   }
 
   // uint32 user_id = 3;
-  if (this->user_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->user_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_user_id(), target);
   }
-  // @@protoc_insertion_point(serialize_end:sanguosha.LoginResponse)
-}
 
-::google::protobuf::uint8* LoginResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.LoginResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  // uint32 capabilities = 4;
+  if (this->_internal_capabilities() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_capabilities(), target);
   }
 
-  // string error_message = 2;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.LoginResponse.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->error_message(), target);
+  // string resume_token = 5;
+  if (!this->_internal_resume_token().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_resume_token().data(), static_cast<int>(this->_internal_resume_token().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sanguosha.LoginResponse.resume_token");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_resume_token(), target);
   }
 
-  // uint32 user_id = 3;
-  if (this->user_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->user_id(), target);
+  // bool resumed = 6;
+  if (this->_internal_resumed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_resumed(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.LoginResponse)
   return target;
@@ -1184,74 +1318,81 @@ size_t LoginResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.LoginResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 2;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
-  // bool success = 1;
-  if (this->success() != 0) {
-    total_size += 1 + 1;
+  // string resume_token = 5;
+  if (!this->_internal_resume_token().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_resume_token());
   }
 
   // uint32 user_id = 3;
-  if (this->user_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->user_id());
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_user_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // bool success = 1;
+  if (this->_internal_success() != 0) {
+    total_size += 1 + 1;
+  }
 
-void LoginResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.LoginResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const LoginResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const LoginResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.LoginResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.LoginResponse)
-    MergeFrom(*source);
+  // bool resumed = 6;
+  if (this->_internal_resumed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 capabilities = 4;
+  if (this->_internal_capabilities() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_capabilities());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LoginResponse::MergeFrom(const LoginResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.LoginResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LoginResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LoginResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LoginResponse::GetClassData() const { return &_class_data_; }
 
-  if (from.error_message().size() > 0) {
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+void LoginResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LoginResponse*>(&to_msg);
+  auto& from = static_cast<const LoginResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.LoginResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (!from._internal_resume_token().empty()) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
   }
-  if (from.user_id() != 0) {
-    set_user_id(from.user_id());
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
   }
-}
-
-void LoginResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.LoginResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
+  }
+  if (from._internal_resumed() != 0) {
+    _this->_internal_set_resumed(from._internal_resumed());
+  }
+  if (from._internal_capabilities() != 0) {
+    _this->_internal_set_capabilities(from._internal_capabilities());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LoginResponse::CopyFrom(const LoginResponse& from) {
@@ -1265,161 +1406,146 @@ bool LoginResponse::IsInitialized() const {
   return true;
 }
 
-void LoginResponse::Swap(LoginResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void LoginResponse::InternalSwap(LoginResponse* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(success_, other->success_);
-  swap(user_id_, other->user_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata LoginResponse::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resume_token_, lhs_arena,
+      &other->_impl_.resume_token_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.capabilities_)
+      + sizeof(LoginResponse::_impl_.capabilities_)
+      - PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.user_id_)>(
+          reinterpret_cast<char*>(&_impl_.user_id_),
+          reinterpret_cast<char*>(&other->_impl_.user_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LoginResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[1]);
 }
 
-
 // ===================================================================
 
-void Heartbeat::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int Heartbeat::kTimestampFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class Heartbeat::_Internal {
+ public:
+};
 
-Heartbeat::Heartbeat()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_Heartbeat.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.Heartbeat)
+Heartbeat::Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.Heartbeat)
 }
 Heartbeat::Heartbeat(const Heartbeat& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  timestamp_ = from.timestamp_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Heartbeat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.timestamp_ = from._impl_.timestamp_;
   // @@protoc_insertion_point(copy_constructor:sanguosha.Heartbeat)
 }
 
-void Heartbeat::SharedCtor() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
+inline void Heartbeat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.timestamp_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 Heartbeat::~Heartbeat() {
   // @@protoc_insertion_point(destructor:sanguosha.Heartbeat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Heartbeat::SharedDtor() {
+inline void Heartbeat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Heartbeat::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* Heartbeat::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const Heartbeat& Heartbeat::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_Heartbeat.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void Heartbeat::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.Heartbeat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  _internal_metadata_.Clear();
+  _impl_.timestamp_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Heartbeat::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.Heartbeat)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Heartbeat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint64 timestamp = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &timestamp_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.Heartbeat)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.Heartbeat)
-  return false;
-#undef DO_
-}
-
-void Heartbeat::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.Heartbeat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(1, this->timestamp(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.Heartbeat)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* Heartbeat::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* Heartbeat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:sanguosha.Heartbeat)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(1, this->timestamp(), target);
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.Heartbeat)
   return target;
@@ -1429,55 +1555,37 @@ size_t Heartbeat::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.Heartbeat)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint64 timestamp = 1;
-  if (this->timestamp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt64Size(
-        this->timestamp());
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_timestamp());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Heartbeat::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.Heartbeat)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Heartbeat* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const Heartbeat>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.Heartbeat)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.Heartbeat)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Heartbeat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Heartbeat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Heartbeat::GetClassData() const { return &_class_data_; }
+
 
-void Heartbeat::MergeFrom(const Heartbeat& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.Heartbeat)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void Heartbeat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Heartbeat*>(&to_msg);
+  auto& from = static_cast<const Heartbeat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.Heartbeat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.timestamp() != 0) {
-    set_timestamp(from.timestamp());
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
-}
-
-void Heartbeat::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.Heartbeat)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Heartbeat::CopyFrom(const Heartbeat& from) {
@@ -1491,288 +1599,211 @@ bool Heartbeat::IsInitialized() const {
   return true;
 }
 
-void Heartbeat::Swap(Heartbeat* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void Heartbeat::InternalSwap(Heartbeat* other) {
   using std::swap;
-  swap(timestamp_, other->timestamp_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.timestamp_, other->_impl_.timestamp_);
 }
 
-::google::protobuf::Metadata Heartbeat::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata Heartbeat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[2]);
 }
 
-
 // ===================================================================
 
-void RoomInfo::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RoomInfo::kRoomIdFieldNumber;
-const int RoomInfo::kPlayersFieldNumber;
-const int RoomInfo::kCurrentPlayersFieldNumber;
-const int RoomInfo::kMaxPlayersFieldNumber;
-const int RoomInfo::kStatusFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RoomInfo::_Internal {
+ public:
+};
 
-RoomInfo::RoomInfo()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_RoomInfo.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.RoomInfo)
+RoomInfo::RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.RoomInfo)
 }
 RoomInfo::RoomInfo(const RoomInfo& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      players_(from.players_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&room_id_, &from.room_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&status_) -
-    reinterpret_cast<char*>(&room_id_)) + sizeof(status_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomInfo* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.players_){from._impl_.players_}
+    , /*decltype(_impl_._players_cached_byte_size_)*/{0}
+    , decltype(_impl_.room_id_){}
+    , decltype(_impl_.current_players_){}
+    , decltype(_impl_.max_players_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.room_id_, &from._impl_.room_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.room_id_)) + sizeof(_impl_.status_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.RoomInfo)
 }
 
-void RoomInfo::SharedCtor() {
-  ::memset(&room_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&room_id_)) + sizeof(status_));
+inline void RoomInfo::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.players_){arena}
+    , /*decltype(_impl_._players_cached_byte_size_)*/{0}
+    , decltype(_impl_.room_id_){0u}
+    , decltype(_impl_.current_players_){0u}
+    , decltype(_impl_.max_players_){0u}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoomInfo::~RoomInfo() {
   // @@protoc_insertion_point(destructor:sanguosha.RoomInfo)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RoomInfo::SharedDtor() {
+inline void RoomInfo::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.players_.~RepeatedField();
 }
 
 void RoomInfo::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* RoomInfo::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RoomInfo& RoomInfo::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_RoomInfo.base);
-  return *internal_default_instance();
-}
-
 
 void RoomInfo::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.RoomInfo)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  players_.Clear();
-  ::memset(&room_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&status_) -
-      reinterpret_cast<char*>(&room_id_)) + sizeof(status_));
-  _internal_metadata_.Clear();
-}
-
-bool RoomInfo::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.RoomInfo)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.players_.Clear();
+  ::memset(&_impl_.room_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.room_id_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomInfo::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 room_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &room_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.room_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 players = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_players())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_players())));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_players(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_players(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 current_players = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &current_players_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.current_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 max_players = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &max_players_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_players_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.RoomStatus status = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_status(static_cast< ::sanguosha::RoomStatus >(value));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::sanguosha::RoomStatus>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.RoomInfo)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.RoomInfo)
-  return false;
-#undef DO_
-}
-
-void RoomInfo::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.RoomInfo)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->room_id(), output);
-  }
-
-  // repeated uint32 players = 2;
-  if (this->players_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _players_cached_byte_size_));
-  }
-  for (int i = 0, n = this->players_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->players(i), output);
-  }
-
-  // uint32 current_players = 3;
-  if (this->current_players() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->current_players(), output);
-  }
-
-  // uint32 max_players = 4;
-  if (this->max_players() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->max_players(), output);
-  }
-
-  // .sanguosha.RoomStatus status = 5;
-  if (this->status() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      5, this->status(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.RoomInfo)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RoomInfo::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* RoomInfo::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:sanguosha.RoomInfo)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->room_id(), target);
+  if (this->_internal_room_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_room_id(), target);
   }
 
   // repeated uint32 players = 2;
-  if (this->players_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _players_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->players_, target);
+  {
+    int byte_size = _impl_._players_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_players(), byte_size, target);
+    }
   }
 
   // uint32 current_players = 3;
-  if (this->current_players() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->current_players(), target);
+  if (this->_internal_current_players() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_current_players(), target);
   }
 
   // uint32 max_players = 4;
-  if (this->max_players() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->max_players(), target);
+  if (this->_internal_max_players() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_players(), target);
   }
 
   // .sanguosha.RoomStatus status = 5;
-  if (this->status() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      5, this->status(), target);
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      5, this->_internal_status(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.RoomInfo)
   return target;
@@ -1782,101 +1813,77 @@ size_t RoomInfo::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.RoomInfo)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 players = 2;
   {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->players_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.players_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _players_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._players_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->room_id());
+  if (this->_internal_room_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_room_id());
   }
 
   // uint32 current_players = 3;
-  if (this->current_players() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->current_players());
+  if (this->_internal_current_players() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_players());
   }
 
   // uint32 max_players = 4;
-  if (this->max_players() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->max_players());
+  if (this->_internal_max_players() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_players());
   }
 
   // .sanguosha.RoomStatus status = 5;
-  if (this->status() != 0) {
+  if (this->_internal_status() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->status());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoomInfo::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.RoomInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoomInfo* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RoomInfo>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.RoomInfo)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.RoomInfo)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomInfo::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomInfo::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomInfo::GetClassData() const { return &_class_data_; }
+
 
-void RoomInfo::MergeFrom(const RoomInfo& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomInfo)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void RoomInfo::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomInfo*>(&to_msg);
+  auto& from = static_cast<const RoomInfo&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomInfo)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  players_.MergeFrom(from.players_);
-  if (from.room_id() != 0) {
-    set_room_id(from.room_id());
+  _this->_impl_.players_.MergeFrom(from._impl_.players_);
+  if (from._internal_room_id() != 0) {
+    _this->_internal_set_room_id(from._internal_room_id());
   }
-  if (from.current_players() != 0) {
-    set_current_players(from.current_players());
+  if (from._internal_current_players() != 0) {
+    _this->_internal_set_current_players(from._internal_current_players());
   }
-  if (from.max_players() != 0) {
-    set_max_players(from.max_players());
+  if (from._internal_max_players() != 0) {
+    _this->_internal_set_max_players(from._internal_max_players());
   }
-  if (from.status() != 0) {
-    set_status(from.status());
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
   }
-}
-
-void RoomInfo::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.RoomInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoomInfo::CopyFrom(const RoomInfo& from) {
@@ -1890,196 +1897,159 @@ bool RoomInfo::IsInitialized() const {
   return true;
 }
 
-void RoomInfo::Swap(RoomInfo* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RoomInfo::InternalSwap(RoomInfo* other) {
   using std::swap;
-  players_.InternalSwap(&other->players_);
-  swap(room_id_, other->room_id_);
-  swap(current_players_, other->current_players_);
-  swap(max_players_, other->max_players_);
-  swap(status_, other->status_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.players_.InternalSwap(&other->_impl_.players_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomInfo, _impl_.status_)
+      + sizeof(RoomInfo::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(RoomInfo, _impl_.room_id_)>(
+          reinterpret_cast<char*>(&_impl_.room_id_),
+          reinterpret_cast<char*>(&other->_impl_.room_id_));
 }
 
-::google::protobuf::Metadata RoomInfo::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata RoomInfo::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[3]);
 }
 
-
 // ===================================================================
 
-void RoomRequest::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RoomRequest::kActionFieldNumber;
-const int RoomRequest::kRoomIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RoomRequest::_Internal {
+ public:
+};
 
-RoomRequest::RoomRequest()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_RoomRequest.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.RoomRequest)
+RoomRequest::RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.RoomRequest)
 }
 RoomRequest::RoomRequest(const RoomRequest& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&action_, &from.action_,
-    static_cast<size_t>(reinterpret_cast<char*>(&room_id_) -
-    reinterpret_cast<char*>(&action_)) + sizeof(room_id_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.action_){}
+    , decltype(_impl_.room_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.action_, &from._impl_.action_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.room_id_) -
+    reinterpret_cast<char*>(&_impl_.action_)) + sizeof(_impl_.room_id_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.RoomRequest)
 }
 
-void RoomRequest::SharedCtor() {
-  ::memset(&action_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&room_id_) -
-      reinterpret_cast<char*>(&action_)) + sizeof(room_id_));
+inline void RoomRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.action_){0}
+    , decltype(_impl_.room_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoomRequest::~RoomRequest() {
   // @@protoc_insertion_point(destructor:sanguosha.RoomRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RoomRequest::SharedDtor() {
+inline void RoomRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void RoomRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RoomRequest::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RoomRequest& RoomRequest::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_RoomRequest.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RoomRequest::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.RoomRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&action_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&room_id_) -
-      reinterpret_cast<char*>(&action_)) + sizeof(room_id_));
-  _internal_metadata_.Clear();
-}
-
-bool RoomRequest::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.RoomRequest)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.action_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.room_id_) -
+      reinterpret_cast<char*>(&_impl_.action_)) + sizeof(_impl_.room_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .sanguosha.RoomAction action = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_action(static_cast< ::sanguosha::RoomAction >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_action(static_cast<::sanguosha::RoomAction>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 room_id = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &room_id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.room_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.RoomRequest)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.RoomRequest)
-  return false;
-#undef DO_
-}
-
-void RoomRequest::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.RoomRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .sanguosha.RoomAction action = 1;
-  if (this->action() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->action(), output);
-  }
-
-  // uint32 room_id = 2;
-  if (this->room_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->room_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.RoomRequest)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RoomRequest::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* RoomRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:sanguosha.RoomRequest)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .sanguosha.RoomAction action = 1;
-  if (this->action() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->action(), target);
+  if (this->_internal_action() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_action(), target);
   }
 
   // uint32 room_id = 2;
-  if (this->room_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->room_id(), target);
+  if (this->_internal_room_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_room_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.RoomRequest)
   return target;
@@ -2089,64 +2059,46 @@ size_t RoomRequest::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.RoomRequest)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .sanguosha.RoomAction action = 1;
-  if (this->action() != 0) {
+  if (this->_internal_action() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->action());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_action());
   }
 
   // uint32 room_id = 2;
-  if (this->room_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->room_id());
+  if (this->_internal_room_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_room_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoomRequest::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.RoomRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoomRequest* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RoomRequest>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.RoomRequest)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.RoomRequest)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomRequest::GetClassData() const { return &_class_data_; }
+
 
-void RoomRequest::MergeFrom(const RoomRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomRequest)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void RoomRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomRequest*>(&to_msg);
+  auto& from = static_cast<const RoomRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.action() != 0) {
-    set_action(from.action());
+  if (from._internal_action() != 0) {
+    _this->_internal_set_action(from._internal_action());
   }
-  if (from.room_id() != 0) {
-    set_room_id(from.room_id());
+  if (from._internal_room_id() != 0) {
+    _this->_internal_set_room_id(from._internal_room_id());
   }
-}
-
-void RoomRequest::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.RoomRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoomRequest::CopyFrom(const RoomRequest& from) {
@@ -2160,244 +2112,202 @@ bool RoomRequest::IsInitialized() const {
   return true;
 }
 
-void RoomRequest::Swap(RoomRequest* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RoomRequest::InternalSwap(RoomRequest* other) {
   using std::swap;
-  swap(action_, other->action_);
-  swap(room_id_, other->room_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomRequest, _impl_.room_id_)
+      + sizeof(RoomRequest::_impl_.room_id_)
+      - PROTOBUF_FIELD_OFFSET(RoomRequest, _impl_.action_)>(
+          reinterpret_cast<char*>(&_impl_.action_),
+          reinterpret_cast<char*>(&other->_impl_.action_));
 }
 
-::google::protobuf::Metadata RoomRequest::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata RoomRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[4]);
 }
 
-
 // ===================================================================
 
-void RoomResponse::InitAsDefaultInstance() {
-  ::sanguosha::_RoomResponse_default_instance_._instance.get_mutable()->room_info_ = const_cast< ::sanguosha::RoomInfo*>(
-      ::sanguosha::RoomInfo::internal_default_instance());
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RoomResponse::kSuccessFieldNumber;
-const int RoomResponse::kErrorMessageFieldNumber;
-const int RoomResponse::kRoomInfoFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RoomResponse::_Internal {
+ public:
+  static const ::sanguosha::RoomInfo& room_info(const RoomResponse* msg);
+};
 
-RoomResponse::RoomResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_RoomResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.RoomResponse)
+const ::sanguosha::RoomInfo&
+RoomResponse::_Internal::room_info(const RoomResponse* msg) {
+  return *msg->_impl_.room_info_;
+}
+RoomResponse::RoomResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.RoomResponse)
 }
 RoomResponse::RoomResponse(const RoomResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.error_message().size() > 0) {
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
-  }
-  if (from.has_room_info()) {
-    room_info_ = new ::sanguosha::RoomInfo(*from.room_info_);
-  } else {
-    room_info_ = NULL;
-  }
-  success_ = from.success_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.room_info_){nullptr}
+    , decltype(_impl_.success_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_message().empty()) {
+    _this->_impl_.error_message_.Set(from._internal_error_message(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_room_info()) {
+    _this->_impl_.room_info_ = new ::sanguosha::RoomInfo(*from._impl_.room_info_);
+  }
+  _this->_impl_.success_ = from._impl_.success_;
   // @@protoc_insertion_point(copy_constructor:sanguosha.RoomResponse)
 }
 
-void RoomResponse::SharedCtor() {
-  error_message_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&room_info_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&success_) -
-      reinterpret_cast<char*>(&room_info_)) + sizeof(success_));
+inline void RoomResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_message_){}
+    , decltype(_impl_.room_info_){nullptr}
+    , decltype(_impl_.success_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.error_message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 RoomResponse::~RoomResponse() {
   // @@protoc_insertion_point(destructor:sanguosha.RoomResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RoomResponse::SharedDtor() {
-  error_message_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete room_info_;
+inline void RoomResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_message_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.room_info_;
 }
 
 void RoomResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RoomResponse::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RoomResponse& RoomResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_RoomResponse.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RoomResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.RoomResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (GetArenaNoVirtual() == NULL && room_info_ != NULL) {
-    delete room_info_;
-  }
-  room_info_ = NULL;
-  success_ = false;
-  _internal_metadata_.Clear();
-}
-
-bool RoomResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.RoomResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.error_message_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.room_info_ != nullptr) {
+    delete _impl_.room_info_;
+  }
+  _impl_.room_info_ = nullptr;
+  _impl_.success_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // bool success = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &success_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string error_message = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_error_message()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->error_message().data(), static_cast<int>(this->error_message().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.RoomResponse.error_message"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.RoomResponse.error_message"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.RoomInfo room_info = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_room_info()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room_info(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.RoomResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.RoomResponse)
-  return false;
-#undef DO_
-}
-
-void RoomResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.RoomResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // bool success = 1;
-  if (this->success() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->success(), output);
-  }
-
-  // string error_message = 2;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.RoomResponse.error_message");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->error_message(), output);
-  }
-
-  // .sanguosha.RoomInfo room_info = 3;
-  if (this->has_room_info()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_room_info(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.RoomResponse)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* RoomResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* RoomResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:sanguosha.RoomResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // bool success = 1;
-  if (this->success() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->success(), target);
+  if (this->_internal_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
   }
 
   // string error_message = 2;
-  if (this->error_message().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->error_message().data(), static_cast<int>(this->error_message().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_error_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_message().data(), static_cast<int>(this->_internal_error_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.RoomResponse.error_message");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->error_message(), target);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error_message(), target);
   }
 
   // .sanguosha.RoomInfo room_info = 3;
-  if (this->has_room_info()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_room_info(), deterministic, target);
+  if (this->_internal_has_room_info()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::room_info(this),
+        _Internal::room_info(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.RoomResponse)
   return target;
@@ -2407,74 +2317,58 @@ size_t RoomResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.RoomResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // string error_message = 2;
-  if (this->error_message().size() > 0) {
+  if (!this->_internal_error_message().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->error_message());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_message());
   }
 
   // .sanguosha.RoomInfo room_info = 3;
-  if (this->has_room_info()) {
+  if (this->_internal_has_room_info()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::MessageSize(
-        *room_info_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.room_info_);
   }
 
   // bool success = 1;
-  if (this->success() != 0) {
+  if (this->_internal_success() != 0) {
     total_size += 1 + 1;
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoomResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.RoomResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoomResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RoomResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.RoomResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.RoomResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomResponse::GetClassData() const { return &_class_data_; }
 
-void RoomResponse::MergeFrom(const RoomResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  if (from.error_message().size() > 0) {
+void RoomResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomResponse*>(&to_msg);
+  auto& from = static_cast<const RoomResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    error_message_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.error_message_);
+  if (!from._internal_error_message().empty()) {
+    _this->_internal_set_error_message(from._internal_error_message());
   }
-  if (from.has_room_info()) {
-    mutable_room_info()->::sanguosha::RoomInfo::MergeFrom(from.room_info());
+  if (from._internal_has_room_info()) {
+    _this->_internal_mutable_room_info()->::sanguosha::RoomInfo::MergeFrom(
+        from._internal_room_info());
   }
-  if (from.success() != 0) {
-    set_success(from.success());
+  if (from._internal_success() != 0) {
+    _this->_internal_set_success(from._internal_success());
   }
-}
-
-void RoomResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.RoomResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoomResponse::CopyFrom(const RoomResponse& from) {
@@ -2488,225 +2382,189 @@ bool RoomResponse::IsInitialized() const {
   return true;
 }
 
-void RoomResponse::Swap(RoomResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RoomResponse::InternalSwap(RoomResponse* other) {
   using std::swap;
-  error_message_.Swap(&other->error_message_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(room_info_, other->room_info_);
-  swap(success_, other->success_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_message_, lhs_arena,
+      &other->_impl_.error_message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoomResponse, _impl_.success_)
+      + sizeof(RoomResponse::_impl_.success_)
+      - PROTOBUF_FIELD_OFFSET(RoomResponse, _impl_.room_info_)>(
+          reinterpret_cast<char*>(&_impl_.room_info_),
+          reinterpret_cast<char*>(&other->_impl_.room_info_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[5]);
 }
 
-::google::protobuf::Metadata RoomResponse::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
-}
-
-
 // ===================================================================
 
-void RoomListResponse::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int RoomListResponse::kRoomsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class RoomListResponse::_Internal {
+ public:
+};
 
-RoomListResponse::RoomListResponse()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_RoomListResponse.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.RoomListResponse)
+RoomListResponse::RoomListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.RoomListResponse)
 }
 RoomListResponse::RoomListResponse(const RoomListResponse& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      rooms_(from.rooms_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomListResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){from._impl_.rooms_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:sanguosha.RoomListResponse)
 }
 
-void RoomListResponse::SharedCtor() {
+inline void RoomListResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rooms_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 RoomListResponse::~RoomListResponse() {
   // @@protoc_insertion_point(destructor:sanguosha.RoomListResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RoomListResponse::SharedDtor() {
+inline void RoomListResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rooms_.~RepeatedPtrField();
 }
 
 void RoomListResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* RoomListResponse::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const RoomListResponse& RoomListResponse::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_RoomListResponse.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void RoomListResponse::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.RoomListResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rooms_.Clear();
-  _internal_metadata_.Clear();
+  _impl_.rooms_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool RoomListResponse::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.RoomListResponse)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* RoomListResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .sanguosha.RoomInfo rooms = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(10u /* 10 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_rooms()));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rooms(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.RoomListResponse)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.RoomListResponse)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void RoomListResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.RoomListResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* RoomListResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.RoomListResponse)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated .sanguosha.RoomInfo rooms = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->rooms_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1,
-      this->rooms(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rooms_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rooms(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_end:sanguosha.RoomListResponse)
-}
-
-::google::protobuf::uint8* RoomListResponse::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.RoomListResponse)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // repeated .sanguosha.RoomInfo rooms = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->rooms_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        1, this->rooms(static_cast<int>(i)), deterministic, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.RoomListResponse)
-  return target;
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.RoomListResponse)
+  return target;
 }
 
 size_t RoomListResponse::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.RoomListResponse)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .sanguosha.RoomInfo rooms = 1;
-  {
-    unsigned int count = static_cast<unsigned int>(this->rooms_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->rooms(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_rooms_size();
+  for (const auto& msg : this->_impl_.rooms_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RoomListResponse::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.RoomListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  const RoomListResponse* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const RoomListResponse>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.RoomListResponse)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.RoomListResponse)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomListResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomListResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomListResponse::GetClassData() const { return &_class_data_; }
 
-void RoomListResponse::MergeFrom(const RoomListResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomListResponse)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  rooms_.MergeFrom(from.rooms_);
-}
+void RoomListResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomListResponse*>(&to_msg);
+  auto& from = static_cast<const RoomListResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.RoomListResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void RoomListResponse::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.RoomListResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.rooms_.MergeFrom(from._impl_.rooms_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RoomListResponse::CopyFrom(const RoomListResponse& from) {
@@ -2720,217 +2578,185 @@ bool RoomListResponse::IsInitialized() const {
   return true;
 }
 
-void RoomListResponse::Swap(RoomListResponse* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void RoomListResponse::InternalSwap(RoomListResponse* other) {
   using std::swap;
-  CastToBase(&rooms_)->InternalSwap(CastToBase(&other->rooms_));
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rooms_.InternalSwap(&other->_impl_.rooms_);
 }
 
-::google::protobuf::Metadata RoomListResponse::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata RoomListResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[6]);
 }
 
-
 // ===================================================================
 
-void GameAction::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GameAction::kTypeFieldNumber;
-const int GameAction::kCardIdFieldNumber;
-const int GameAction::kTargetPlayerFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GameAction::_Internal {
+ public:
+};
 
-GameAction::GameAction()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_GameAction.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.GameAction)
+GameAction::GameAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameAction)
 }
 GameAction::GameAction(const GameAction& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::memcpy(&type_, &from.type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&target_player_) -
-    reinterpret_cast<char*>(&type_)) + sizeof(target_player_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameAction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , decltype(_impl_.card_id_){}
+    , decltype(_impl_.target_player_){}
+    , decltype(_impl_.sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.type_, &from._impl_.type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.sequence_) -
+    reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.sequence_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.GameAction)
 }
 
-void GameAction::SharedCtor() {
-  ::memset(&type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&target_player_) -
-      reinterpret_cast<char*>(&type_)) + sizeof(target_player_));
+inline void GameAction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){0}
+    , decltype(_impl_.card_id_){0u}
+    , decltype(_impl_.target_player_){0u}
+    , decltype(_impl_.sequence_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameAction::~GameAction() {
   // @@protoc_insertion_point(destructor:sanguosha.GameAction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameAction::SharedDtor() {
+inline void GameAction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void GameAction::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* GameAction::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GameAction& GameAction::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_GameAction.base);
-  return *internal_default_instance();
-}
-
 
 void GameAction::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.GameAction)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&target_player_) -
-      reinterpret_cast<char*>(&type_)) + sizeof(target_player_));
-  _internal_metadata_.Clear();
-}
-
-bool GameAction::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.GameAction)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  ::memset(&_impl_.type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.sequence_) -
+      reinterpret_cast<char*>(&_impl_.type_)) + sizeof(_impl_.sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameAction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .sanguosha.ActionType type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::sanguosha::ActionType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::sanguosha::ActionType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 card_id = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &card_id_)));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.card_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 target_player = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &target_player_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.target_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint32 sequence = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.GameAction)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.GameAction)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void GameAction::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.GameAction)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* GameAction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameAction)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .sanguosha.ActionType type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // uint32 card_id = 2;
-  if (this->card_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->card_id(), output);
+  if (this->_internal_card_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_card_id(), target);
   }
 
   // uint32 target_player = 3;
-  if (this->target_player() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->target_player(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.GameAction)
-}
-
-::google::protobuf::uint8* GameAction::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameAction)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .sanguosha.ActionType type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // uint32 card_id = 2;
-  if (this->card_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->card_id(), target);
+  if (this->_internal_target_player() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_target_player(), target);
   }
 
-  // uint32 target_player = 3;
-  if (this->target_player() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->target_player(), target);
+  // uint32 sequence = 4;
+  if (this->_internal_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_sequence(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameAction)
   return target;
@@ -2940,74 +2766,62 @@ size_t GameAction::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.GameAction)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .sanguosha.ActionType type = 1;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   // uint32 card_id = 2;
-  if (this->card_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->card_id());
+  if (this->_internal_card_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_card_id());
   }
 
   // uint32 target_player = 3;
-  if (this->target_player() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->target_player());
+  if (this->_internal_target_player() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_target_player());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void GameAction::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.GameAction)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameAction* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GameAction>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.GameAction)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.GameAction)
-    MergeFrom(*source);
+  // uint32 sequence = 4;
+  if (this->_internal_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_sequence());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameAction::MergeFrom(const GameAction& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameAction)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameAction::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameAction::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameAction::GetClassData() const { return &_class_data_; }
+
+
+void GameAction::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameAction*>(&to_msg);
+  auto& from = static_cast<const GameAction&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameAction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
-  if (from.card_id() != 0) {
-    set_card_id(from.card_id());
+  if (from._internal_card_id() != 0) {
+    _this->_internal_set_card_id(from._internal_card_id());
   }
-  if (from.target_player() != 0) {
-    set_target_player(from.target_player());
+  if (from._internal_target_player() != 0) {
+    _this->_internal_set_target_player(from._internal_target_player());
   }
-}
-
-void GameAction::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.GameAction)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_sequence() != 0) {
+    _this->_internal_set_sequence(from._internal_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameAction::CopyFrom(const GameAction& from) {
@@ -3021,307 +2835,234 @@ bool GameAction::IsInitialized() const {
   return true;
 }
 
-void GameAction::Swap(GameAction* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GameAction::InternalSwap(GameAction* other) {
   using std::swap;
-  swap(type_, other->type_);
-  swap(card_id_, other->card_id_);
-  swap(target_player_, other->target_player_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameAction, _impl_.sequence_)
+      + sizeof(GameAction::_impl_.sequence_)
+      - PROTOBUF_FIELD_OFFSET(GameAction, _impl_.type_)>(
+          reinterpret_cast<char*>(&_impl_.type_),
+          reinterpret_cast<char*>(&other->_impl_.type_));
 }
 
-::google::protobuf::Metadata GameAction::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GameAction::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[7]);
 }
 
-
 // ===================================================================
 
-void PlayerState::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int PlayerState::kPlayerIdFieldNumber;
-const int PlayerState::kUsernameFieldNumber;
-const int PlayerState::kHpFieldNumber;
-const int PlayerState::kMaxHpFieldNumber;
-const int PlayerState::kHandCardsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class PlayerState::_Internal {
+ public:
+};
 
-PlayerState::PlayerState()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_PlayerState.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.PlayerState)
+PlayerState::PlayerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.PlayerState)
 }
 PlayerState::PlayerState(const PlayerState& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      hand_cards_(from.hand_cards_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.username().size() > 0) {
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
-  }
-  ::memcpy(&player_id_, &from.player_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&max_hp_) -
-    reinterpret_cast<char*>(&player_id_)) + sizeof(max_hp_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hand_cards_){from._impl_.hand_cards_}
+    , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.hp_){}
+    , decltype(_impl_.max_hp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_hp_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.max_hp_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.PlayerState)
 }
 
-void PlayerState::SharedCtor() {
-  username_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&player_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_hp_) -
-      reinterpret_cast<char*>(&player_id_)) + sizeof(max_hp_));
+inline void PlayerState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.hand_cards_){arena}
+    , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.hp_){0u}
+    , decltype(_impl_.max_hp_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 PlayerState::~PlayerState() {
   // @@protoc_insertion_point(destructor:sanguosha.PlayerState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void PlayerState::SharedDtor() {
-  username_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void PlayerState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hand_cards_.~RepeatedField();
+  _impl_.username_.Destroy();
 }
 
 void PlayerState::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ::google::protobuf::Descriptor* PlayerState::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const PlayerState& PlayerState::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_PlayerState.base);
-  return *internal_default_instance();
-}
-
 
 void PlayerState::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.PlayerState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  hand_cards_.Clear();
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&player_id_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&max_hp_) -
-      reinterpret_cast<char*>(&player_id_)) + sizeof(max_hp_));
-  _internal_metadata_.Clear();
-}
-
-bool PlayerState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.PlayerState)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.hand_cards_.Clear();
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.player_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_hp_) -
+      reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.max_hp_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 player_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &player_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string username = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_username()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->username().data(), static_cast<int>(this->username().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.PlayerState.username"));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.PlayerState.username"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 hp = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &hp_)));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.hp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // uint32 max_hp = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(32u /* 32 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &max_hp_)));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.max_hp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated uint32 hand_cards = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_hand_cards())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(40u /* 40 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 42u, input, this->mutable_hand_cards())));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_hand_cards(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_hand_cards(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.PlayerState)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.PlayerState)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void PlayerState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.PlayerState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* PlayerState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.PlayerState)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->player_id(), output);
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
   }
 
   // string username = 2;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.PlayerState.username");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->username(), output);
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
   }
 
   // uint32 hp = 3;
-  if (this->hp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->hp(), output);
+  if (this->_internal_hp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_hp(), target);
   }
 
   // uint32 max_hp = 4;
-  if (this->max_hp() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->max_hp(), output);
+  if (this->_internal_max_hp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_hp(), target);
   }
 
   // repeated uint32 hand_cards = 5;
-  if (this->hand_cards_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(5, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _hand_cards_cached_byte_size_));
-  }
-  for (int i = 0, n = this->hand_cards_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->hand_cards(i), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.PlayerState)
-}
-
-::google::protobuf::uint8* PlayerState::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.PlayerState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->player_id(), target);
-  }
-
-  // string username = 2;
-  if (this->username().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->username().data(), static_cast<int>(this->username().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.PlayerState.username");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->username(), target);
-  }
-
-  // uint32 hp = 3;
-  if (this->hp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->hp(), target);
-  }
-
-  // uint32 max_hp = 4;
-  if (this->max_hp() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->max_hp(), target);
+  {
+    int byte_size = _impl_._hand_cards_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_hand_cards(), byte_size, target);
+    }
   }
 
-  // repeated uint32 hand_cards = 5;
-  if (this->hand_cards_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      5,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _hand_cards_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->hand_cards_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.PlayerState)
   return target;
@@ -3331,103 +3072,78 @@ size_t PlayerState::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.PlayerState)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated uint32 hand_cards = 5;
   {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->hand_cards_);
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.hand_cards_);
     if (data_size > 0) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _hand_cards_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._hand_cards_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // string username = 2;
-  if (this->username().size() > 0) {
+  if (!this->_internal_username().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->username());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
   }
 
   // uint32 player_id = 1;
-  if (this->player_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->player_id());
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
   }
 
   // uint32 hp = 3;
-  if (this->hp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->hp());
+  if (this->_internal_hp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hp());
   }
 
   // uint32 max_hp = 4;
-  if (this->max_hp() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->max_hp());
+  if (this->_internal_max_hp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_hp());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void PlayerState::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.PlayerState)
-  GOOGLE_DCHECK_NE(&from, this);
-  const PlayerState* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const PlayerState>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.PlayerState)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.PlayerState)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerState::GetClassData() const { return &_class_data_; }
 
-void PlayerState::MergeFrom(const PlayerState& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.PlayerState)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  hand_cards_.MergeFrom(from.hand_cards_);
-  if (from.username().size() > 0) {
+void PlayerState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerState*>(&to_msg);
+  auto& from = static_cast<const PlayerState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.PlayerState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    username_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.username_);
+  _this->_impl_.hand_cards_.MergeFrom(from._impl_.hand_cards_);
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
   }
-  if (from.player_id() != 0) {
-    set_player_id(from.player_id());
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
   }
-  if (from.hp() != 0) {
-    set_hp(from.hp());
+  if (from._internal_hp() != 0) {
+    _this->_internal_set_hp(from._internal_hp());
   }
-  if (from.max_hp() != 0) {
-    set_max_hp(from.max_hp());
+  if (from._internal_max_hp() != 0) {
+    _this->_internal_set_max_hp(from._internal_max_hp());
   }
-}
-
-void PlayerState::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.PlayerState)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void PlayerState::CopyFrom(const PlayerState& from) {
@@ -3441,274 +3157,258 @@ bool PlayerState::IsInitialized() const {
   return true;
 }
 
-void PlayerState::Swap(PlayerState* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void PlayerState::InternalSwap(PlayerState* other) {
   using std::swap;
-  hand_cards_.InternalSwap(&other->hand_cards_);
-  username_.Swap(&other->username_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(player_id_, other->player_id_);
-  swap(hp_, other->hp_);
-  swap(max_hp_, other->max_hp_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata PlayerState::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.hand_cards_.InternalSwap(&other->_impl_.hand_cards_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerState, _impl_.max_hp_)
+      + sizeof(PlayerState::_impl_.max_hp_)
+      - PROTOBUF_FIELD_OFFSET(PlayerState, _impl_.player_id_)>(
+          reinterpret_cast<char*>(&_impl_.player_id_),
+          reinterpret_cast<char*>(&other->_impl_.player_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[8]);
 }
 
-
 // ===================================================================
 
-void GameState::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GameState::kCurrentPlayerFieldNumber;
-const int GameState::kPlayersFieldNumber;
-const int GameState::kPhaseFieldNumber;
-const int GameState::kGameLogFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GameState::_Internal {
+ public:
+};
 
-GameState::GameState()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_GameState.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.GameState)
+GameState::GameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameState)
 }
 GameState::GameState(const GameState& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      players_(from.players_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  game_log_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  if (from.game_log().size() > 0) {
-    game_log_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.game_log_);
-  }
-  ::memcpy(&current_player_, &from.current_player_,
-    static_cast<size_t>(reinterpret_cast<char*>(&phase_) -
-    reinterpret_cast<char*>(&current_player_)) + sizeof(phase_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.players_){from._impl_.players_}
+    , decltype(_impl_.game_log_){}
+    , decltype(_impl_.current_player_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.acked_sequence_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.game_log_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_game_log().empty()) {
+    _this->_impl_.game_log_.Set(from._internal_game_log(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.current_player_, &from._impl_.current_player_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.acked_sequence_) -
+    reinterpret_cast<char*>(&_impl_.current_player_)) + sizeof(_impl_.acked_sequence_));
   // @@protoc_insertion_point(copy_constructor:sanguosha.GameState)
 }
 
-void GameState::SharedCtor() {
-  game_log_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&current_player_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&phase_) -
-      reinterpret_cast<char*>(&current_player_)) + sizeof(phase_));
+inline void GameState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.players_){arena}
+    , decltype(_impl_.game_log_){}
+    , decltype(_impl_.current_player_){0u}
+    , decltype(_impl_.phase_){0}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.acked_sequence_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.game_log_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 GameState::~GameState() {
   // @@protoc_insertion_point(destructor:sanguosha.GameState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameState::SharedDtor() {
-  game_log_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GameState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.players_.~RepeatedPtrField();
+  _impl_.game_log_.Destroy();
 }
 
 void GameState::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GameState::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GameState& GameState::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_GameState.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameState::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.GameState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  players_.Clear();
-  game_log_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  ::memset(&current_player_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&phase_) -
-      reinterpret_cast<char*>(&current_player_)) + sizeof(phase_));
-  _internal_metadata_.Clear();
-}
-
-bool GameState::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.GameState)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _impl_.players_.Clear();
+  _impl_.game_log_.ClearToEmpty();
+  ::memset(&_impl_.current_player_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.acked_sequence_) -
+      reinterpret_cast<char*>(&_impl_.current_player_)) + sizeof(_impl_.acked_sequence_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 current_player = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &current_player_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.current_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // repeated .sanguosha.PlayerState players = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-                input, add_players()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_players(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.GamePhase phase = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(24u /* 24 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_phase(static_cast< ::sanguosha::GamePhase >(value));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_phase(static_cast<::sanguosha::GamePhase>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // string game_log = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_game_log()));
-          DO_(::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-            this->game_log().data(), static_cast<int>(this->game_log().length()),
-            ::google::protobuf::internal::WireFormatLite::PARSE,
-            "sanguosha.GameState.game_log"));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_game_log();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.GameState.game_log"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // uint64 version = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 acked_sequence = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.acked_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.GameState)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.GameState)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void GameState::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.GameState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* GameState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameState)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 current_player = 1;
-  if (this->current_player() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->current_player(), output);
+  if (this->_internal_current_player() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_current_player(), target);
   }
 
   // repeated .sanguosha.PlayerState players = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->players_size()); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2,
-      this->players(static_cast<int>(i)),
-      output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_players_size()); i < n; i++) {
+    const auto& repfield = this->_internal_players(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // .sanguosha.GamePhase phase = 3;
-  if (this->phase() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      3, this->phase(), output);
+  if (this->_internal_phase() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_phase(), target);
   }
 
   // string game_log = 4;
-  if (this->game_log().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->game_log().data(), static_cast<int>(this->game_log().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
+  if (!this->_internal_game_log().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_game_log().data(), static_cast<int>(this->_internal_game_log().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
       "sanguosha.GameState.game_log");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      4, this->game_log(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.GameState)
-}
-
-::google::protobuf::uint8* GameState::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameState)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 current_player = 1;
-  if (this->current_player() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->current_player(), target);
-  }
-
-  // repeated .sanguosha.PlayerState players = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->players_size()); i < n; i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->players(static_cast<int>(i)), deterministic, target);
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_game_log(), target);
   }
 
-  // .sanguosha.GamePhase phase = 3;
-  if (this->phase() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      3, this->phase(), target);
+  // uint64 version = 5;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_version(), target);
   }
 
-  // string game_log = 4;
-  if (this->game_log().size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-      this->game_log().data(), static_cast<int>(this->game_log().length()),
-      ::google::protobuf::internal::WireFormatLite::SERIALIZE,
-      "sanguosha.GameState.game_log");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->game_log(), target);
+  // uint32 acked_sequence = 6;
+  if (this->_internal_acked_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_acked_sequence(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameState)
   return target;
@@ -3718,87 +3418,80 @@ size_t GameState::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.GameState)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .sanguosha.PlayerState players = 2;
-  {
-    unsigned int count = static_cast<unsigned int>(this->players_size());
-    total_size += 1UL * count;
-    for (unsigned int i = 0; i < count; i++) {
-      total_size +=
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          this->players(static_cast<int>(i)));
-    }
+  total_size += 1UL * this->_internal_players_size();
+  for (const auto& msg : this->_impl_.players_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string game_log = 4;
-  if (this->game_log().size() > 0) {
+  if (!this->_internal_game_log().empty()) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::StringSize(
-        this->game_log());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_game_log());
   }
 
   // uint32 current_player = 1;
-  if (this->current_player() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->current_player());
+  if (this->_internal_current_player() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_player());
   }
 
   // .sanguosha.GamePhase phase = 3;
-  if (this->phase() != 0) {
+  if (this->_internal_phase() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->phase());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
+  // uint64 version = 5;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
 
-void GameState::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.GameState)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameState* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GameState>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.GameState)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.GameState)
-    MergeFrom(*source);
+  // uint32 acked_sequence = 6;
+  if (this->_internal_acked_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_acked_sequence());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameState::MergeFrom(const GameState& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameState)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameState::GetClassData() const { return &_class_data_; }
+
 
-  players_.MergeFrom(from.players_);
-  if (from.game_log().size() > 0) {
+void GameState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameState*>(&to_msg);
+  auto& from = static_cast<const GameState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    game_log_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.game_log_);
+  _this->_impl_.players_.MergeFrom(from._impl_.players_);
+  if (!from._internal_game_log().empty()) {
+    _this->_internal_set_game_log(from._internal_game_log());
   }
-  if (from.current_player() != 0) {
-    set_current_player(from.current_player());
+  if (from._internal_current_player() != 0) {
+    _this->_internal_set_current_player(from._internal_current_player());
   }
-  if (from.phase() != 0) {
-    set_phase(from.phase());
+  if (from._internal_phase() != 0) {
+    _this->_internal_set_phase(from._internal_phase());
   }
-}
-
-void GameState::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.GameState)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_acked_sequence() != 0) {
+    _this->_internal_set_acked_sequence(from._internal_acked_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameState::CopyFrom(const GameState& from) {
@@ -3812,543 +3505,1788 @@ bool GameState::IsInitialized() const {
   return true;
 }
 
-void GameState::Swap(GameState* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GameState::InternalSwap(GameState* other) {
   using std::swap;
-  CastToBase(&players_)->InternalSwap(CastToBase(&other->players_));
-  game_log_.Swap(&other->game_log_, &::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-    GetArenaNoVirtual());
-  swap(current_player_, other->current_player_);
-  swap(phase_, other->phase_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
-}
-
-::google::protobuf::Metadata GameState::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.players_.InternalSwap(&other->_impl_.players_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.game_log_, lhs_arena,
+      &other->_impl_.game_log_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameState, _impl_.acked_sequence_)
+      + sizeof(GameState::_impl_.acked_sequence_)
+      - PROTOBUF_FIELD_OFFSET(GameState, _impl_.current_player_)>(
+          reinterpret_cast<char*>(&_impl_.current_player_),
+          reinterpret_cast<char*>(&other->_impl_.current_player_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[9]);
 }
 
-
 // ===================================================================
 
-void GameStart::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GameStart::kRoomIdFieldNumber;
-const int GameStart::kPlayerIdsFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-GameStart::GameStart()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_GameStart.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.GameStart)
-}
-GameStart::GameStart(const GameStart& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL),
-      player_ids_(from.player_ids_) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  room_id_ = from.room_id_;
-  // @@protoc_insertion_point(copy_constructor:sanguosha.GameStart)
-}
+class PlayerStateDelta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PlayerStateDelta>()._impl_._has_bits_);
+  static void set_has_username(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_hp(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_max_hp(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
 
-void GameStart::SharedCtor() {
-  room_id_ = 0u;
+PlayerStateDelta::PlayerStateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.PlayerStateDelta)
+}
+PlayerStateDelta::PlayerStateDelta(const PlayerStateDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PlayerStateDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hand_cards_){from._impl_.hand_cards_}
+    , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.player_id_){}
+    , decltype(_impl_.hp_){}
+    , decltype(_impl_.max_hp_){}
+    , decltype(_impl_.hand_cards_changed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_username()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.player_id_, &from._impl_.player_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.hand_cards_changed_) -
+    reinterpret_cast<char*>(&_impl_.player_id_)) + sizeof(_impl_.hand_cards_changed_));
+  // @@protoc_insertion_point(copy_constructor:sanguosha.PlayerStateDelta)
+}
+
+inline void PlayerStateDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hand_cards_){arena}
+    , /*decltype(_impl_._hand_cards_cached_byte_size_)*/{0}
+    , decltype(_impl_.username_){}
+    , decltype(_impl_.player_id_){0u}
+    , decltype(_impl_.hp_){0u}
+    , decltype(_impl_.max_hp_){0u}
+    , decltype(_impl_.hand_cards_changed_){false}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GameStart::~GameStart() {
-  // @@protoc_insertion_point(destructor:sanguosha.GameStart)
+PlayerStateDelta::~PlayerStateDelta() {
+  // @@protoc_insertion_point(destructor:sanguosha.PlayerStateDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameStart::SharedDtor() {
-}
-
-void GameStart::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GameStart::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
+inline void PlayerStateDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hand_cards_.~RepeatedField();
+  _impl_.username_.Destroy();
 }
 
-const GameStart& GameStart::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_GameStart.base);
-  return *internal_default_instance();
+void PlayerStateDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-
-void GameStart::Clear() {
-// @@protoc_insertion_point(message_clear_start:sanguosha.GameStart)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void PlayerStateDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:sanguosha.PlayerStateDelta)
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  player_ids_.Clear();
-  room_id_ = 0u;
-  _internal_metadata_.Clear();
-}
-
-bool GameStart::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.GameStart)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // uint32 room_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &room_id_)));
-        } else {
+  _impl_.hand_cards_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.username_.ClearNonDefaultToEmpty();
+  }
+  _impl_.player_id_ = 0u;
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.hp_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.max_hp_) -
+        reinterpret_cast<char*>(&_impl_.hp_)) + sizeof(_impl_.max_hp_));
+  }
+  _impl_.hand_cards_changed_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PlayerStateDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 player_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.player_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      // repeated uint32 player_ids = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, this->mutable_player_ids())));
-        } else if (
-            static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(16u /* 16 & 0xFF */)) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 1, 18u, input, this->mutable_player_ids())));
-        } else {
+        continue;
+      // optional string username = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.PlayerStateDelta.username"));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
+        continue;
+      // optional uint32 hp = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_hp(&has_bits);
+          _impl_.hp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 max_hp = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_max_hp(&has_bits);
+          _impl_.max_hp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool hand_cards_changed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.hand_cards_changed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 hand_cards = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_hand_cards(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_hand_cards(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PlayerStateDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.PlayerStateDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 player_id = 1;
+  if (this->_internal_player_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_player_id(), target);
+  }
+
+  // optional string username = 2;
+  if (_internal_has_username()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sanguosha.PlayerStateDelta.username");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_username(), target);
+  }
+
+  // optional uint32 hp = 3;
+  if (_internal_has_hp()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_hp(), target);
+  }
+
+  // optional uint32 max_hp = 4;
+  if (_internal_has_max_hp()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_max_hp(), target);
+  }
+
+  // bool hand_cards_changed = 5;
+  if (this->_internal_hand_cards_changed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_hand_cards_changed(), target);
+  }
+
+  // repeated uint32 hand_cards = 6;
+  {
+    int byte_size = _impl_._hand_cards_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_hand_cards(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.PlayerStateDelta)
+  return target;
+}
+
+size_t PlayerStateDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sanguosha.PlayerStateDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 hand_cards = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.hand_cards_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._hand_cards_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // optional string username = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // uint32 player_id = 1;
+  if (this->_internal_player_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_player_id());
+  }
+
+  if (cached_has_bits & 0x00000006u) {
+    // optional uint32 hp = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_hp());
+    }
+
+    // optional uint32 max_hp = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_max_hp());
+    }
+
+  }
+  // bool hand_cards_changed = 5;
+  if (this->_internal_hand_cards_changed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PlayerStateDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PlayerStateDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PlayerStateDelta::GetClassData() const { return &_class_data_; }
+
+
+void PlayerStateDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PlayerStateDelta*>(&to_msg);
+  auto& from = static_cast<const PlayerStateDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.PlayerStateDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.hand_cards_.MergeFrom(from._impl_.hand_cards_);
+  if (from._internal_has_username()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_player_id() != 0) {
+    _this->_internal_set_player_id(from._internal_player_id());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.hp_ = from._impl_.hp_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.max_hp_ = from._impl_.max_hp_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_hand_cards_changed() != 0) {
+    _this->_internal_set_hand_cards_changed(from._internal_hand_cards_changed());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PlayerStateDelta::CopyFrom(const PlayerStateDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.PlayerStateDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PlayerStateDelta::IsInitialized() const {
+  return true;
+}
+
+void PlayerStateDelta::InternalSwap(PlayerStateDelta* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.hand_cards_.InternalSwap(&other->_impl_.hand_cards_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PlayerStateDelta, _impl_.hand_cards_changed_)
+      + sizeof(PlayerStateDelta::_impl_.hand_cards_changed_)
+      - PROTOBUF_FIELD_OFFSET(PlayerStateDelta, _impl_.player_id_)>(
+          reinterpret_cast<char*>(&_impl_.player_id_),
+          reinterpret_cast<char*>(&other->_impl_.player_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PlayerStateDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[10]);
+}
+
+// ===================================================================
+
+class GameStateDelta::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GameStateDelta>()._impl_._has_bits_);
+  static void set_has_current_player(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_phase(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+GameStateDelta::GameStateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameStateDelta)
+}
+GameStateDelta::GameStateDelta(const GameStateDelta& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameStateDelta* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.players_){from._impl_.players_}
+    , decltype(_impl_.removed_players_){from._impl_.removed_players_}
+    , /*decltype(_impl_._removed_players_cached_byte_size_)*/{0}
+    , decltype(_impl_.game_log_){}
+    , decltype(_impl_.base_version_){}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.current_player_){}
+    , decltype(_impl_.phase_){}
+    , decltype(_impl_.acked_sequence_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.game_log_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_game_log().empty()) {
+    _this->_impl_.game_log_.Set(from._internal_game_log(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.base_version_, &from._impl_.base_version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.acked_sequence_) -
+    reinterpret_cast<char*>(&_impl_.base_version_)) + sizeof(_impl_.acked_sequence_));
+  // @@protoc_insertion_point(copy_constructor:sanguosha.GameStateDelta)
+}
+
+inline void GameStateDelta::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.players_){arena}
+    , decltype(_impl_.removed_players_){arena}
+    , /*decltype(_impl_._removed_players_cached_byte_size_)*/{0}
+    , decltype(_impl_.game_log_){}
+    , decltype(_impl_.base_version_){uint64_t{0u}}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.current_player_){0u}
+    , decltype(_impl_.phase_){0}
+    , decltype(_impl_.acked_sequence_){0u}
+  };
+  _impl_.game_log_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GameStateDelta::~GameStateDelta() {
+  // @@protoc_insertion_point(destructor:sanguosha.GameStateDelta)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameStateDelta::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.players_.~RepeatedPtrField();
+  _impl_.removed_players_.~RepeatedField();
+  _impl_.game_log_.Destroy();
+}
+
+void GameStateDelta::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameStateDelta::Clear() {
+// @@protoc_insertion_point(message_clear_start:sanguosha.GameStateDelta)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.players_.Clear();
+  _impl_.removed_players_.Clear();
+  _impl_.game_log_.ClearToEmpty();
+  ::memset(&_impl_.base_version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.version_) -
+      reinterpret_cast<char*>(&_impl_.base_version_)) + sizeof(_impl_.version_));
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.current_player_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.phase_) -
+        reinterpret_cast<char*>(&_impl_.current_player_)) + sizeof(_impl_.phase_));
+  }
+  _impl_.acked_sequence_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameStateDelta::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 base_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.base_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 current_player = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_current_player(&has_bits);
+          _impl_.current_player_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .sanguosha.GamePhase phase = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_phase(static_cast<::sanguosha::GamePhase>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .sanguosha.PlayerStateDelta players = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_players(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 removed_players = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_removed_players(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_removed_players(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string game_log = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_game_log();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "sanguosha.GameStateDelta.game_log"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 acked_sequence = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.acked_sequence_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameStateDelta::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameStateDelta)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 base_version = 1;
+  if (this->_internal_base_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_base_version(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // optional uint32 current_player = 3;
+  if (_internal_has_current_player()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_current_player(), target);
+  }
+
+  // optional .sanguosha.GamePhase phase = 4;
+  if (_internal_has_phase()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_phase(), target);
+  }
+
+  // repeated .sanguosha.PlayerStateDelta players = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_players_size()); i < n; i++) {
+    const auto& repfield = this->_internal_players(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 removed_players = 6;
+  {
+    int byte_size = _impl_._removed_players_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_removed_players(), byte_size, target);
+    }
+  }
+
+  // string game_log = 7;
+  if (!this->_internal_game_log().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_game_log().data(), static_cast<int>(this->_internal_game_log().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "sanguosha.GameStateDelta.game_log");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_game_log(), target);
+  }
+
+  // uint32 acked_sequence = 8;
+  if (this->_internal_acked_sequence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_acked_sequence(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameStateDelta)
+  return target;
+}
+
+size_t GameStateDelta::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sanguosha.GameStateDelta)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .sanguosha.PlayerStateDelta players = 5;
+  total_size += 1UL * this->_internal_players_size();
+  for (const auto& msg : this->_impl_.players_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated uint32 removed_players = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.removed_players_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._removed_players_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string game_log = 7;
+  if (!this->_internal_game_log().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_game_log());
+  }
+
+  // uint64 base_version = 1;
+  if (this->_internal_base_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_base_version());
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 current_player = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_player());
+    }
+
+    // optional .sanguosha.GamePhase phase = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_phase());
+    }
+
+  }
+  // uint32 acked_sequence = 8;
+  if (this->_internal_acked_sequence() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_acked_sequence());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameStateDelta::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameStateDelta::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameStateDelta::GetClassData() const { return &_class_data_; }
+
+
+void GameStateDelta::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameStateDelta*>(&to_msg);
+  auto& from = static_cast<const GameStateDelta&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameStateDelta)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.players_.MergeFrom(from._impl_.players_);
+  _this->_impl_.removed_players_.MergeFrom(from._impl_.removed_players_);
+  if (!from._internal_game_log().empty()) {
+    _this->_internal_set_game_log(from._internal_game_log());
+  }
+  if (from._internal_base_version() != 0) {
+    _this->_internal_set_base_version(from._internal_base_version());
+  }
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.current_player_ = from._impl_.current_player_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.phase_ = from._impl_.phase_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_acked_sequence() != 0) {
+    _this->_internal_set_acked_sequence(from._internal_acked_sequence());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameStateDelta::CopyFrom(const GameStateDelta& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.GameStateDelta)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameStateDelta::IsInitialized() const {
+  return true;
+}
+
+void GameStateDelta::InternalSwap(GameStateDelta* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.players_.InternalSwap(&other->_impl_.players_);
+  _impl_.removed_players_.InternalSwap(&other->_impl_.removed_players_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.game_log_, lhs_arena,
+      &other->_impl_.game_log_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GameStateDelta, _impl_.acked_sequence_)
+      + sizeof(GameStateDelta::_impl_.acked_sequence_)
+      - PROTOBUF_FIELD_OFFSET(GameStateDelta, _impl_.base_version_)>(
+          reinterpret_cast<char*>(&_impl_.base_version_),
+          reinterpret_cast<char*>(&other->_impl_.base_version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameStateDelta::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[11]);
+}
+
+// ===================================================================
+
+class GameStateRequest::_Internal {
+ public:
+};
+
+GameStateRequest::GameStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameStateRequest)
+}
+GameStateRequest::GameStateRequest(const GameStateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameStateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.known_version_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.known_version_ = from._impl_.known_version_;
+  // @@protoc_insertion_point(copy_constructor:sanguosha.GameStateRequest)
+}
+
+inline void GameStateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.known_version_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GameStateRequest::~GameStateRequest() {
+  // @@protoc_insertion_point(destructor:sanguosha.GameStateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameStateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void GameStateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameStateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:sanguosha.GameStateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.known_version_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameStateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 known_version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.known_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameStateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameStateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 known_version = 1;
+  if (this->_internal_known_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_known_version(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameStateRequest)
+  return target;
+}
+
+size_t GameStateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sanguosha.GameStateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 known_version = 1;
+  if (this->_internal_known_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_known_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameStateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameStateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameStateRequest::GetClassData() const { return &_class_data_; }
+
+
+void GameStateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameStateRequest*>(&to_msg);
+  auto& from = static_cast<const GameStateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameStateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_known_version() != 0) {
+    _this->_internal_set_known_version(from._internal_known_version());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameStateRequest::CopyFrom(const GameStateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.GameStateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameStateRequest::IsInitialized() const {
+  return true;
+}
+
+void GameStateRequest::InternalSwap(GameStateRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.known_version_, other->_impl_.known_version_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameStateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[12]);
+}
+
+// ===================================================================
+
+class GameStart::_Internal {
+ public:
+};
+
+GameStart::GameStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameStart)
+}
+GameStart::GameStart(const GameStart& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameStart* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.player_ids_){from._impl_.player_ids_}
+    , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.room_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.room_id_ = from._impl_.room_id_;
+  // @@protoc_insertion_point(copy_constructor:sanguosha.GameStart)
+}
+
+inline void GameStart::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.player_ids_){arena}
+    , /*decltype(_impl_._player_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.room_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GameStart::~GameStart() {
+  // @@protoc_insertion_point(destructor:sanguosha.GameStart)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GameStart::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.player_ids_.~RepeatedField();
+}
+
+void GameStart::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GameStart::Clear() {
+// @@protoc_insertion_point(message_clear_start:sanguosha.GameStart)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.player_ids_.Clear();
+  _impl_.room_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameStart::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 room_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.room_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 player_ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_player_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_player_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GameStart::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameStart)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 room_id = 1;
+  if (this->_internal_room_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_room_id(), target);
+  }
+
+  // repeated uint32 player_ids = 2;
+  {
+    int byte_size = _impl_._player_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_player_ids(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameStart)
+  return target;
+}
+
+size_t GameStart::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sanguosha.GameStart)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 player_ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.player_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._player_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // uint32 room_id = 1;
+  if (this->_internal_room_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_room_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameStart::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameStart::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameStart::GetClassData() const { return &_class_data_; }
+
+
+void GameStart::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameStart*>(&to_msg);
+  auto& from = static_cast<const GameStart&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameStart)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.player_ids_.MergeFrom(from._impl_.player_ids_);
+  if (from._internal_room_id() != 0) {
+    _this->_internal_set_room_id(from._internal_room_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GameStart::CopyFrom(const GameStart& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.GameStart)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GameStart::IsInitialized() const {
+  return true;
+}
+
+void GameStart::InternalSwap(GameStart* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.player_ids_.InternalSwap(&other->_impl_.player_ids_);
+  swap(_impl_.room_id_, other->_impl_.room_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GameStart::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[13]);
+}
+
+// ===================================================================
+
+class MessageBatch::_Internal {
+ public:
+};
+
+MessageBatch::MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.MessageBatch)
+}
+MessageBatch::MessageBatch(const MessageBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MessageBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:sanguosha.MessageBatch)
+}
+
+inline void MessageBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
-    }
+MessageBatch::~MessageBatch() {
+  // @@protoc_insertion_point(destructor:sanguosha.MessageBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.GameStart)
-  return true;
-failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.GameStart)
-  return false;
-#undef DO_
+  SharedDtor();
 }
 
-void GameStart::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.GameStart)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
+inline void MessageBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
 
-  // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->room_id(), output);
-  }
+void MessageBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
-  // repeated uint32 player_ids = 2;
-  if (this->player_ids_size() > 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteTag(2, ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
-    output->WriteVarint32(static_cast< ::google::protobuf::uint32>(
-        _player_ids_cached_byte_size_));
-  }
-  for (int i = 0, n = this->player_ids_size(); i < n; i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32NoTag(
-      this->player_ids(i), output);
-  }
+void MessageBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:sanguosha.MessageBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.GameStart)
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MessageBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .sanguosha.GameMessage messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GameStart::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameStart)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* MessageBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.MessageBatch)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->room_id(), target);
+  // repeated .sanguosha.GameMessage messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // repeated uint32 player_ids = 2;
-  if (this->player_ids_size() > 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(
-      2,
-      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
-      target);
-    target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(
-        static_cast< ::google::protobuf::int32>(
-            _player_ids_cached_byte_size_), target);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteUInt32NoTagToArray(this->player_ids_, target);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameStart)
+  // @@protoc_insertion_point(serialize_to_array_end:sanguosha.MessageBatch)
   return target;
 }
 
-size_t GameStart::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:sanguosha.GameStart)
+size_t MessageBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:sanguosha.MessageBatch)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
-  // repeated uint32 player_ids = 2;
-  {
-    size_t data_size = ::google::protobuf::internal::WireFormatLite::
-      UInt32Size(this->player_ids_);
-    if (data_size > 0) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-            static_cast< ::google::protobuf::int32>(data_size));
-    }
-    int cached_size = ::google::protobuf::internal::ToCachedSize(data_size);
-    GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-    _player_ids_cached_byte_size_ = cached_size;
-    GOOGLE_SAFE_CONCURRENT_WRITES_END();
-    total_size += data_size;
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  // uint32 room_id = 1;
-  if (this->room_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->room_id());
+  // repeated .sanguosha.GameMessage messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameStart::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.GameStart)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameStart* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GameStart>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.GameStart)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.GameStart)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MessageBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MessageBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MessageBatch::GetClassData() const { return &_class_data_; }
 
-void GameStart::MergeFrom(const GameStart& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameStart)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  player_ids_.MergeFrom(from.player_ids_);
-  if (from.room_id() != 0) {
-    set_room_id(from.room_id());
-  }
-}
+void MessageBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MessageBatch*>(&to_msg);
+  auto& from = static_cast<const MessageBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.MessageBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GameStart::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.GameStart)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GameStart::CopyFrom(const GameStart& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.GameStart)
+void MessageBatch::CopyFrom(const MessageBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:sanguosha.MessageBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GameStart::IsInitialized() const {
+bool MessageBatch::IsInitialized() const {
   return true;
 }
 
-void GameStart::Swap(GameStart* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
-void GameStart::InternalSwap(GameStart* other) {
+void MessageBatch::InternalSwap(MessageBatch* other) {
   using std::swap;
-  player_ids_.InternalSwap(&other->player_ids_);
-  swap(room_id_, other->room_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
 }
 
-::google::protobuf::Metadata GameStart::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata MessageBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[14]);
 }
 
-
 // ===================================================================
 
-void GameMessage::InitAsDefaultInstance() {
-  ::sanguosha::_GameMessage_default_instance_.login_request_ = const_cast< ::sanguosha::LoginRequest*>(
-      ::sanguosha::LoginRequest::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.login_response_ = const_cast< ::sanguosha::LoginResponse*>(
-      ::sanguosha::LoginResponse::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.heartbeat_ = const_cast< ::sanguosha::Heartbeat*>(
-      ::sanguosha::Heartbeat::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.room_request_ = const_cast< ::sanguosha::RoomRequest*>(
-      ::sanguosha::RoomRequest::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.room_response_ = const_cast< ::sanguosha::RoomResponse*>(
-      ::sanguosha::RoomResponse::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.game_action_ = const_cast< ::sanguosha::GameAction*>(
-      ::sanguosha::GameAction::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.game_state_ = const_cast< ::sanguosha::GameState*>(
-      ::sanguosha::GameState::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.game_start_ = const_cast< ::sanguosha::GameStart*>(
-      ::sanguosha::GameStart::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.game_over_ = const_cast< ::sanguosha::GameOver*>(
-      ::sanguosha::GameOver::internal_default_instance());
-  ::sanguosha::_GameMessage_default_instance_.room_list_response_ = const_cast< ::sanguosha::RoomListResponse*>(
-      ::sanguosha::RoomListResponse::internal_default_instance());
+class GameMessage::_Internal {
+ public:
+  static const ::sanguosha::LoginRequest& login_request(const GameMessage* msg);
+  static const ::sanguosha::LoginResponse& login_response(const GameMessage* msg);
+  static const ::sanguosha::Heartbeat& heartbeat(const GameMessage* msg);
+  static const ::sanguosha::RoomRequest& room_request(const GameMessage* msg);
+  static const ::sanguosha::RoomResponse& room_response(const GameMessage* msg);
+  static const ::sanguosha::GameAction& game_action(const GameMessage* msg);
+  static const ::sanguosha::GameState& game_state(const GameMessage* msg);
+  static const ::sanguosha::GameStart& game_start(const GameMessage* msg);
+  static const ::sanguosha::GameOver& game_over(const GameMessage* msg);
+  static const ::sanguosha::GameStateDelta& game_state_delta(const GameMessage* msg);
+  static const ::sanguosha::GameStateRequest& game_state_request(const GameMessage* msg);
+  static const ::sanguosha::RoomListResponse& room_list_response(const GameMessage* msg);
+  static const ::sanguosha::MessageBatch& batch(const GameMessage* msg);
+};
+
+const ::sanguosha::LoginRequest&
+GameMessage::_Internal::login_request(const GameMessage* msg) {
+  return *msg->_impl_.content_.login_request_;
+}
+const ::sanguosha::LoginResponse&
+GameMessage::_Internal::login_response(const GameMessage* msg) {
+  return *msg->_impl_.content_.login_response_;
+}
+const ::sanguosha::Heartbeat&
+GameMessage::_Internal::heartbeat(const GameMessage* msg) {
+  return *msg->_impl_.content_.heartbeat_;
+}
+const ::sanguosha::RoomRequest&
+GameMessage::_Internal::room_request(const GameMessage* msg) {
+  return *msg->_impl_.content_.room_request_;
+}
+const ::sanguosha::RoomResponse&
+GameMessage::_Internal::room_response(const GameMessage* msg) {
+  return *msg->_impl_.content_.room_response_;
+}
+const ::sanguosha::GameAction&
+GameMessage::_Internal::game_action(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_action_;
+}
+const ::sanguosha::GameState&
+GameMessage::_Internal::game_state(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_state_;
+}
+const ::sanguosha::GameStart&
+GameMessage::_Internal::game_start(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_start_;
+}
+const ::sanguosha::GameOver&
+GameMessage::_Internal::game_over(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_over_;
+}
+const ::sanguosha::GameStateDelta&
+GameMessage::_Internal::game_state_delta(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_state_delta_;
+}
+const ::sanguosha::GameStateRequest&
+GameMessage::_Internal::game_state_request(const GameMessage* msg) {
+  return *msg->_impl_.content_.game_state_request_;
+}
+const ::sanguosha::RoomListResponse&
+GameMessage::_Internal::room_list_response(const GameMessage* msg) {
+  return *msg->_impl_.content_.room_list_response_;
+}
+const ::sanguosha::MessageBatch&
+GameMessage::_Internal::batch(const GameMessage* msg) {
+  return *msg->_impl_.content_.batch_;
 }
 void GameMessage::set_allocated_login_request(::sanguosha::LoginRequest* login_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (login_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(login_request);
     if (message_arena != submessage_arena) {
-      login_request = ::google::protobuf::internal::GetOwnedMessage(
+      login_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, login_request, submessage_arena);
     }
     set_has_login_request();
-    content_.login_request_ = login_request;
+    _impl_.content_.login_request_ = login_request;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.login_request)
 }
 void GameMessage::set_allocated_login_response(::sanguosha::LoginResponse* login_response) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (login_response) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(login_response);
     if (message_arena != submessage_arena) {
-      login_response = ::google::protobuf::internal::GetOwnedMessage(
+      login_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, login_response, submessage_arena);
     }
     set_has_login_response();
-    content_.login_response_ = login_response;
+    _impl_.content_.login_response_ = login_response;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.login_response)
 }
 void GameMessage::set_allocated_heartbeat(::sanguosha::Heartbeat* heartbeat) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (heartbeat) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(heartbeat);
     if (message_arena != submessage_arena) {
-      heartbeat = ::google::protobuf::internal::GetOwnedMessage(
+      heartbeat = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, heartbeat, submessage_arena);
     }
     set_has_heartbeat();
-    content_.heartbeat_ = heartbeat;
+    _impl_.content_.heartbeat_ = heartbeat;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.heartbeat)
 }
 void GameMessage::set_allocated_room_request(::sanguosha::RoomRequest* room_request) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (room_request) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_request);
     if (message_arena != submessage_arena) {
-      room_request = ::google::protobuf::internal::GetOwnedMessage(
+      room_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, room_request, submessage_arena);
     }
     set_has_room_request();
-    content_.room_request_ = room_request;
+    _impl_.content_.room_request_ = room_request;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.room_request)
 }
 void GameMessage::set_allocated_room_response(::sanguosha::RoomResponse* room_response) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (room_response) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_response);
     if (message_arena != submessage_arena) {
-      room_response = ::google::protobuf::internal::GetOwnedMessage(
+      room_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, room_response, submessage_arena);
     }
     set_has_room_response();
-    content_.room_response_ = room_response;
+    _impl_.content_.room_response_ = room_response;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.room_response)
 }
 void GameMessage::set_allocated_game_action(::sanguosha::GameAction* game_action) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (game_action) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_action);
     if (message_arena != submessage_arena) {
-      game_action = ::google::protobuf::internal::GetOwnedMessage(
+      game_action = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, game_action, submessage_arena);
     }
     set_has_game_action();
-    content_.game_action_ = game_action;
+    _impl_.content_.game_action_ = game_action;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_action)
 }
 void GameMessage::set_allocated_game_state(::sanguosha::GameState* game_state) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (game_state) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_state);
     if (message_arena != submessage_arena) {
-      game_state = ::google::protobuf::internal::GetOwnedMessage(
+      game_state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, game_state, submessage_arena);
     }
     set_has_game_state();
-    content_.game_state_ = game_state;
+    _impl_.content_.game_state_ = game_state;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_state)
 }
 void GameMessage::set_allocated_game_start(::sanguosha::GameStart* game_start) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (game_start) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_start);
     if (message_arena != submessage_arena) {
-      game_start = ::google::protobuf::internal::GetOwnedMessage(
+      game_start = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, game_start, submessage_arena);
     }
     set_has_game_start();
-    content_.game_start_ = game_start;
+    _impl_.content_.game_start_ = game_start;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_start)
 }
 void GameMessage::set_allocated_game_over(::sanguosha::GameOver* game_over) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (game_over) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_over);
     if (message_arena != submessage_arena) {
-      game_over = ::google::protobuf::internal::GetOwnedMessage(
+      game_over = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, game_over, submessage_arena);
     }
     set_has_game_over();
-    content_.game_over_ = game_over;
+    _impl_.content_.game_over_ = game_over;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_over)
 }
+void GameMessage::set_allocated_game_state_delta(::sanguosha::GameStateDelta* game_state_delta) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_content();
+  if (game_state_delta) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_state_delta);
+    if (message_arena != submessage_arena) {
+      game_state_delta = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game_state_delta, submessage_arena);
+    }
+    set_has_game_state_delta();
+    _impl_.content_.game_state_delta_ = game_state_delta;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_state_delta)
+}
+void GameMessage::set_allocated_game_state_request(::sanguosha::GameStateRequest* game_state_request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_content();
+  if (game_state_request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game_state_request);
+    if (message_arena != submessage_arena) {
+      game_state_request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game_state_request, submessage_arena);
+    }
+    set_has_game_state_request();
+    _impl_.content_.game_state_request_ = game_state_request;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.game_state_request)
+}
 void GameMessage::set_allocated_room_list_response(::sanguosha::RoomListResponse* room_list_response) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   clear_content();
   if (room_list_response) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_list_response);
     if (message_arena != submessage_arena) {
-      room_list_response = ::google::protobuf::internal::GetOwnedMessage(
+      room_list_response = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, room_list_response, submessage_arena);
     }
     set_has_room_list_response();
-    content_.room_list_response_ = room_list_response;
+    _impl_.content_.room_list_response_ = room_list_response;
   }
   // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.room_list_response)
 }
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GameMessage::kTypeFieldNumber;
-const int GameMessage::kLoginRequestFieldNumber;
-const int GameMessage::kLoginResponseFieldNumber;
-const int GameMessage::kHeartbeatFieldNumber;
-const int GameMessage::kRoomRequestFieldNumber;
-const int GameMessage::kRoomResponseFieldNumber;
-const int GameMessage::kGameActionFieldNumber;
-const int GameMessage::kGameStateFieldNumber;
-const int GameMessage::kGameStartFieldNumber;
-const int GameMessage::kGameOverFieldNumber;
-const int GameMessage::kRoomListResponseFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
-
-GameMessage::GameMessage()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_GameMessage.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.GameMessage)
+void GameMessage::set_allocated_batch(::sanguosha::MessageBatch* batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_content();
+  if (batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(batch);
+    if (message_arena != submessage_arena) {
+      batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, batch, submessage_arena);
+    }
+    set_has_batch();
+    _impl_.content_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameMessage.batch)
+}
+GameMessage::GameMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameMessage)
 }
 GameMessage::GameMessage(const GameMessage& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  type_ = from.type_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.type_ = from._impl_.type_;
   clear_has_content();
   switch (from.content_case()) {
     case kLoginRequest: {
-      mutable_login_request()->::sanguosha::LoginRequest::MergeFrom(from.login_request());
+      _this->_internal_mutable_login_request()->::sanguosha::LoginRequest::MergeFrom(
+          from._internal_login_request());
       break;
     }
     case kLoginResponse: {
-      mutable_login_response()->::sanguosha::LoginResponse::MergeFrom(from.login_response());
+      _this->_internal_mutable_login_response()->::sanguosha::LoginResponse::MergeFrom(
+          from._internal_login_response());
       break;
     }
     case kHeartbeat: {
-      mutable_heartbeat()->::sanguosha::Heartbeat::MergeFrom(from.heartbeat());
+      _this->_internal_mutable_heartbeat()->::sanguosha::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
       break;
     }
     case kRoomRequest: {
-      mutable_room_request()->::sanguosha::RoomRequest::MergeFrom(from.room_request());
+      _this->_internal_mutable_room_request()->::sanguosha::RoomRequest::MergeFrom(
+          from._internal_room_request());
       break;
     }
     case kRoomResponse: {
-      mutable_room_response()->::sanguosha::RoomResponse::MergeFrom(from.room_response());
+      _this->_internal_mutable_room_response()->::sanguosha::RoomResponse::MergeFrom(
+          from._internal_room_response());
       break;
     }
     case kGameAction: {
-      mutable_game_action()->::sanguosha::GameAction::MergeFrom(from.game_action());
+      _this->_internal_mutable_game_action()->::sanguosha::GameAction::MergeFrom(
+          from._internal_game_action());
       break;
     }
     case kGameState: {
-      mutable_game_state()->::sanguosha::GameState::MergeFrom(from.game_state());
+      _this->_internal_mutable_game_state()->::sanguosha::GameState::MergeFrom(
+          from._internal_game_state());
       break;
     }
     case kGameStart: {
-      mutable_game_start()->::sanguosha::GameStart::MergeFrom(from.game_start());
+      _this->_internal_mutable_game_start()->::sanguosha::GameStart::MergeFrom(
+          from._internal_game_start());
       break;
     }
     case kGameOver: {
-      mutable_game_over()->::sanguosha::GameOver::MergeFrom(from.game_over());
+      _this->_internal_mutable_game_over()->::sanguosha::GameOver::MergeFrom(
+          from._internal_game_over());
+      break;
+    }
+    case kGameStateDelta: {
+      _this->_internal_mutable_game_state_delta()->::sanguosha::GameStateDelta::MergeFrom(
+          from._internal_game_state_delta());
+      break;
+    }
+    case kGameStateRequest: {
+      _this->_internal_mutable_game_state_request()->::sanguosha::GameStateRequest::MergeFrom(
+          from._internal_game_state_request());
       break;
     }
     case kRoomListResponse: {
-      mutable_room_list_response()->::sanguosha::RoomListResponse::MergeFrom(from.room_list_response());
+      _this->_internal_mutable_room_list_response()->::sanguosha::RoomListResponse::MergeFrom(
+          from._internal_room_list_response());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::sanguosha::MessageBatch::MergeFrom(
+          from._internal_batch());
       break;
     }
     case CONTENT_NOT_SET: {
@@ -4358,428 +5296,388 @@ GameMessage::GameMessage(const GameMessage& from)
   // @@protoc_insertion_point(copy_constructor:sanguosha.GameMessage)
 }
 
-void GameMessage::SharedCtor() {
-  type_ = 0;
+inline void GameMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){0}
+    , decltype(_impl_.content_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
   clear_has_content();
 }
 
 GameMessage::~GameMessage() {
   // @@protoc_insertion_point(destructor:sanguosha.GameMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameMessage::SharedDtor() {
+inline void GameMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   if (has_content()) {
     clear_content();
   }
 }
 
 void GameMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GameMessage::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GameMessage& GameMessage::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_GameMessage.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameMessage::clear_content() {
 // @@protoc_insertion_point(one_of_clear_start:sanguosha.GameMessage)
   switch (content_case()) {
     case kLoginRequest: {
-      delete content_.login_request_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.login_request_;
+      }
       break;
     }
     case kLoginResponse: {
-      delete content_.login_response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.login_response_;
+      }
       break;
     }
     case kHeartbeat: {
-      delete content_.heartbeat_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.heartbeat_;
+      }
       break;
     }
     case kRoomRequest: {
-      delete content_.room_request_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.room_request_;
+      }
       break;
     }
     case kRoomResponse: {
-      delete content_.room_response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.room_response_;
+      }
       break;
     }
     case kGameAction: {
-      delete content_.game_action_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_action_;
+      }
       break;
     }
     case kGameState: {
-      delete content_.game_state_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_state_;
+      }
       break;
     }
     case kGameStart: {
-      delete content_.game_start_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_start_;
+      }
       break;
     }
     case kGameOver: {
-      delete content_.game_over_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_over_;
+      }
+      break;
+    }
+    case kGameStateDelta: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_state_delta_;
+      }
+      break;
+    }
+    case kGameStateRequest: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.game_state_request_;
+      }
       break;
     }
     case kRoomListResponse: {
-      delete content_.room_list_response_;
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.room_list_response_;
+      }
+      break;
+    }
+    case kBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.content_.batch_;
+      }
       break;
     }
     case CONTENT_NOT_SET: {
       break;
     }
   }
-  _oneof_case_[0] = CONTENT_NOT_SET;
+  _impl_._oneof_case_[0] = CONTENT_NOT_SET;
 }
 
 
 void GameMessage::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.GameMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  type_ = 0;
+  _impl_.type_ = 0;
   clear_content();
-  _internal_metadata_.Clear();
-}
-
-bool GameMessage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.GameMessage)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GameMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // .sanguosha.MessageType type = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          set_type(static_cast< ::sanguosha::MessageType >(value));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::sanguosha::MessageType>(val));
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.LoginRequest login_request = 2;
-      case 2: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(18u /* 18 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_login_request()));
-        } else {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_login_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.LoginResponse login_response = 3;
-      case 3: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(26u /* 26 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_login_response()));
-        } else {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_login_response(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.Heartbeat heartbeat = 4;
-      case 4: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(34u /* 34 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_heartbeat()));
-        } else {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_heartbeat(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.RoomRequest room_request = 5;
-      case 5: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(42u /* 42 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_room_request()));
-        } else {
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room_request(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.RoomResponse room_response = 6;
-      case 6: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(50u /* 50 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_room_response()));
-        } else {
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room_response(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.GameAction game_action = 7;
-      case 7: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(58u /* 58 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_game_action()));
-        } else {
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_action(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.GameState game_state = 8;
-      case 8: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(66u /* 66 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_game_state()));
-        } else {
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_state(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.GameStart game_start = 9;
-      case 9: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(74u /* 74 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_game_start()));
-        } else {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_start(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
       // .sanguosha.GameOver game_over = 10;
-      case 10: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(82u /* 82 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_game_over()));
-        } else {
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_over(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
+        continue;
+      // .sanguosha.GameStateDelta game_state_delta = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_state_delta(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .sanguosha.GameStateRequest game_state_request = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_game_state_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // .sanguosha.RoomListResponse room_list_response = 14;
-      case 14: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(114u /* 114 & 0xFF */)) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessage(
-               input, mutable_room_list_response()));
-        } else {
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room_list_response(), ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      // .sanguosha.MessageBatch batch = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.GameMessage)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.GameMessage)
-  return false;
-#undef DO_
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void GameMessage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.GameMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+uint8_t* GameMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameMessage)
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // .sanguosha.MessageType type = 1;
-  if (this->type() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->type(), output);
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_type(), target);
   }
 
   // .sanguosha.LoginRequest login_request = 2;
-  if (has_login_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->_internal_login_request(), output);
+  if (_internal_has_login_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::login_request(this),
+        _Internal::login_request(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.LoginResponse login_response = 3;
-  if (has_login_response()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->_internal_login_response(), output);
+  if (_internal_has_login_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::login_response(this),
+        _Internal::login_response(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.Heartbeat heartbeat = 4;
-  if (has_heartbeat()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->_internal_heartbeat(), output);
+  if (_internal_has_heartbeat()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::heartbeat(this),
+        _Internal::heartbeat(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.RoomRequest room_request = 5;
-  if (has_room_request()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->_internal_room_request(), output);
+  if (_internal_has_room_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::room_request(this),
+        _Internal::room_request(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.RoomResponse room_response = 6;
-  if (has_room_response()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->_internal_room_response(), output);
+  if (_internal_has_room_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::room_response(this),
+        _Internal::room_response(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.GameAction game_action = 7;
-  if (has_game_action()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->_internal_game_action(), output);
+  if (_internal_has_game_action()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::game_action(this),
+        _Internal::game_action(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.GameState game_state = 8;
-  if (has_game_state()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->_internal_game_state(), output);
+  if (_internal_has_game_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::game_state(this),
+        _Internal::game_state(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.GameStart game_start = 9;
-  if (has_game_start()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      9, this->_internal_game_start(), output);
+  if (_internal_has_game_start()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::game_start(this),
+        _Internal::game_start(this).GetCachedSize(), target, stream);
   }
 
   // .sanguosha.GameOver game_over = 10;
-  if (has_game_over()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->_internal_game_over(), output);
-  }
-
-  // .sanguosha.RoomListResponse room_list_response = 14;
-  if (has_room_list_response()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      14, this->_internal_room_list_response(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.GameMessage)
-}
-
-::google::protobuf::uint8* GameMessage::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
-  // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameMessage)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .sanguosha.MessageType type = 1;
-  if (this->type() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->type(), target);
-  }
-
-  // .sanguosha.LoginRequest login_request = 2;
-  if (has_login_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        2, this->_internal_login_request(), deterministic, target);
-  }
-
-  // .sanguosha.LoginResponse login_response = 3;
-  if (has_login_response()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        3, this->_internal_login_response(), deterministic, target);
-  }
-
-  // .sanguosha.Heartbeat heartbeat = 4;
-  if (has_heartbeat()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        4, this->_internal_heartbeat(), deterministic, target);
-  }
-
-  // .sanguosha.RoomRequest room_request = 5;
-  if (has_room_request()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        5, this->_internal_room_request(), deterministic, target);
-  }
-
-  // .sanguosha.RoomResponse room_response = 6;
-  if (has_room_response()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        6, this->_internal_room_response(), deterministic, target);
-  }
-
-  // .sanguosha.GameAction game_action = 7;
-  if (has_game_action()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        7, this->_internal_game_action(), deterministic, target);
+  if (_internal_has_game_over()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::game_over(this),
+        _Internal::game_over(this).GetCachedSize(), target, stream);
   }
 
-  // .sanguosha.GameState game_state = 8;
-  if (has_game_state()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        8, this->_internal_game_state(), deterministic, target);
+  // .sanguosha.GameStateDelta game_state_delta = 11;
+  if (_internal_has_game_state_delta()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::game_state_delta(this),
+        _Internal::game_state_delta(this).GetCachedSize(), target, stream);
   }
 
-  // .sanguosha.GameStart game_start = 9;
-  if (has_game_start()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        9, this->_internal_game_start(), deterministic, target);
+  // .sanguosha.GameStateRequest game_state_request = 12;
+  if (_internal_has_game_state_request()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::game_state_request(this),
+        _Internal::game_state_request(this).GetCachedSize(), target, stream);
   }
 
-  // .sanguosha.GameOver game_over = 10;
-  if (has_game_over()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        10, this->_internal_game_over(), deterministic, target);
+  // .sanguosha.RoomListResponse room_list_response = 14;
+  if (_internal_has_room_list_response()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(14, _Internal::room_list_response(this),
+        _Internal::room_list_response(this).GetCachedSize(), target, stream);
   }
 
-  // .sanguosha.RoomListResponse room_list_response = 14;
-  if (has_room_list_response()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      InternalWriteMessageToArray(
-        14, this->_internal_room_list_response(), deterministic, target);
+  // .sanguosha.MessageBatch batch = 15;
+  if (_internal_has_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::batch(this),
+        _Internal::batch(this).GetCachedSize(), target, stream);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameMessage)
   return target;
@@ -4789,174 +5687,204 @@ size_t GameMessage::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.GameMessage)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // .sanguosha.MessageType type = 1;
-  if (this->type() != 0) {
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   switch (content_case()) {
     // .sanguosha.LoginRequest login_request = 2;
     case kLoginRequest: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.login_request_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.login_request_);
       break;
     }
     // .sanguosha.LoginResponse login_response = 3;
     case kLoginResponse: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.login_response_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.login_response_);
       break;
     }
     // .sanguosha.Heartbeat heartbeat = 4;
     case kHeartbeat: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.heartbeat_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.heartbeat_);
       break;
     }
     // .sanguosha.RoomRequest room_request = 5;
     case kRoomRequest: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.room_request_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.room_request_);
       break;
     }
     // .sanguosha.RoomResponse room_response = 6;
     case kRoomResponse: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.room_response_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.room_response_);
       break;
     }
     // .sanguosha.GameAction game_action = 7;
     case kGameAction: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.game_action_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_action_);
       break;
     }
     // .sanguosha.GameState game_state = 8;
     case kGameState: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.game_state_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_state_);
       break;
     }
     // .sanguosha.GameStart game_start = 9;
     case kGameStart: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.game_start_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_start_);
       break;
     }
     // .sanguosha.GameOver game_over = 10;
     case kGameOver: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.game_over_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_over_);
+      break;
+    }
+    // .sanguosha.GameStateDelta game_state_delta = 11;
+    case kGameStateDelta: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_state_delta_);
+      break;
+    }
+    // .sanguosha.GameStateRequest game_state_request = 12;
+    case kGameStateRequest: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.game_state_request_);
       break;
     }
     // .sanguosha.RoomListResponse room_list_response = 14;
     case kRoomListResponse: {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSize(
-          *content_.room_list_response_);
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.room_list_response_);
+      break;
+    }
+    // .sanguosha.MessageBatch batch = 15;
+    case kBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.content_.batch_);
       break;
     }
     case CONTENT_NOT_SET: {
       break;
     }
   }
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameMessage::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.GameMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameMessage* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GameMessage>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.GameMessage)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.GameMessage)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameMessage::GetClassData() const { return &_class_data_; }
+
 
-void GameMessage::MergeFrom(const GameMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+void GameMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameMessage*>(&to_msg);
+  auto& from = static_cast<const GameMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.type() != 0) {
-    set_type(from.type());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
   switch (from.content_case()) {
     case kLoginRequest: {
-      mutable_login_request()->::sanguosha::LoginRequest::MergeFrom(from.login_request());
+      _this->_internal_mutable_login_request()->::sanguosha::LoginRequest::MergeFrom(
+          from._internal_login_request());
       break;
     }
     case kLoginResponse: {
-      mutable_login_response()->::sanguosha::LoginResponse::MergeFrom(from.login_response());
+      _this->_internal_mutable_login_response()->::sanguosha::LoginResponse::MergeFrom(
+          from._internal_login_response());
       break;
     }
     case kHeartbeat: {
-      mutable_heartbeat()->::sanguosha::Heartbeat::MergeFrom(from.heartbeat());
+      _this->_internal_mutable_heartbeat()->::sanguosha::Heartbeat::MergeFrom(
+          from._internal_heartbeat());
       break;
     }
     case kRoomRequest: {
-      mutable_room_request()->::sanguosha::RoomRequest::MergeFrom(from.room_request());
+      _this->_internal_mutable_room_request()->::sanguosha::RoomRequest::MergeFrom(
+          from._internal_room_request());
       break;
     }
     case kRoomResponse: {
-      mutable_room_response()->::sanguosha::RoomResponse::MergeFrom(from.room_response());
+      _this->_internal_mutable_room_response()->::sanguosha::RoomResponse::MergeFrom(
+          from._internal_room_response());
       break;
     }
     case kGameAction: {
-      mutable_game_action()->::sanguosha::GameAction::MergeFrom(from.game_action());
+      _this->_internal_mutable_game_action()->::sanguosha::GameAction::MergeFrom(
+          from._internal_game_action());
       break;
     }
     case kGameState: {
-      mutable_game_state()->::sanguosha::GameState::MergeFrom(from.game_state());
+      _this->_internal_mutable_game_state()->::sanguosha::GameState::MergeFrom(
+          from._internal_game_state());
       break;
     }
     case kGameStart: {
-      mutable_game_start()->::sanguosha::GameStart::MergeFrom(from.game_start());
+      _this->_internal_mutable_game_start()->::sanguosha::GameStart::MergeFrom(
+          from._internal_game_start());
       break;
     }
     case kGameOver: {
-      mutable_game_over()->::sanguosha::GameOver::MergeFrom(from.game_over());
+      _this->_internal_mutable_game_over()->::sanguosha::GameOver::MergeFrom(
+          from._internal_game_over());
+      break;
+    }
+    case kGameStateDelta: {
+      _this->_internal_mutable_game_state_delta()->::sanguosha::GameStateDelta::MergeFrom(
+          from._internal_game_state_delta());
+      break;
+    }
+    case kGameStateRequest: {
+      _this->_internal_mutable_game_state_request()->::sanguosha::GameStateRequest::MergeFrom(
+          from._internal_game_state_request());
       break;
     }
     case kRoomListResponse: {
-      mutable_room_list_response()->::sanguosha::RoomListResponse::MergeFrom(from.room_list_response());
+      _this->_internal_mutable_room_list_response()->::sanguosha::RoomListResponse::MergeFrom(
+          from._internal_room_list_response());
+      break;
+    }
+    case kBatch: {
+      _this->_internal_mutable_batch()->::sanguosha::MessageBatch::MergeFrom(
+          from._internal_batch());
       break;
     }
     case CONTENT_NOT_SET: {
       break;
     }
   }
-}
-
-void GameMessage::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.GameMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameMessage::CopyFrom(const GameMessage& from) {
@@ -4970,160 +5898,133 @@ bool GameMessage::IsInitialized() const {
   return true;
 }
 
-void GameMessage::Swap(GameMessage* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GameMessage::InternalSwap(GameMessage* other) {
   using std::swap;
-  swap(type_, other->type_);
-  swap(content_, other->content_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.content_, other->_impl_.content_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
 
-::google::protobuf::Metadata GameMessage::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GameMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[15]);
 }
 
-
 // ===================================================================
 
-void GameOver::InitAsDefaultInstance() {
-}
-#if !defined(_MSC_VER) || _MSC_VER >= 1900
-const int GameOver::kWinnerIdFieldNumber;
-#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+class GameOver::_Internal {
+ public:
+};
 
-GameOver::GameOver()
-  : ::google::protobuf::Message(), _internal_metadata_(NULL) {
-  ::google::protobuf::internal::InitSCC(
-      &protobuf_sanguosha_2eproto::scc_info_GameOver.base);
-  SharedCtor();
-  // @@protoc_insertion_point(constructor:sanguosha.GameOver)
+GameOver::GameOver(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:sanguosha.GameOver)
 }
 GameOver::GameOver(const GameOver& from)
-  : ::google::protobuf::Message(),
-      _internal_metadata_(NULL) {
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  winner_id_ = from.winner_id_;
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GameOver* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.winner_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.winner_id_ = from._impl_.winner_id_;
   // @@protoc_insertion_point(copy_constructor:sanguosha.GameOver)
 }
 
-void GameOver::SharedCtor() {
-  winner_id_ = 0u;
+inline void GameOver::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.winner_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GameOver::~GameOver() {
   // @@protoc_insertion_point(destructor:sanguosha.GameOver)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GameOver::SharedDtor() {
+inline void GameOver::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void GameOver::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const ::google::protobuf::Descriptor* GameOver::descriptor() {
-  ::protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages].descriptor;
-}
-
-const GameOver& GameOver::default_instance() {
-  ::google::protobuf::internal::InitSCC(&protobuf_sanguosha_2eproto::scc_info_GameOver.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void GameOver::Clear() {
 // @@protoc_insertion_point(message_clear_start:sanguosha.GameOver)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  winner_id_ = 0u;
-  _internal_metadata_.Clear();
+  _impl_.winner_id_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool GameOver::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:sanguosha.GameOver)
-  for (;;) {
-    ::std::pair<::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* GameOver::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // uint32 winner_id = 1;
-      case 1: {
-        if (static_cast< ::google::protobuf::uint8>(tag) ==
-            static_cast< ::google::protobuf::uint8>(8u /* 8 & 0xFF */)) {
-
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &winner_id_)));
-        } else {
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.winner_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
           goto handle_unusual;
-        }
-        break;
-      }
-
-      default: {
-      handle_unusual:
-        if (tag == 0) {
-          goto success;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, _internal_metadata_.mutable_unknown_fields()));
-        break;
-      }
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-success:
-  // @@protoc_insertion_point(parse_success:sanguosha.GameOver)
-  return true;
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
 failure:
-  // @@protoc_insertion_point(parse_failure:sanguosha.GameOver)
-  return false;
-#undef DO_
-}
-
-void GameOver::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:sanguosha.GameOver)
-  ::google::protobuf::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // uint32 winner_id = 1;
-  if (this->winner_id() != 0) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->winner_id(), output);
-  }
-
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), output);
-  }
-  // @@protoc_insertion_point(serialize_end:sanguosha.GameOver)
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-::google::protobuf::uint8* GameOver::InternalSerializeWithCachedSizesToArray(
-    bool deterministic, ::google::protobuf::uint8* target) const {
-  (void)deterministic; // Unused
+uint8_t* GameOver::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:sanguosha.GameOver)
-  ::google::protobuf::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // uint32 winner_id = 1;
-  if (this->winner_id() != 0) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->winner_id(), target);
+  if (this->_internal_winner_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_winner_id(), target);
   }
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
   // @@protoc_insertion_point(serialize_to_array_end:sanguosha.GameOver)
   return target;
@@ -5133,55 +6034,37 @@ size_t GameOver::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:sanguosha.GameOver)
   size_t total_size = 0;
 
-  if ((_internal_metadata_.have_unknown_fields() &&  ::google::protobuf::internal::GetProto3PreserveUnknownsDefault())) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        (::google::protobuf::internal::GetProto3PreserveUnknownsDefault()   ? _internal_metadata_.unknown_fields()   : _internal_metadata_.default_instance()));
-  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // uint32 winner_id = 1;
-  if (this->winner_id() != 0) {
-    total_size += 1 +
-      ::google::protobuf::internal::WireFormatLite::UInt32Size(
-        this->winner_id());
+  if (this->_internal_winner_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_winner_id());
   }
 
-  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GameOver::MergeFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:sanguosha.GameOver)
-  GOOGLE_DCHECK_NE(&from, this);
-  const GameOver* source =
-      ::google::protobuf::internal::DynamicCastToGenerated<const GameOver>(
-          &from);
-  if (source == NULL) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:sanguosha.GameOver)
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:sanguosha.GameOver)
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GameOver::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GameOver::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GameOver::GetClassData() const { return &_class_data_; }
 
-void GameOver::MergeFrom(const GameOver& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameOver)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom(from._internal_metadata_);
-  ::google::protobuf::uint32 cached_has_bits = 0;
+
+void GameOver::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GameOver*>(&to_msg);
+  auto& from = static_cast<const GameOver&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:sanguosha.GameOver)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.winner_id() != 0) {
-    set_winner_id(from.winner_id());
+  if (from._internal_winner_id() != 0) {
+    _this->_internal_set_winner_id(from._internal_winner_id());
   }
-}
-
-void GameOver::CopyFrom(const ::google::protobuf::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:sanguosha.GameOver)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GameOver::CopyFrom(const GameOver& from) {
@@ -5195,66 +6078,90 @@ bool GameOver::IsInitialized() const {
   return true;
 }
 
-void GameOver::Swap(GameOver* other) {
-  if (other == this) return;
-  InternalSwap(other);
-}
 void GameOver::InternalSwap(GameOver* other) {
   using std::swap;
-  swap(winner_id_, other->winner_id_);
-  _internal_metadata_.Swap(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.winner_id_, other->_impl_.winner_id_);
 }
 
-::google::protobuf::Metadata GameOver::GetMetadata() const {
-  protobuf_sanguosha_2eproto::protobuf_AssignDescriptorsOnce();
-  return ::protobuf_sanguosha_2eproto::file_level_metadata[kIndexInFileMessages];
+::PROTOBUF_NAMESPACE_ID::Metadata GameOver::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_sanguosha_2eproto_getter, &descriptor_table_sanguosha_2eproto_once,
+      file_level_metadata_sanguosha_2eproto[16]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace sanguosha
-namespace google {
-namespace protobuf {
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::LoginRequest* Arena::CreateMaybeMessage< ::sanguosha::LoginRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::LoginRequest >(arena);
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::sanguosha::LoginRequest*
+Arena::CreateMaybeMessage< ::sanguosha::LoginRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::LoginRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sanguosha::LoginResponse*
+Arena::CreateMaybeMessage< ::sanguosha::LoginResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::LoginResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sanguosha::Heartbeat*
+Arena::CreateMaybeMessage< ::sanguosha::Heartbeat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::Heartbeat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sanguosha::RoomInfo*
+Arena::CreateMaybeMessage< ::sanguosha::RoomInfo >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::RoomInfo >(arena);
+}
+template<> PROTOBUF_NOINLINE ::sanguosha::RoomRequest*
+Arena::CreateMaybeMessage< ::sanguosha::RoomRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::RoomRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::LoginResponse* Arena::CreateMaybeMessage< ::sanguosha::LoginResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::LoginResponse >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::RoomResponse*
+Arena::CreateMaybeMessage< ::sanguosha::RoomResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::RoomResponse >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::Heartbeat* Arena::CreateMaybeMessage< ::sanguosha::Heartbeat >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::Heartbeat >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::RoomListResponse*
+Arena::CreateMaybeMessage< ::sanguosha::RoomListResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::RoomListResponse >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::RoomInfo* Arena::CreateMaybeMessage< ::sanguosha::RoomInfo >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::RoomInfo >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameAction*
+Arena::CreateMaybeMessage< ::sanguosha::GameAction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameAction >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::RoomRequest* Arena::CreateMaybeMessage< ::sanguosha::RoomRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::RoomRequest >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::PlayerState*
+Arena::CreateMaybeMessage< ::sanguosha::PlayerState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::PlayerState >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::RoomResponse* Arena::CreateMaybeMessage< ::sanguosha::RoomResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::RoomResponse >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameState*
+Arena::CreateMaybeMessage< ::sanguosha::GameState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameState >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::RoomListResponse* Arena::CreateMaybeMessage< ::sanguosha::RoomListResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::RoomListResponse >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::PlayerStateDelta*
+Arena::CreateMaybeMessage< ::sanguosha::PlayerStateDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::PlayerStateDelta >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::GameAction* Arena::CreateMaybeMessage< ::sanguosha::GameAction >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::GameAction >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameStateDelta*
+Arena::CreateMaybeMessage< ::sanguosha::GameStateDelta >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameStateDelta >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::PlayerState* Arena::CreateMaybeMessage< ::sanguosha::PlayerState >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::PlayerState >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameStateRequest*
+Arena::CreateMaybeMessage< ::sanguosha::GameStateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameStateRequest >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::GameState* Arena::CreateMaybeMessage< ::sanguosha::GameState >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::GameState >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameStart*
+Arena::CreateMaybeMessage< ::sanguosha::GameStart >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameStart >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::GameStart* Arena::CreateMaybeMessage< ::sanguosha::GameStart >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::GameStart >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::MessageBatch*
+Arena::CreateMaybeMessage< ::sanguosha::MessageBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::MessageBatch >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::GameMessage* Arena::CreateMaybeMessage< ::sanguosha::GameMessage >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::GameMessage >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameMessage*
+Arena::CreateMaybeMessage< ::sanguosha::GameMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameMessage >(arena);
 }
-template<> GOOGLE_PROTOBUF_ATTRIBUTE_NOINLINE ::sanguosha::GameOver* Arena::CreateMaybeMessage< ::sanguosha::GameOver >(Arena* arena) {
-  return Arena::CreateInternal< ::sanguosha::GameOver >(arena);
+template<> PROTOBUF_NOINLINE ::sanguosha::GameOver*
+Arena::CreateMaybeMessage< ::sanguosha::GameOver >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::sanguosha::GameOver >(arena);
 }
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,112 +1,125 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: sanguosha.proto
 
-#ifndef PROTOBUF_INCLUDED_sanguosha_2eproto
-#define PROTOBUF_INCLUDED_sanguosha_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_sanguosha_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_sanguosha_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_sanguosha_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_sanguosha_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sanguosha_2eproto;
 namespace sanguosha {
 class GameAction;
-class GameActionDefaultTypeInternal;
+struct GameActionDefaultTypeInternal;
 extern GameActionDefaultTypeInternal _GameAction_default_instance_;
 class GameMessage;
-class GameMessageDefaultTypeInternal;
+struct GameMessageDefaultTypeInternal;
 extern GameMessageDefaultTypeInternal _GameMessage_default_instance_;
 class GameOver;
-class GameOverDefaultTypeInternal;
+struct GameOverDefaultTypeInternal;
 extern GameOverDefaultTypeInternal _GameOver_default_instance_;
 class GameStart;
-class GameStartDefaultTypeInternal;
+struct GameStartDefaultTypeInternal;
 extern GameStartDefaultTypeInternal _GameStart_default_instance_;
 class GameState;
-class GameStateDefaultTypeInternal;
+struct GameStateDefaultTypeInternal;
 extern GameStateDefaultTypeInternal _GameState_default_instance_;
+class GameStateDelta;
+struct GameStateDeltaDefaultTypeInternal;
+extern GameStateDeltaDefaultTypeInternal _GameStateDelta_default_instance_;
+class GameStateRequest;
+struct GameStateRequestDefaultTypeInternal;
+extern GameStateRequestDefaultTypeInternal _GameStateRequest_default_instance_;
 class Heartbeat;
-class HeartbeatDefaultTypeInternal;
+struct HeartbeatDefaultTypeInternal;
 extern HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
 class LoginRequest;
-class LoginRequestDefaultTypeInternal;
+struct LoginRequestDefaultTypeInternal;
 extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
 class LoginResponse;
-class LoginResponseDefaultTypeInternal;
+struct LoginResponseDefaultTypeInternal;
 extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
+class MessageBatch;
+struct MessageBatchDefaultTypeInternal;
+extern MessageBatchDefaultTypeInternal _MessageBatch_default_instance_;
 class PlayerState;
-class PlayerStateDefaultTypeInternal;
+struct PlayerStateDefaultTypeInternal;
 extern PlayerStateDefaultTypeInternal _PlayerState_default_instance_;
+class PlayerStateDelta;
+struct PlayerStateDeltaDefaultTypeInternal;
+extern PlayerStateDeltaDefaultTypeInternal _PlayerStateDelta_default_instance_;
 class RoomInfo;
-class RoomInfoDefaultTypeInternal;
+struct RoomInfoDefaultTypeInternal;
 extern RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
 class RoomListResponse;
-class RoomListResponseDefaultTypeInternal;
+struct RoomListResponseDefaultTypeInternal;
 extern RoomListResponseDefaultTypeInternal _RoomListResponse_default_instance_;
 class RoomRequest;
-class RoomRequestDefaultTypeInternal;
+struct RoomRequestDefaultTypeInternal;
 extern RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
 class RoomResponse;
-class RoomResponseDefaultTypeInternal;
+struct RoomResponseDefaultTypeInternal;
 extern RoomResponseDefaultTypeInternal _RoomResponse_default_instance_;
 }  // namespace sanguosha
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 template<> ::sanguosha::GameAction* Arena::CreateMaybeMessage<::sanguosha::GameAction>(Arena*);
 template<> ::sanguosha::GameMessage* Arena::CreateMaybeMessage<::sanguosha::GameMessage>(Arena*);
 template<> ::sanguosha::GameOver* Arena::CreateMaybeMessage<::sanguosha::GameOver>(Arena*);
 template<> ::sanguosha::GameStart* Arena::CreateMaybeMessage<::sanguosha::GameStart>(Arena*);
 template<> ::sanguosha::GameState* Arena::CreateMaybeMessage<::sanguosha::GameState>(Arena*);
+template<> ::sanguosha::GameStateDelta* Arena::CreateMaybeMessage<::sanguosha::GameStateDelta>(Arena*);
+template<> ::sanguosha::GameStateRequest* Arena::CreateMaybeMessage<::sanguosha::GameStateRequest>(Arena*);
 template<> ::sanguosha::Heartbeat* Arena::CreateMaybeMessage<::sanguosha::Heartbeat>(Arena*);
 template<> ::sanguosha::LoginRequest* Arena::CreateMaybeMessage<::sanguosha::LoginRequest>(Arena*);
 template<> ::sanguosha::LoginResponse* Arena::CreateMaybeMessage<::sanguosha::LoginResponse>(Arena*);
+template<> ::sanguosha::MessageBatch* Arena::CreateMaybeMessage<::sanguosha::MessageBatch>(Arena*);
 template<> ::sanguosha::PlayerState* Arena::CreateMaybeMessage<::sanguosha::PlayerState>(Arena*);
+template<> ::sanguosha::PlayerStateDelta* Arena::CreateMaybeMessage<::sanguosha::PlayerStateDelta>(Arena*);
 template<> ::sanguosha::RoomInfo* Arena::CreateMaybeMessage<::sanguosha::RoomInfo>(Arena*);
 template<> ::sanguosha::RoomListResponse* Arena::CreateMaybeMessage<::sanguosha::RoomListResponse>(Arena*);
 template<> ::sanguosha::RoomRequest* Arena::CreateMaybeMessage<::sanguosha::RoomRequest>(Arena*);
 template<> ::sanguosha::RoomResponse* Arena::CreateMaybeMessage<::sanguosha::RoomResponse>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 namespace sanguosha {
 
-enum MessageType {
+enum MessageType : int {
   UNKNOWN = 0,
   LOGIN_REQUEST = 1,
   LOGIN_RESPONSE = 2,
@@ -120,167 +133,233 @@ enum MessageType {
   GAME_STATE_REQUEST = 10,
   ROOM_LIST_REQUEST = 11,
   ROOM_LIST_RESPONSE = 12,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  GAME_STATE_DELTA = 13,
+  MESSAGE_BATCH = 14,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = UNKNOWN;
-const MessageType MessageType_MAX = ROOM_LIST_RESPONSE;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = UNKNOWN;
+constexpr MessageType MessageType_MAX = MESSAGE_BATCH;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
-enum RoomAction {
+enum Capability : int {
+  CAPABILITY_NONE = 0,
+  CAPABILITY_FRAME_COMPRESSION = 1,
+  CAPABILITY_MESSAGE_BATCH = 2,
+  CAPABILITY_ACTION_SEQUENCE = 4,
+  Capability_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Capability_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Capability_IsValid(int value);
+constexpr Capability Capability_MIN = CAPABILITY_NONE;
+constexpr Capability Capability_MAX = CAPABILITY_ACTION_SEQUENCE;
+constexpr int Capability_ARRAYSIZE = Capability_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Capability_descriptor();
+template<typename T>
+inline const std::string& Capability_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Capability>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Capability_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Capability_descriptor(), enum_t_value);
+}
+inline bool Capability_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Capability* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Capability>(
+    Capability_descriptor(), name, value);
+}
+enum RoomAction : int {
   CREATE_ROOM = 0,
   JOIN_ROOM = 1,
   LEAVE_ROOM = 2,
   START_GAME = 3,
-  RoomAction_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  RoomAction_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RoomAction_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RoomAction_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RoomAction_IsValid(int value);
-const RoomAction RoomAction_MIN = CREATE_ROOM;
-const RoomAction RoomAction_MAX = START_GAME;
-const int RoomAction_ARRAYSIZE = RoomAction_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* RoomAction_descriptor();
-inline const ::std::string& RoomAction_Name(RoomAction value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    RoomAction_descriptor(), value);
+constexpr RoomAction RoomAction_MIN = CREATE_ROOM;
+constexpr RoomAction RoomAction_MAX = START_GAME;
+constexpr int RoomAction_ARRAYSIZE = RoomAction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomAction_descriptor();
+template<typename T>
+inline const std::string& RoomAction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RoomAction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RoomAction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RoomAction_descriptor(), enum_t_value);
 }
 inline bool RoomAction_Parse(
-    const ::std::string& name, RoomAction* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<RoomAction>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RoomAction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RoomAction>(
     RoomAction_descriptor(), name, value);
 }
-enum RoomStatus {
+enum RoomStatus : int {
   WAITING = 0,
   PLAYING = 1,
-  RoomStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  RoomStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RoomStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RoomStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RoomStatus_IsValid(int value);
-const RoomStatus RoomStatus_MIN = WAITING;
-const RoomStatus RoomStatus_MAX = PLAYING;
-const int RoomStatus_ARRAYSIZE = RoomStatus_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* RoomStatus_descriptor();
-inline const ::std::string& RoomStatus_Name(RoomStatus value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    RoomStatus_descriptor(), value);
+constexpr RoomStatus RoomStatus_MIN = WAITING;
+constexpr RoomStatus RoomStatus_MAX = PLAYING;
+constexpr int RoomStatus_ARRAYSIZE = RoomStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomStatus_descriptor();
+template<typename T>
+inline const std::string& RoomStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RoomStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RoomStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RoomStatus_descriptor(), enum_t_value);
 }
 inline bool RoomStatus_Parse(
-    const ::std::string& name, RoomStatus* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<RoomStatus>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RoomStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RoomStatus>(
     RoomStatus_descriptor(), name, value);
 }
-enum CardType {
+enum CardType : int {
   CARD_UNKNOWN = 0,
   CARD_ATTACK = 1,
   CARD_DEFEND = 2,
   CARD_HEAL = 3,
-  CardType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  CardType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  CardType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CardType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool CardType_IsValid(int value);
-const CardType CardType_MIN = CARD_UNKNOWN;
-const CardType CardType_MAX = CARD_HEAL;
-const int CardType_ARRAYSIZE = CardType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* CardType_descriptor();
-inline const ::std::string& CardType_Name(CardType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    CardType_descriptor(), value);
+constexpr CardType CardType_MIN = CARD_UNKNOWN;
+constexpr CardType CardType_MAX = CARD_HEAL;
+constexpr int CardType_ARRAYSIZE = CardType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CardType_descriptor();
+template<typename T>
+inline const std::string& CardType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CardType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CardType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CardType_descriptor(), enum_t_value);
 }
 inline bool CardType_Parse(
-    const ::std::string& name, CardType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<CardType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CardType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CardType>(
     CardType_descriptor(), name, value);
 }
-enum GamePhase {
+enum GamePhase : int {
   PHASE_UNKNOWN = 0,
   DRAW_PHASE = 1,
   PLAY_PHASE = 2,
   DISCARD_PHASE = 3,
-  GamePhase_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  GamePhase_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  GamePhase_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  GamePhase_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool GamePhase_IsValid(int value);
-const GamePhase GamePhase_MIN = PHASE_UNKNOWN;
-const GamePhase GamePhase_MAX = DISCARD_PHASE;
-const int GamePhase_ARRAYSIZE = GamePhase_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* GamePhase_descriptor();
-inline const ::std::string& GamePhase_Name(GamePhase value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    GamePhase_descriptor(), value);
+constexpr GamePhase GamePhase_MIN = PHASE_UNKNOWN;
+constexpr GamePhase GamePhase_MAX = DISCARD_PHASE;
+constexpr int GamePhase_ARRAYSIZE = GamePhase_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GamePhase_descriptor();
+template<typename T>
+inline const std::string& GamePhase_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GamePhase>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GamePhase_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GamePhase_descriptor(), enum_t_value);
 }
 inline bool GamePhase_Parse(
-    const ::std::string& name, GamePhase* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<GamePhase>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GamePhase* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GamePhase>(
     GamePhase_descriptor(), name, value);
 }
-enum ActionType {
+enum ActionType : int {
   ACTION_PLAY_CARD = 0,
   ACTION_END_TURN = 1,
-  ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ActionType_IsValid(int value);
-const ActionType ActionType_MIN = ACTION_PLAY_CARD;
-const ActionType ActionType_MAX = ACTION_END_TURN;
-const int ActionType_ARRAYSIZE = ActionType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ActionType_descriptor();
-inline const ::std::string& ActionType_Name(ActionType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ActionType_descriptor(), value);
+constexpr ActionType ActionType_MIN = ACTION_PLAY_CARD;
+constexpr ActionType ActionType_MAX = ACTION_END_TURN;
+constexpr int ActionType_ARRAYSIZE = ActionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionType_descriptor();
+template<typename T>
+inline const std::string& ActionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ActionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ActionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ActionType_descriptor(), enum_t_value);
 }
 inline bool ActionType_Parse(
-    const ::std::string& name, ActionType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ActionType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ActionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ActionType>(
     ActionType_descriptor(), name, value);
 }
 // ===================================================================
 
-class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginRequest) */ {
+class LoginRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginRequest) */ {
  public:
-  LoginRequest();
-  virtual ~LoginRequest();
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() override;
+  explicit PROTOBUF_CONSTEXPR LoginRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginRequest(const LoginRequest& from);
-
-  inline LoginRequest& operator=(const LoginRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginRequest(LoginRequest&& from) noexcept
     : LoginRequest() {
     *this = ::std::move(from);
   }
 
+  inline LoginRequest& operator=(const LoginRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginRequest& operator=(LoginRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginRequest* internal_default_instance() {
     return reinterpret_cast<const LoginRequest*>(
                &_LoginRequest_default_instance_);
@@ -288,125 +367,195 @@ class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(LoginRequest* other);
   friend void swap(LoginRequest& a, LoginRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRequest* New() const final {
-    return CreateMaybeMessage<LoginRequest>(NULL);
-  }
-
-  LoginRequest* New(::google::protobuf::Arena* arena) const final {
+  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRequest& from);
-  void MergeFrom(const LoginRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.LoginRequest";
   }
+  protected:
+  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kPasswordFieldNumber = 2,
+    kResumeTokenFieldNumber = 4,
+    kCapabilitiesFieldNumber = 3,
+  };
   // string username = 1;
   void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // string password = 2;
   void clear_password();
-  static const int kPasswordFieldNumber = 2;
-  const ::std::string& password() const;
-  void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
-  void set_password(const char* value);
-  void set_password(const char* value, size_t size);
-  ::std::string* mutable_password();
-  ::std::string* release_password();
-  void set_allocated_password(::std::string* password);
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
+  private:
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
+  public:
+
+  // string resume_token = 4;
+  void clear_resume_token();
+  const std::string& resume_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_token();
+  PROTOBUF_NODISCARD std::string* release_resume_token();
+  void set_allocated_resume_token(std::string* resume_token);
+  private:
+  const std::string& _internal_resume_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_token(const std::string& value);
+  std::string* _internal_mutable_resume_token();
+  public:
+
+  // uint32 capabilities = 3;
+  void clear_capabilities();
+  uint32_t capabilities() const;
+  void set_capabilities(uint32_t value);
+  private:
+  uint32_t _internal_capabilities() const;
+  void _internal_set_capabilities(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.LoginRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr password_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_token_;
+    uint32_t capabilities_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginResponse) */ {
+class LoginResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginResponse) */ {
  public:
-  LoginResponse();
-  virtual ~LoginResponse();
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() override;
+  explicit PROTOBUF_CONSTEXPR LoginResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginResponse(const LoginResponse& from);
-
-  inline LoginResponse& operator=(const LoginResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginResponse(LoginResponse&& from) noexcept
     : LoginResponse() {
     *this = ::std::move(from);
   }
 
+  inline LoginResponse& operator=(const LoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginResponse& operator=(LoginResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginResponse* internal_default_instance() {
     return reinterpret_cast<const LoginResponse*>(
                &_LoginResponse_default_instance_);
@@ -414,124 +563,212 @@ class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_p
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(LoginResponse* other);
   friend void swap(LoginResponse& a, LoginResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginResponse* New() const final {
-    return CreateMaybeMessage<LoginResponse>(NULL);
-  }
-
-  LoginResponse* New(::google::protobuf::Arena* arena) const final {
+  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginResponse& from);
-  void MergeFrom(const LoginResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.LoginResponse";
   }
+  protected:
+  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 2,
+    kResumeTokenFieldNumber = 5,
+    kUserIdFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+    kResumedFieldNumber = 6,
+    kCapabilitiesFieldNumber = 4,
+  };
   // string error_message = 2;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 2;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // string resume_token = 5;
+  void clear_resume_token();
+  const std::string& resume_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_token();
+  PROTOBUF_NODISCARD std::string* release_resume_token();
+  void set_allocated_resume_token(std::string* resume_token);
+  private:
+  const std::string& _internal_resume_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_token(const std::string& value);
+  std::string* _internal_mutable_resume_token();
+  public:
+
+  // uint32 user_id = 3;
+  void clear_user_id();
+  uint32_t user_id() const;
+  void set_user_id(uint32_t value);
+  private:
+  uint32_t _internal_user_id() const;
+  void _internal_set_user_id(uint32_t value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // uint32 user_id = 3;
-  void clear_user_id();
-  static const int kUserIdFieldNumber = 3;
-  ::google::protobuf::uint32 user_id() const;
-  void set_user_id(::google::protobuf::uint32 value);
+  // bool resumed = 6;
+  void clear_resumed();
+  bool resumed() const;
+  void set_resumed(bool value);
+  private:
+  bool _internal_resumed() const;
+  void _internal_set_resumed(bool value);
+  public:
+
+  // uint32 capabilities = 4;
+  void clear_capabilities();
+  uint32_t capabilities() const;
+  void set_capabilities(uint32_t value);
+  private:
+  uint32_t _internal_capabilities() const;
+  void _internal_set_capabilities(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.LoginResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  bool success_;
-  ::google::protobuf::uint32 user_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_token_;
+    uint32_t user_id_;
+    bool success_;
+    bool resumed_;
+    uint32_t capabilities_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.Heartbeat) */ {
+class Heartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.Heartbeat) */ {
  public:
-  Heartbeat();
-  virtual ~Heartbeat();
+  inline Heartbeat() : Heartbeat(nullptr) {}
+  ~Heartbeat() override;
+  explicit PROTOBUF_CONSTEXPR Heartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Heartbeat(const Heartbeat& from);
-
-  inline Heartbeat& operator=(const Heartbeat& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Heartbeat(Heartbeat&& from) noexcept
     : Heartbeat() {
     *this = ::std::move(from);
   }
 
+  inline Heartbeat& operator=(const Heartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Heartbeat& operator=(Heartbeat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Heartbeat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Heartbeat& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Heartbeat* internal_default_instance() {
     return reinterpret_cast<const Heartbeat*>(
                &_Heartbeat_default_instance_);
@@ -539,102 +776,147 @@ class Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(Heartbeat* other);
   friend void swap(Heartbeat& a, Heartbeat& b) {
     a.Swap(&b);
   }
+  inline void Swap(Heartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Heartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Heartbeat* New() const final {
-    return CreateMaybeMessage<Heartbeat>(NULL);
-  }
-
-  Heartbeat* New(::google::protobuf::Arena* arena) const final {
+  Heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Heartbeat>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Heartbeat& from);
-  void MergeFrom(const Heartbeat& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Heartbeat& from) {
+    Heartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Heartbeat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.Heartbeat";
   }
+  protected:
+  explicit Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTimestampFieldNumber = 1,
+  };
   // uint64 timestamp = 1;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 1;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.Heartbeat)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint64 timestamp_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomInfo) */ {
+class RoomInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomInfo) */ {
  public:
-  RoomInfo();
-  virtual ~RoomInfo();
+  inline RoomInfo() : RoomInfo(nullptr) {}
+  ~RoomInfo() override;
+  explicit PROTOBUF_CONSTEXPR RoomInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomInfo(const RoomInfo& from);
-
-  inline RoomInfo& operator=(const RoomInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomInfo(RoomInfo&& from) noexcept
     : RoomInfo() {
     *this = ::std::move(from);
   }
 
+  inline RoomInfo& operator=(const RoomInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomInfo& operator=(RoomInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomInfo& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomInfo& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomInfo* internal_default_instance() {
     return reinterpret_cast<const RoomInfo*>(
                &_RoomInfo_default_instance_);
@@ -642,137 +924,205 @@ class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(RoomInfo* other);
   friend void swap(RoomInfo& a, RoomInfo& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomInfo* New() const final {
-    return CreateMaybeMessage<RoomInfo>(NULL);
-  }
-
-  RoomInfo* New(::google::protobuf::Arena* arena) const final {
+  RoomInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomInfo>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomInfo& from);
-  void MergeFrom(const RoomInfo& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomInfo& from) {
+    RoomInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomInfo";
   }
+  protected:
+  explicit RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPlayersFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+    kCurrentPlayersFieldNumber = 3,
+    kMaxPlayersFieldNumber = 4,
+    kStatusFieldNumber = 5,
+  };
   // repeated uint32 players = 2;
   int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
   void clear_players();
-  static const int kPlayersFieldNumber = 2;
-  ::google::protobuf::uint32 players(int index) const;
-  void set_players(int index, ::google::protobuf::uint32 value);
-  void add_players(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_players(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_players() const;
+  void _internal_add_players(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_players();
+  public:
+  uint32_t players(int index) const;
+  void set_players(int index, uint32_t value);
+  void add_players(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       players() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_players();
 
   // uint32 room_id = 1;
   void clear_room_id();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
 
   // uint32 current_players = 3;
   void clear_current_players();
-  static const int kCurrentPlayersFieldNumber = 3;
-  ::google::protobuf::uint32 current_players() const;
-  void set_current_players(::google::protobuf::uint32 value);
+  uint32_t current_players() const;
+  void set_current_players(uint32_t value);
+  private:
+  uint32_t _internal_current_players() const;
+  void _internal_set_current_players(uint32_t value);
+  public:
 
   // uint32 max_players = 4;
   void clear_max_players();
-  static const int kMaxPlayersFieldNumber = 4;
-  ::google::protobuf::uint32 max_players() const;
-  void set_max_players(::google::protobuf::uint32 value);
+  uint32_t max_players() const;
+  void set_max_players(uint32_t value);
+  private:
+  uint32_t _internal_max_players() const;
+  void _internal_set_max_players(uint32_t value);
+  public:
 
   // .sanguosha.RoomStatus status = 5;
   void clear_status();
-  static const int kStatusFieldNumber = 5;
   ::sanguosha::RoomStatus status() const;
   void set_status(::sanguosha::RoomStatus value);
+  private:
+  ::sanguosha::RoomStatus _internal_status() const;
+  void _internal_set_status(::sanguosha::RoomStatus value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomInfo)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > players_;
-  mutable int _players_cached_byte_size_;
-  ::google::protobuf::uint32 room_id_;
-  ::google::protobuf::uint32 current_players_;
-  ::google::protobuf::uint32 max_players_;
-  int status_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > players_;
+    mutable std::atomic<int> _players_cached_byte_size_;
+    uint32_t room_id_;
+    uint32_t current_players_;
+    uint32_t max_players_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomRequest) */ {
+class RoomRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomRequest) */ {
  public:
-  RoomRequest();
-  virtual ~RoomRequest();
+  inline RoomRequest() : RoomRequest(nullptr) {}
+  ~RoomRequest() override;
+  explicit PROTOBUF_CONSTEXPR RoomRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomRequest(const RoomRequest& from);
-
-  inline RoomRequest& operator=(const RoomRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomRequest(RoomRequest&& from) noexcept
     : RoomRequest() {
     *this = ::std::move(from);
   }
 
+  inline RoomRequest& operator=(const RoomRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomRequest& operator=(RoomRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomRequest* internal_default_instance() {
     return reinterpret_cast<const RoomRequest*>(
                &_RoomRequest_default_instance_);
@@ -780,109 +1130,158 @@ class RoomRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(RoomRequest* other);
   friend void swap(RoomRequest& a, RoomRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomRequest* New() const final {
-    return CreateMaybeMessage<RoomRequest>(NULL);
-  }
-
-  RoomRequest* New(::google::protobuf::Arena* arena) const final {
+  RoomRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomRequest& from);
-  void MergeFrom(const RoomRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomRequest& from) {
+    RoomRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomRequest";
   }
+  protected:
+  explicit RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kActionFieldNumber = 1,
+    kRoomIdFieldNumber = 2,
+  };
   // .sanguosha.RoomAction action = 1;
   void clear_action();
-  static const int kActionFieldNumber = 1;
   ::sanguosha::RoomAction action() const;
   void set_action(::sanguosha::RoomAction value);
+  private:
+  ::sanguosha::RoomAction _internal_action() const;
+  void _internal_set_action(::sanguosha::RoomAction value);
+  public:
 
   // uint32 room_id = 2;
   void clear_room_id();
-  static const int kRoomIdFieldNumber = 2;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int action_;
-  ::google::protobuf::uint32 room_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int action_;
+    uint32_t room_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomResponse) */ {
+class RoomResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomResponse) */ {
  public:
-  RoomResponse();
-  virtual ~RoomResponse();
+  inline RoomResponse() : RoomResponse(nullptr) {}
+  ~RoomResponse() override;
+  explicit PROTOBUF_CONSTEXPR RoomResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomResponse(const RoomResponse& from);
-
-  inline RoomResponse& operator=(const RoomResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomResponse(RoomResponse&& from) noexcept
     : RoomResponse() {
     *this = ::std::move(from);
   }
 
+  inline RoomResponse& operator=(const RoomResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomResponse& operator=(RoomResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomResponse* internal_default_instance() {
     return reinterpret_cast<const RoomResponse*>(
                &_RoomResponse_default_instance_);
@@ -890,130 +1289,183 @@ class RoomResponse : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(RoomResponse* other);
   friend void swap(RoomResponse& a, RoomResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomResponse* New() const final {
-    return CreateMaybeMessage<RoomResponse>(NULL);
-  }
-
-  RoomResponse* New(::google::protobuf::Arena* arena) const final {
+  RoomResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomResponse& from);
-  void MergeFrom(const RoomResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomResponse& from) {
+    RoomResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomResponse";
   }
+  protected:
+  explicit RoomResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 2,
+    kRoomInfoFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 2;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 2;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // .sanguosha.RoomInfo room_info = 3;
   bool has_room_info() const;
-  void clear_room_info();
-  static const int kRoomInfoFieldNumber = 3;
   private:
-  const ::sanguosha::RoomInfo& _internal_room_info() const;
+  bool _internal_has_room_info() const;
   public:
+  void clear_room_info();
   const ::sanguosha::RoomInfo& room_info() const;
-  ::sanguosha::RoomInfo* release_room_info();
+  PROTOBUF_NODISCARD ::sanguosha::RoomInfo* release_room_info();
   ::sanguosha::RoomInfo* mutable_room_info();
   void set_allocated_room_info(::sanguosha::RoomInfo* room_info);
+  private:
+  const ::sanguosha::RoomInfo& _internal_room_info() const;
+  ::sanguosha::RoomInfo* _internal_mutable_room_info();
+  public:
+  void unsafe_arena_set_allocated_room_info(
+      ::sanguosha::RoomInfo* room_info);
+  ::sanguosha::RoomInfo* unsafe_arena_release_room_info();
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  ::sanguosha::RoomInfo* room_info_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::sanguosha::RoomInfo* room_info_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomListResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomListResponse) */ {
+class RoomListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomListResponse) */ {
  public:
-  RoomListResponse();
-  virtual ~RoomListResponse();
+  inline RoomListResponse() : RoomListResponse(nullptr) {}
+  ~RoomListResponse() override;
+  explicit PROTOBUF_CONSTEXPR RoomListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomListResponse(const RoomListResponse& from);
-
-  inline RoomListResponse& operator=(const RoomListResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomListResponse(RoomListResponse&& from) noexcept
     : RoomListResponse() {
     *this = ::std::move(from);
   }
 
+  inline RoomListResponse& operator=(const RoomListResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomListResponse& operator=(RoomListResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomListResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomListResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomListResponse* internal_default_instance() {
     return reinterpret_cast<const RoomListResponse*>(
                &_RoomListResponse_default_instance_);
@@ -1021,108 +1473,156 @@ class RoomListResponse : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(RoomListResponse* other);
   friend void swap(RoomListResponse& a, RoomListResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomListResponse* New() const final {
-    return CreateMaybeMessage<RoomListResponse>(NULL);
-  }
-
-  RoomListResponse* New(::google::protobuf::Arena* arena) const final {
+  RoomListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomListResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomListResponse& from);
-  void MergeFrom(const RoomListResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomListResponse& from) {
+    RoomListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomListResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomListResponse";
   }
+  protected:
+  explicit RoomListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
   // repeated .sanguosha.RoomInfo rooms = 1;
   int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
   void clear_rooms();
-  static const int kRoomsFieldNumber = 1;
   ::sanguosha::RoomInfo* mutable_rooms(int index);
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >*
       mutable_rooms();
+  private:
+  const ::sanguosha::RoomInfo& _internal_rooms(int index) const;
+  ::sanguosha::RoomInfo* _internal_add_rooms();
+  public:
   const ::sanguosha::RoomInfo& rooms(int index) const;
   ::sanguosha::RoomInfo* add_rooms();
-  const ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >&
       rooms() const;
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomListResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo > rooms_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo > rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameAction : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameAction) */ {
+class GameAction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameAction) */ {
  public:
-  GameAction();
-  virtual ~GameAction();
+  inline GameAction() : GameAction(nullptr) {}
+  ~GameAction() override;
+  explicit PROTOBUF_CONSTEXPR GameAction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameAction(const GameAction& from);
-
-  inline GameAction& operator=(const GameAction& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameAction(GameAction&& from) noexcept
     : GameAction() {
     *this = ::std::move(from);
   }
 
+  inline GameAction& operator=(const GameAction& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameAction& operator=(GameAction&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameAction& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameAction& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameAction* internal_default_instance() {
     return reinterpret_cast<const GameAction*>(
                &_GameAction_default_instance_);
@@ -1130,116 +1630,180 @@ class GameAction : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(GameAction* other);
   friend void swap(GameAction& a, GameAction& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameAction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameAction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameAction* New() const final {
-    return CreateMaybeMessage<GameAction>(NULL);
-  }
-
-  GameAction* New(::google::protobuf::Arena* arena) const final {
+  GameAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameAction>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameAction& from);
-  void MergeFrom(const GameAction& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameAction& from) {
+    GameAction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameAction* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameAction";
   }
+  protected:
+  explicit GameAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTypeFieldNumber = 1,
+    kCardIdFieldNumber = 2,
+    kTargetPlayerFieldNumber = 3,
+    kSequenceFieldNumber = 4,
+  };
   // .sanguosha.ActionType type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::sanguosha::ActionType type() const;
   void set_type(::sanguosha::ActionType value);
+  private:
+  ::sanguosha::ActionType _internal_type() const;
+  void _internal_set_type(::sanguosha::ActionType value);
+  public:
 
   // uint32 card_id = 2;
   void clear_card_id();
-  static const int kCardIdFieldNumber = 2;
-  ::google::protobuf::uint32 card_id() const;
-  void set_card_id(::google::protobuf::uint32 value);
+  uint32_t card_id() const;
+  void set_card_id(uint32_t value);
+  private:
+  uint32_t _internal_card_id() const;
+  void _internal_set_card_id(uint32_t value);
+  public:
 
   // uint32 target_player = 3;
   void clear_target_player();
-  static const int kTargetPlayerFieldNumber = 3;
-  ::google::protobuf::uint32 target_player() const;
-  void set_target_player(::google::protobuf::uint32 value);
+  uint32_t target_player() const;
+  void set_target_player(uint32_t value);
+  private:
+  uint32_t _internal_target_player() const;
+  void _internal_set_target_player(uint32_t value);
+  public:
+
+  // uint32 sequence = 4;
+  void clear_sequence();
+  uint32_t sequence() const;
+  void set_sequence(uint32_t value);
+  private:
+  uint32_t _internal_sequence() const;
+  void _internal_set_sequence(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameAction)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int type_;
-  ::google::protobuf::uint32 card_id_;
-  ::google::protobuf::uint32 target_player_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int type_;
+    uint32_t card_id_;
+    uint32_t target_player_;
+    uint32_t sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.PlayerState) */ {
+class PlayerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.PlayerState) */ {
  public:
-  PlayerState();
-  virtual ~PlayerState();
+  inline PlayerState() : PlayerState(nullptr) {}
+  ~PlayerState() override;
+  explicit PROTOBUF_CONSTEXPR PlayerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   PlayerState(const PlayerState& from);
-
-  inline PlayerState& operator=(const PlayerState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   PlayerState(PlayerState&& from) noexcept
     : PlayerState() {
     *this = ::std::move(from);
   }
 
+  inline PlayerState& operator=(const PlayerState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayerState& operator=(PlayerState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayerState* internal_default_instance() {
     return reinterpret_cast<const PlayerState*>(
                &_PlayerState_default_instance_);
@@ -1247,145 +1811,210 @@ class PlayerState : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     8;
 
-  void Swap(PlayerState* other);
   friend void swap(PlayerState& a, PlayerState& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayerState* New() const final {
-    return CreateMaybeMessage<PlayerState>(NULL);
-  }
-
-  PlayerState* New(::google::protobuf::Arena* arena) const final {
+  PlayerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayerState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerState& from);
-  void MergeFrom(const PlayerState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerState& from) {
+    PlayerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayerState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.PlayerState";
   }
+  protected:
+  explicit PlayerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHandCardsFieldNumber = 5,
+    kUsernameFieldNumber = 2,
+    kPlayerIdFieldNumber = 1,
+    kHpFieldNumber = 3,
+    kMaxHpFieldNumber = 4,
+  };
   // repeated uint32 hand_cards = 5;
   int hand_cards_size() const;
+  private:
+  int _internal_hand_cards_size() const;
+  public:
   void clear_hand_cards();
-  static const int kHandCardsFieldNumber = 5;
-  ::google::protobuf::uint32 hand_cards(int index) const;
-  void set_hand_cards(int index, ::google::protobuf::uint32 value);
-  void add_hand_cards(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_hand_cards(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_hand_cards() const;
+  void _internal_add_hand_cards(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_hand_cards();
+  public:
+  uint32_t hand_cards(int index) const;
+  void set_hand_cards(int index, uint32_t value);
+  void add_hand_cards(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       hand_cards() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_hand_cards();
 
   // string username = 2;
   void clear_username();
-  static const int kUsernameFieldNumber = 2;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // uint32 player_id = 1;
   void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  ::google::protobuf::uint32 player_id() const;
-  void set_player_id(::google::protobuf::uint32 value);
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
 
   // uint32 hp = 3;
   void clear_hp();
-  static const int kHpFieldNumber = 3;
-  ::google::protobuf::uint32 hp() const;
-  void set_hp(::google::protobuf::uint32 value);
+  uint32_t hp() const;
+  void set_hp(uint32_t value);
+  private:
+  uint32_t _internal_hp() const;
+  void _internal_set_hp(uint32_t value);
+  public:
 
   // uint32 max_hp = 4;
   void clear_max_hp();
-  static const int kMaxHpFieldNumber = 4;
-  ::google::protobuf::uint32 max_hp() const;
-  void set_max_hp(::google::protobuf::uint32 value);
+  uint32_t max_hp() const;
+  void set_max_hp(uint32_t value);
+  private:
+  uint32_t _internal_max_hp() const;
+  void _internal_set_max_hp(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.PlayerState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > hand_cards_;
-  mutable int _hand_cards_cached_byte_size_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::uint32 player_id_;
-  ::google::protobuf::uint32 hp_;
-  ::google::protobuf::uint32 max_hp_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > hand_cards_;
+    mutable std::atomic<int> _hand_cards_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint32_t player_id_;
+    uint32_t hp_;
+    uint32_t max_hp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameState) */ {
+class GameState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameState) */ {
  public:
-  GameState();
-  virtual ~GameState();
+  inline GameState() : GameState(nullptr) {}
+  ~GameState() override;
+  explicit PROTOBUF_CONSTEXPR GameState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameState(const GameState& from);
-
-  inline GameState& operator=(const GameState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameState(GameState&& from) noexcept
     : GameState() {
     *this = ::std::move(from);
   }
 
+  inline GameState& operator=(const GameState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameState& operator=(GameState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameState* internal_default_instance() {
     return reinterpret_cast<const GameState*>(
                &_GameState_default_instance_);
@@ -1393,455 +2022,1549 @@ class GameState : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     9;
 
-  void Swap(GameState* other);
   friend void swap(GameState& a, GameState& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameState* New() const final {
-    return CreateMaybeMessage<GameState>(NULL);
-  }
-
-  GameState* New(::google::protobuf::Arena* arena) const final {
+  GameState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameState& from);
-  void MergeFrom(const GameState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameState& from) {
+    GameState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameState";
   }
+  protected:
+  explicit GameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPlayersFieldNumber = 2,
+    kGameLogFieldNumber = 4,
+    kCurrentPlayerFieldNumber = 1,
+    kPhaseFieldNumber = 3,
+    kVersionFieldNumber = 5,
+    kAckedSequenceFieldNumber = 6,
+  };
   // repeated .sanguosha.PlayerState players = 2;
   int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
   void clear_players();
-  static const int kPlayersFieldNumber = 2;
   ::sanguosha::PlayerState* mutable_players(int index);
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
       mutable_players();
+  private:
+  const ::sanguosha::PlayerState& _internal_players(int index) const;
+  ::sanguosha::PlayerState* _internal_add_players();
+  public:
   const ::sanguosha::PlayerState& players(int index) const;
   ::sanguosha::PlayerState* add_players();
-  const ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
       players() const;
 
   // string game_log = 4;
   void clear_game_log();
-  static const int kGameLogFieldNumber = 4;
-  const ::std::string& game_log() const;
-  void set_game_log(const ::std::string& value);
-  #if LANG_CXX11
-  void set_game_log(::std::string&& value);
-  #endif
-  void set_game_log(const char* value);
-  void set_game_log(const char* value, size_t size);
-  ::std::string* mutable_game_log();
-  ::std::string* release_game_log();
-  void set_allocated_game_log(::std::string* game_log);
+  const std::string& game_log() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_game_log(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_game_log();
+  PROTOBUF_NODISCARD std::string* release_game_log();
+  void set_allocated_game_log(std::string* game_log);
+  private:
+  const std::string& _internal_game_log() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_game_log(const std::string& value);
+  std::string* _internal_mutable_game_log();
+  public:
 
   // uint32 current_player = 1;
   void clear_current_player();
-  static const int kCurrentPlayerFieldNumber = 1;
-  ::google::protobuf::uint32 current_player() const;
-  void set_current_player(::google::protobuf::uint32 value);
+  uint32_t current_player() const;
+  void set_current_player(uint32_t value);
+  private:
+  uint32_t _internal_current_player() const;
+  void _internal_set_current_player(uint32_t value);
+  public:
 
   // .sanguosha.GamePhase phase = 3;
   void clear_phase();
-  static const int kPhaseFieldNumber = 3;
   ::sanguosha::GamePhase phase() const;
   void set_phase(::sanguosha::GamePhase value);
+  private:
+  ::sanguosha::GamePhase _internal_phase() const;
+  void _internal_set_phase(::sanguosha::GamePhase value);
+  public:
+
+  // uint64 version = 5;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // uint32 acked_sequence = 6;
+  void clear_acked_sequence();
+  uint32_t acked_sequence() const;
+  void set_acked_sequence(uint32_t value);
+  private:
+  uint32_t _internal_acked_sequence() const;
+  void _internal_set_acked_sequence(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState > players_;
-  ::google::protobuf::internal::ArenaStringPtr game_log_;
-  ::google::protobuf::uint32 current_player_;
-  int phase_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState > players_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr game_log_;
+    uint32_t current_player_;
+    int phase_;
+    uint64_t version_;
+    uint32_t acked_sequence_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameStart : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStart) */ {
+class PlayerStateDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.PlayerStateDelta) */ {
  public:
-  GameStart();
-  virtual ~GameStart();
+  inline PlayerStateDelta() : PlayerStateDelta(nullptr) {}
+  ~PlayerStateDelta() override;
+  explicit PROTOBUF_CONSTEXPR PlayerStateDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameStart(const GameStart& from);
+  PlayerStateDelta(const PlayerStateDelta& from);
+  PlayerStateDelta(PlayerStateDelta&& from) noexcept
+    : PlayerStateDelta() {
+    *this = ::std::move(from);
+  }
 
-  inline GameStart& operator=(const GameStart& from) {
+  inline PlayerStateDelta& operator=(const PlayerStateDelta& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  GameStart(GameStart&& from) noexcept
-    : GameStart() {
-    *this = ::std::move(from);
-  }
-
-  inline GameStart& operator=(GameStart&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline PlayerStateDelta& operator=(PlayerStateDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameStart& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameStart* internal_default_instance() {
-    return reinterpret_cast<const GameStart*>(
-               &_GameStart_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerStateDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PlayerStateDelta* internal_default_instance() {
+    return reinterpret_cast<const PlayerStateDelta*>(
+               &_PlayerStateDelta_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  void Swap(GameStart* other);
-  friend void swap(GameStart& a, GameStart& b) {
+  friend void swap(PlayerStateDelta& a, PlayerStateDelta& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerStateDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerStateDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameStart* New() const final {
-    return CreateMaybeMessage<GameStart>(NULL);
+  PlayerStateDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PlayerStateDelta>(arena);
   }
-
-  GameStart* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<GameStart>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PlayerStateDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerStateDelta& from) {
+    PlayerStateDelta::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const GameStart& from);
-  void MergeFrom(const GameStart& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameStart* other);
+  void InternalSwap(PlayerStateDelta* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.PlayerStateDelta";
   }
+  protected:
+  explicit PlayerStateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // repeated uint32 player_ids = 2;
-  int player_ids_size() const;
-  void clear_player_ids();
-  static const int kPlayerIdsFieldNumber = 2;
-  ::google::protobuf::uint32 player_ids(int index) const;
-  void set_player_ids(int index, ::google::protobuf::uint32 value);
-  void add_player_ids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-      player_ids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-      mutable_player_ids();
+  enum : int {
+    kHandCardsFieldNumber = 6,
+    kUsernameFieldNumber = 2,
+    kPlayerIdFieldNumber = 1,
+    kHpFieldNumber = 3,
+    kMaxHpFieldNumber = 4,
+    kHandCardsChangedFieldNumber = 5,
+  };
+  // repeated uint32 hand_cards = 6;
+  int hand_cards_size() const;
+  private:
+  int _internal_hand_cards_size() const;
+  public:
+  void clear_hand_cards();
+  private:
+  uint32_t _internal_hand_cards(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_hand_cards() const;
+  void _internal_add_hand_cards(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_hand_cards();
+  public:
+  uint32_t hand_cards(int index) const;
+  void set_hand_cards(int index, uint32_t value);
+  void add_hand_cards(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      hand_cards() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_hand_cards();
 
-  // uint32 room_id = 1;
-  void clear_room_id();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  // optional string username = 2;
+  bool has_username() const;
+  private:
+  bool _internal_has_username() const;
+  public:
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
-  // @@protoc_insertion_point(class_scope:sanguosha.GameStart)
- private:
+  // uint32 player_id = 1;
+  void clear_player_id();
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
+
+  // optional uint32 hp = 3;
+  bool has_hp() const;
+  private:
+  bool _internal_has_hp() const;
+  public:
+  void clear_hp();
+  uint32_t hp() const;
+  void set_hp(uint32_t value);
+  private:
+  uint32_t _internal_hp() const;
+  void _internal_set_hp(uint32_t value);
+  public:
+
+  // optional uint32 max_hp = 4;
+  bool has_max_hp() const;
+  private:
+  bool _internal_has_max_hp() const;
+  public:
+  void clear_max_hp();
+  uint32_t max_hp() const;
+  void set_max_hp(uint32_t value);
+  private:
+  uint32_t _internal_max_hp() const;
+  void _internal_set_max_hp(uint32_t value);
+  public:
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > player_ids_;
-  mutable int _player_ids_cached_byte_size_;
-  ::google::protobuf::uint32 room_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  // bool hand_cards_changed = 5;
+  void clear_hand_cards_changed();
+  bool hand_cards_changed() const;
+  void set_hand_cards_changed(bool value);
+  private:
+  bool _internal_hand_cards_changed() const;
+  void _internal_set_hand_cards_changed(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.PlayerStateDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > hand_cards_;
+    mutable std::atomic<int> _hand_cards_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint32_t player_id_;
+    uint32_t hp_;
+    uint32_t max_hp_;
+    bool hand_cards_changed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameMessage) */ {
+class GameStateDelta final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStateDelta) */ {
  public:
-  GameMessage();
-  virtual ~GameMessage();
+  inline GameStateDelta() : GameStateDelta(nullptr) {}
+  ~GameStateDelta() override;
+  explicit PROTOBUF_CONSTEXPR GameStateDelta(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameMessage(const GameMessage& from);
+  GameStateDelta(const GameStateDelta& from);
+  GameStateDelta(GameStateDelta&& from) noexcept
+    : GameStateDelta() {
+    *this = ::std::move(from);
+  }
 
-  inline GameMessage& operator=(const GameMessage& from) {
+  inline GameStateDelta& operator=(const GameStateDelta& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  GameMessage(GameMessage&& from) noexcept
-    : GameMessage() {
-    *this = ::std::move(from);
-  }
-
-  inline GameMessage& operator=(GameMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline GameStateDelta& operator=(GameStateDelta&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameMessage& default_instance();
-
-  enum ContentCase {
-    kLoginRequest = 2,
-    kLoginResponse = 3,
-    kHeartbeat = 4,
-    kRoomRequest = 5,
-    kRoomResponse = 6,
-    kGameAction = 7,
-    kGameState = 8,
-    kGameStart = 9,
-    kGameOver = 10,
-    kRoomListResponse = 14,
-    CONTENT_NOT_SET = 0,
-  };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameMessage* internal_default_instance() {
-    return reinterpret_cast<const GameMessage*>(
-               &_GameMessage_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameStateDelta& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameStateDelta* internal_default_instance() {
+    return reinterpret_cast<const GameStateDelta*>(
+               &_GameStateDelta_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  void Swap(GameMessage* other);
-  friend void swap(GameMessage& a, GameMessage& b) {
+  friend void swap(GameStateDelta& a, GameStateDelta& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameStateDelta* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameStateDelta* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameMessage* New() const final {
-    return CreateMaybeMessage<GameMessage>(NULL);
+  GameStateDelta* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameStateDelta>(arena);
   }
-
-  GameMessage* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<GameMessage>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameStateDelta& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameStateDelta& from) {
+    GameStateDelta::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const GameMessage& from);
-  void MergeFrom(const GameMessage& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameMessage* other);
+  void InternalSwap(GameStateDelta* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameStateDelta";
   }
+  protected:
+  explicit GameStateDelta(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // .sanguosha.MessageType type = 1;
-  void clear_type();
-  static const int kTypeFieldNumber = 1;
-  ::sanguosha::MessageType type() const;
-  void set_type(::sanguosha::MessageType value);
-
-  // .sanguosha.LoginRequest login_request = 2;
+  enum : int {
+    kPlayersFieldNumber = 5,
+    kRemovedPlayersFieldNumber = 6,
+    kGameLogFieldNumber = 7,
+    kBaseVersionFieldNumber = 1,
+    kVersionFieldNumber = 2,
+    kCurrentPlayerFieldNumber = 3,
+    kPhaseFieldNumber = 4,
+    kAckedSequenceFieldNumber = 8,
+  };
+  // repeated .sanguosha.PlayerStateDelta players = 5;
+  int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
+  void clear_players();
+  ::sanguosha::PlayerStateDelta* mutable_players(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerStateDelta >*
+      mutable_players();
+  private:
+  const ::sanguosha::PlayerStateDelta& _internal_players(int index) const;
+  ::sanguosha::PlayerStateDelta* _internal_add_players();
+  public:
+  const ::sanguosha::PlayerStateDelta& players(int index) const;
+  ::sanguosha::PlayerStateDelta* add_players();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerStateDelta >&
+      players() const;
+
+  // repeated uint32 removed_players = 6;
+  int removed_players_size() const;
+  private:
+  int _internal_removed_players_size() const;
+  public:
+  void clear_removed_players();
+  private:
+  uint32_t _internal_removed_players(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_removed_players() const;
+  void _internal_add_removed_players(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_removed_players();
+  public:
+  uint32_t removed_players(int index) const;
+  void set_removed_players(int index, uint32_t value);
+  void add_removed_players(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      removed_players() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_removed_players();
+
+  // string game_log = 7;
+  void clear_game_log();
+  const std::string& game_log() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_game_log(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_game_log();
+  PROTOBUF_NODISCARD std::string* release_game_log();
+  void set_allocated_game_log(std::string* game_log);
+  private:
+  const std::string& _internal_game_log() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_game_log(const std::string& value);
+  std::string* _internal_mutable_game_log();
+  public:
+
+  // uint64 base_version = 1;
+  void clear_base_version();
+  uint64_t base_version() const;
+  void set_base_version(uint64_t value);
+  private:
+  uint64_t _internal_base_version() const;
+  void _internal_set_base_version(uint64_t value);
+  public:
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // optional uint32 current_player = 3;
+  bool has_current_player() const;
+  private:
+  bool _internal_has_current_player() const;
+  public:
+  void clear_current_player();
+  uint32_t current_player() const;
+  void set_current_player(uint32_t value);
+  private:
+  uint32_t _internal_current_player() const;
+  void _internal_set_current_player(uint32_t value);
+  public:
+
+  // optional .sanguosha.GamePhase phase = 4;
+  bool has_phase() const;
+  private:
+  bool _internal_has_phase() const;
+  public:
+  void clear_phase();
+  ::sanguosha::GamePhase phase() const;
+  void set_phase(::sanguosha::GamePhase value);
+  private:
+  ::sanguosha::GamePhase _internal_phase() const;
+  void _internal_set_phase(::sanguosha::GamePhase value);
+  public:
+
+  // uint32 acked_sequence = 8;
+  void clear_acked_sequence();
+  uint32_t acked_sequence() const;
+  void set_acked_sequence(uint32_t value);
+  private:
+  uint32_t _internal_acked_sequence() const;
+  void _internal_set_acked_sequence(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.GameStateDelta)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerStateDelta > players_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > removed_players_;
+    mutable std::atomic<int> _removed_players_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr game_log_;
+    uint64_t base_version_;
+    uint64_t version_;
+    uint32_t current_player_;
+    int phase_;
+    uint32_t acked_sequence_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameStateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStateRequest) */ {
+ public:
+  inline GameStateRequest() : GameStateRequest(nullptr) {}
+  ~GameStateRequest() override;
+  explicit PROTOBUF_CONSTEXPR GameStateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameStateRequest(const GameStateRequest& from);
+  GameStateRequest(GameStateRequest&& from) noexcept
+    : GameStateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GameStateRequest& operator=(const GameStateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameStateRequest& operator=(GameStateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameStateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameStateRequest* internal_default_instance() {
+    return reinterpret_cast<const GameStateRequest*>(
+               &_GameStateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(GameStateRequest& a, GameStateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameStateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameStateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameStateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameStateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameStateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameStateRequest& from) {
+    GameStateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameStateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameStateRequest";
+  }
+  protected:
+  explicit GameStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKnownVersionFieldNumber = 1,
+  };
+  // uint64 known_version = 1;
+  void clear_known_version();
+  uint64_t known_version() const;
+  void set_known_version(uint64_t value);
+  private:
+  uint64_t _internal_known_version() const;
+  void _internal_set_known_version(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.GameStateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t known_version_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStart) */ {
+ public:
+  inline GameStart() : GameStart(nullptr) {}
+  ~GameStart() override;
+  explicit PROTOBUF_CONSTEXPR GameStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameStart(const GameStart& from);
+  GameStart(GameStart&& from) noexcept
+    : GameStart() {
+    *this = ::std::move(from);
+  }
+
+  inline GameStart& operator=(const GameStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameStart& operator=(GameStart&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameStart& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameStart* internal_default_instance() {
+    return reinterpret_cast<const GameStart*>(
+               &_GameStart_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(GameStart& a, GameStart& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameStart>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameStart& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameStart& from) {
+    GameStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameStart* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameStart";
+  }
+  protected:
+  explicit GameStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayerIdsFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+  };
+  // repeated uint32 player_ids = 2;
+  int player_ids_size() const;
+  private:
+  int _internal_player_ids_size() const;
+  public:
+  void clear_player_ids();
+  private:
+  uint32_t _internal_player_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_player_ids() const;
+  void _internal_add_player_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_player_ids();
+  public:
+  uint32_t player_ids(int index) const;
+  void set_player_ids(int index, uint32_t value);
+  void add_player_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      player_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_player_ids();
+
+  // uint32 room_id = 1;
+  void clear_room_id();
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.GameStart)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > player_ids_;
+    mutable std::atomic<int> _player_ids_cached_byte_size_;
+    uint32_t room_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class MessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.MessageBatch) */ {
+ public:
+  inline MessageBatch() : MessageBatch(nullptr) {}
+  ~MessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR MessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  MessageBatch(const MessageBatch& from);
+  MessageBatch(MessageBatch&& from) noexcept
+    : MessageBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline MessageBatch& operator=(const MessageBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline MessageBatch& operator=(MessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageBatch* internal_default_instance() {
+    return reinterpret_cast<const MessageBatch*>(
+               &_MessageBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(MessageBatch& a, MessageBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  MessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const MessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageBatch& from) {
+    MessageBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.MessageBatch";
+  }
+  protected:
+  explicit MessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .sanguosha.GameMessage messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::sanguosha::GameMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >*
+      mutable_messages();
+  private:
+  const ::sanguosha::GameMessage& _internal_messages(int index) const;
+  ::sanguosha::GameMessage* _internal_add_messages();
+  public:
+  const ::sanguosha::GameMessage& messages(int index) const;
+  ::sanguosha::GameMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:sanguosha.MessageBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameMessage) */ {
+ public:
+  inline GameMessage() : GameMessage(nullptr) {}
+  ~GameMessage() override;
+  explicit PROTOBUF_CONSTEXPR GameMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameMessage(const GameMessage& from);
+  GameMessage(GameMessage&& from) noexcept
+    : GameMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline GameMessage& operator=(const GameMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameMessage& operator=(GameMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ContentCase {
+    kLoginRequest = 2,
+    kLoginResponse = 3,
+    kHeartbeat = 4,
+    kRoomRequest = 5,
+    kRoomResponse = 6,
+    kGameAction = 7,
+    kGameState = 8,
+    kGameStart = 9,
+    kGameOver = 10,
+    kGameStateDelta = 11,
+    kGameStateRequest = 12,
+    kRoomListResponse = 14,
+    kBatch = 15,
+    CONTENT_NOT_SET = 0,
+  };
+
+  static inline const GameMessage* internal_default_instance() {
+    return reinterpret_cast<const GameMessage*>(
+               &_GameMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GameMessage& a, GameMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameMessage& from) {
+    GameMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameMessage";
+  }
+  protected:
+  explicit GameMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 1,
+    kLoginRequestFieldNumber = 2,
+    kLoginResponseFieldNumber = 3,
+    kHeartbeatFieldNumber = 4,
+    kRoomRequestFieldNumber = 5,
+    kRoomResponseFieldNumber = 6,
+    kGameActionFieldNumber = 7,
+    kGameStateFieldNumber = 8,
+    kGameStartFieldNumber = 9,
+    kGameOverFieldNumber = 10,
+    kGameStateDeltaFieldNumber = 11,
+    kGameStateRequestFieldNumber = 12,
+    kRoomListResponseFieldNumber = 14,
+    kBatchFieldNumber = 15,
+  };
+  // .sanguosha.MessageType type = 1;
+  void clear_type();
+  ::sanguosha::MessageType type() const;
+  void set_type(::sanguosha::MessageType value);
+  private:
+  ::sanguosha::MessageType _internal_type() const;
+  void _internal_set_type(::sanguosha::MessageType value);
+  public:
+
+  // .sanguosha.LoginRequest login_request = 2;
   bool has_login_request() const;
-  void clear_login_request();
-  static const int kLoginRequestFieldNumber = 2;
   private:
-  const ::sanguosha::LoginRequest& _internal_login_request() const;
+  bool _internal_has_login_request() const;
   public:
+  void clear_login_request();
   const ::sanguosha::LoginRequest& login_request() const;
-  ::sanguosha::LoginRequest* release_login_request();
+  PROTOBUF_NODISCARD ::sanguosha::LoginRequest* release_login_request();
   ::sanguosha::LoginRequest* mutable_login_request();
   void set_allocated_login_request(::sanguosha::LoginRequest* login_request);
+  private:
+  const ::sanguosha::LoginRequest& _internal_login_request() const;
+  ::sanguosha::LoginRequest* _internal_mutable_login_request();
+  public:
+  void unsafe_arena_set_allocated_login_request(
+      ::sanguosha::LoginRequest* login_request);
+  ::sanguosha::LoginRequest* unsafe_arena_release_login_request();
 
   // .sanguosha.LoginResponse login_response = 3;
   bool has_login_response() const;
-  void clear_login_response();
-  static const int kLoginResponseFieldNumber = 3;
   private:
-  const ::sanguosha::LoginResponse& _internal_login_response() const;
+  bool _internal_has_login_response() const;
   public:
+  void clear_login_response();
   const ::sanguosha::LoginResponse& login_response() const;
-  ::sanguosha::LoginResponse* release_login_response();
+  PROTOBUF_NODISCARD ::sanguosha::LoginResponse* release_login_response();
   ::sanguosha::LoginResponse* mutable_login_response();
   void set_allocated_login_response(::sanguosha::LoginResponse* login_response);
+  private:
+  const ::sanguosha::LoginResponse& _internal_login_response() const;
+  ::sanguosha::LoginResponse* _internal_mutable_login_response();
+  public:
+  void unsafe_arena_set_allocated_login_response(
+      ::sanguosha::LoginResponse* login_response);
+  ::sanguosha::LoginResponse* unsafe_arena_release_login_response();
 
   // .sanguosha.Heartbeat heartbeat = 4;
   bool has_heartbeat() const;
-  void clear_heartbeat();
-  static const int kHeartbeatFieldNumber = 4;
   private:
-  const ::sanguosha::Heartbeat& _internal_heartbeat() const;
+  bool _internal_has_heartbeat() const;
   public:
+  void clear_heartbeat();
   const ::sanguosha::Heartbeat& heartbeat() const;
-  ::sanguosha::Heartbeat* release_heartbeat();
+  PROTOBUF_NODISCARD ::sanguosha::Heartbeat* release_heartbeat();
   ::sanguosha::Heartbeat* mutable_heartbeat();
   void set_allocated_heartbeat(::sanguosha::Heartbeat* heartbeat);
+  private:
+  const ::sanguosha::Heartbeat& _internal_heartbeat() const;
+  ::sanguosha::Heartbeat* _internal_mutable_heartbeat();
+  public:
+  void unsafe_arena_set_allocated_heartbeat(
+      ::sanguosha::Heartbeat* heartbeat);
+  ::sanguosha::Heartbeat* unsafe_arena_release_heartbeat();
 
   // .sanguosha.RoomRequest room_request = 5;
   bool has_room_request() const;
-  void clear_room_request();
-  static const int kRoomRequestFieldNumber = 5;
   private:
-  const ::sanguosha::RoomRequest& _internal_room_request() const;
+  bool _internal_has_room_request() const;
   public:
+  void clear_room_request();
   const ::sanguosha::RoomRequest& room_request() const;
-  ::sanguosha::RoomRequest* release_room_request();
+  PROTOBUF_NODISCARD ::sanguosha::RoomRequest* release_room_request();
   ::sanguosha::RoomRequest* mutable_room_request();
   void set_allocated_room_request(::sanguosha::RoomRequest* room_request);
+  private:
+  const ::sanguosha::RoomRequest& _internal_room_request() const;
+  ::sanguosha::RoomRequest* _internal_mutable_room_request();
+  public:
+  void unsafe_arena_set_allocated_room_request(
+      ::sanguosha::RoomRequest* room_request);
+  ::sanguosha::RoomRequest* unsafe_arena_release_room_request();
 
   // .sanguosha.RoomResponse room_response = 6;
   bool has_room_response() const;
-  void clear_room_response();
-  static const int kRoomResponseFieldNumber = 6;
   private:
-  const ::sanguosha::RoomResponse& _internal_room_response() const;
+  bool _internal_has_room_response() const;
   public:
+  void clear_room_response();
   const ::sanguosha::RoomResponse& room_response() const;
-  ::sanguosha::RoomResponse* release_room_response();
+  PROTOBUF_NODISCARD ::sanguosha::RoomResponse* release_room_response();
   ::sanguosha::RoomResponse* mutable_room_response();
   void set_allocated_room_response(::sanguosha::RoomResponse* room_response);
+  private:
+  const ::sanguosha::RoomResponse& _internal_room_response() const;
+  ::sanguosha::RoomResponse* _internal_mutable_room_response();
+  public:
+  void unsafe_arena_set_allocated_room_response(
+      ::sanguosha::RoomResponse* room_response);
+  ::sanguosha::RoomResponse* unsafe_arena_release_room_response();
 
   // .sanguosha.GameAction game_action = 7;
   bool has_game_action() const;
-  void clear_game_action();
-  static const int kGameActionFieldNumber = 7;
   private:
-  const ::sanguosha::GameAction& _internal_game_action() const;
+  bool _internal_has_game_action() const;
   public:
+  void clear_game_action();
   const ::sanguosha::GameAction& game_action() const;
-  ::sanguosha::GameAction* release_game_action();
+  PROTOBUF_NODISCARD ::sanguosha::GameAction* release_game_action();
   ::sanguosha::GameAction* mutable_game_action();
   void set_allocated_game_action(::sanguosha::GameAction* game_action);
+  private:
+  const ::sanguosha::GameAction& _internal_game_action() const;
+  ::sanguosha::GameAction* _internal_mutable_game_action();
+  public:
+  void unsafe_arena_set_allocated_game_action(
+      ::sanguosha::GameAction* game_action);
+  ::sanguosha::GameAction* unsafe_arena_release_game_action();
 
   // .sanguosha.GameState game_state = 8;
   bool has_game_state() const;
-  void clear_game_state();
-  static const int kGameStateFieldNumber = 8;
   private:
-  const ::sanguosha::GameState& _internal_game_state() const;
+  bool _internal_has_game_state() const;
   public:
+  void clear_game_state();
   const ::sanguosha::GameState& game_state() const;
-  ::sanguosha::GameState* release_game_state();
+  PROTOBUF_NODISCARD ::sanguosha::GameState* release_game_state();
   ::sanguosha::GameState* mutable_game_state();
   void set_allocated_game_state(::sanguosha::GameState* game_state);
+  private:
+  const ::sanguosha::GameState& _internal_game_state() const;
+  ::sanguosha::GameState* _internal_mutable_game_state();
+  public:
+  void unsafe_arena_set_allocated_game_state(
+      ::sanguosha::GameState* game_state);
+  ::sanguosha::GameState* unsafe_arena_release_game_state();
 
   // .sanguosha.GameStart game_start = 9;
   bool has_game_start() const;
-  void clear_game_start();
-  static const int kGameStartFieldNumber = 9;
   private:
-  const ::sanguosha::GameStart& _internal_game_start() const;
+  bool _internal_has_game_start() const;
   public:
+  void clear_game_start();
   const ::sanguosha::GameStart& game_start() const;
-  ::sanguosha::GameStart* release_game_start();
+  PROTOBUF_NODISCARD ::sanguosha::GameStart* release_game_start();
   ::sanguosha::GameStart* mutable_game_start();
   void set_allocated_game_start(::sanguosha::GameStart* game_start);
+  private:
+  const ::sanguosha::GameStart& _internal_game_start() const;
+  ::sanguosha::GameStart* _internal_mutable_game_start();
+  public:
+  void unsafe_arena_set_allocated_game_start(
+      ::sanguosha::GameStart* game_start);
+  ::sanguosha::GameStart* unsafe_arena_release_game_start();
 
   // .sanguosha.GameOver game_over = 10;
   bool has_game_over() const;
-  void clear_game_over();
-  static const int kGameOverFieldNumber = 10;
   private:
-  const ::sanguosha::GameOver& _internal_game_over() const;
+  bool _internal_has_game_over() const;
   public:
+  void clear_game_over();
   const ::sanguosha::GameOver& game_over() const;
-  ::sanguosha::GameOver* release_game_over();
+  PROTOBUF_NODISCARD ::sanguosha::GameOver* release_game_over();
   ::sanguosha::GameOver* mutable_game_over();
   void set_allocated_game_over(::sanguosha::GameOver* game_over);
+  private:
+  const ::sanguosha::GameOver& _internal_game_over() const;
+  ::sanguosha::GameOver* _internal_mutable_game_over();
+  public:
+  void unsafe_arena_set_allocated_game_over(
+      ::sanguosha::GameOver* game_over);
+  ::sanguosha::GameOver* unsafe_arena_release_game_over();
+
+  // .sanguosha.GameStateDelta game_state_delta = 11;
+  bool has_game_state_delta() const;
+  private:
+  bool _internal_has_game_state_delta() const;
+  public:
+  void clear_game_state_delta();
+  const ::sanguosha::GameStateDelta& game_state_delta() const;
+  PROTOBUF_NODISCARD ::sanguosha::GameStateDelta* release_game_state_delta();
+  ::sanguosha::GameStateDelta* mutable_game_state_delta();
+  void set_allocated_game_state_delta(::sanguosha::GameStateDelta* game_state_delta);
+  private:
+  const ::sanguosha::GameStateDelta& _internal_game_state_delta() const;
+  ::sanguosha::GameStateDelta* _internal_mutable_game_state_delta();
+  public:
+  void unsafe_arena_set_allocated_game_state_delta(
+      ::sanguosha::GameStateDelta* game_state_delta);
+  ::sanguosha::GameStateDelta* unsafe_arena_release_game_state_delta();
+
+  // .sanguosha.GameStateRequest game_state_request = 12;
+  bool has_game_state_request() const;
+  private:
+  bool _internal_has_game_state_request() const;
+  public:
+  void clear_game_state_request();
+  const ::sanguosha::GameStateRequest& game_state_request() const;
+  PROTOBUF_NODISCARD ::sanguosha::GameStateRequest* release_game_state_request();
+  ::sanguosha::GameStateRequest* mutable_game_state_request();
+  void set_allocated_game_state_request(::sanguosha::GameStateRequest* game_state_request);
+  private:
+  const ::sanguosha::GameStateRequest& _internal_game_state_request() const;
+  ::sanguosha::GameStateRequest* _internal_mutable_game_state_request();
+  public:
+  void unsafe_arena_set_allocated_game_state_request(
+      ::sanguosha::GameStateRequest* game_state_request);
+  ::sanguosha::GameStateRequest* unsafe_arena_release_game_state_request();
 
   // .sanguosha.RoomListResponse room_list_response = 14;
   bool has_room_list_response() const;
-  void clear_room_list_response();
-  static const int kRoomListResponseFieldNumber = 14;
   private:
-  const ::sanguosha::RoomListResponse& _internal_room_list_response() const;
+  bool _internal_has_room_list_response() const;
   public:
+  void clear_room_list_response();
   const ::sanguosha::RoomListResponse& room_list_response() const;
-  ::sanguosha::RoomListResponse* release_room_list_response();
+  PROTOBUF_NODISCARD ::sanguosha::RoomListResponse* release_room_list_response();
   ::sanguosha::RoomListResponse* mutable_room_list_response();
   void set_allocated_room_list_response(::sanguosha::RoomListResponse* room_list_response);
+  private:
+  const ::sanguosha::RoomListResponse& _internal_room_list_response() const;
+  ::sanguosha::RoomListResponse* _internal_mutable_room_list_response();
+  public:
+  void unsafe_arena_set_allocated_room_list_response(
+      ::sanguosha::RoomListResponse* room_list_response);
+  ::sanguosha::RoomListResponse* unsafe_arena_release_room_list_response();
+
+  // .sanguosha.MessageBatch batch = 15;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::sanguosha::MessageBatch& batch() const;
+  PROTOBUF_NODISCARD ::sanguosha::MessageBatch* release_batch();
+  ::sanguosha::MessageBatch* mutable_batch();
+  void set_allocated_batch(::sanguosha::MessageBatch* batch);
+  private:
+  const ::sanguosha::MessageBatch& _internal_batch() const;
+  ::sanguosha::MessageBatch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::sanguosha::MessageBatch* batch);
+  ::sanguosha::MessageBatch* unsafe_arena_release_batch();
 
   void clear_content();
   ContentCase content_case() const;
   // @@protoc_insertion_point(class_scope:sanguosha.GameMessage)
  private:
+  class _Internal;
   void set_has_login_request();
   void set_has_login_response();
   void set_has_heartbeat();
@@ -1851,133 +3574,190 @@ class GameMessage : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void set_has_game_state();
   void set_has_game_start();
   void set_has_game_over();
+  void set_has_game_state_delta();
+  void set_has_game_state_request();
   void set_has_room_list_response();
+  void set_has_batch();
 
   inline bool has_content() const;
   inline void clear_has_content();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int type_;
-  union ContentUnion {
-    ContentUnion() {}
-    ::sanguosha::LoginRequest* login_request_;
-    ::sanguosha::LoginResponse* login_response_;
-    ::sanguosha::Heartbeat* heartbeat_;
-    ::sanguosha::RoomRequest* room_request_;
-    ::sanguosha::RoomResponse* room_response_;
-    ::sanguosha::GameAction* game_action_;
-    ::sanguosha::GameState* game_state_;
-    ::sanguosha::GameStart* game_start_;
-    ::sanguosha::GameOver* game_over_;
-    ::sanguosha::RoomListResponse* room_list_response_;
-  } content_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int type_;
+    union ContentUnion {
+      constexpr ContentUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::sanguosha::LoginRequest* login_request_;
+      ::sanguosha::LoginResponse* login_response_;
+      ::sanguosha::Heartbeat* heartbeat_;
+      ::sanguosha::RoomRequest* room_request_;
+      ::sanguosha::RoomResponse* room_response_;
+      ::sanguosha::GameAction* game_action_;
+      ::sanguosha::GameState* game_state_;
+      ::sanguosha::GameStart* game_start_;
+      ::sanguosha::GameOver* game_over_;
+      ::sanguosha::GameStateDelta* game_state_delta_;
+      ::sanguosha::GameStateRequest* game_state_request_;
+      ::sanguosha::RoomListResponse* room_list_response_;
+      ::sanguosha::MessageBatch* batch_;
+    } content_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameOver : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameOver) */ {
+class GameOver final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameOver) */ {
  public:
-  GameOver();
-  virtual ~GameOver();
+  inline GameOver() : GameOver(nullptr) {}
+  ~GameOver() override;
+  explicit PROTOBUF_CONSTEXPR GameOver(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameOver(const GameOver& from);
-
-  inline GameOver& operator=(const GameOver& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameOver(GameOver&& from) noexcept
     : GameOver() {
     *this = ::std::move(from);
   }
 
+  inline GameOver& operator=(const GameOver& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameOver& operator=(GameOver&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameOver& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameOver& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameOver* internal_default_instance() {
     return reinterpret_cast<const GameOver*>(
                &_GameOver_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    16;
 
-  void Swap(GameOver* other);
   friend void swap(GameOver& a, GameOver& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameOver* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameOver* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameOver* New() const final {
-    return CreateMaybeMessage<GameOver>(NULL);
-  }
-
-  GameOver* New(::google::protobuf::Arena* arena) const final {
+  GameOver* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameOver>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameOver& from);
-  void MergeFrom(const GameOver& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameOver& from) {
+    GameOver::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameOver* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameOver";
   }
+  protected:
+  explicit GameOver(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWinnerIdFieldNumber = 1,
+  };
   // uint32 winner_id = 1;
   void clear_winner_id();
-  static const int kWinnerIdFieldNumber = 1;
-  ::google::protobuf::uint32 winner_id() const;
-  void set_winner_id(::google::protobuf::uint32 value);
+  uint32_t winner_id() const;
+  void set_winner_id(uint32_t value);
+  private:
+  uint32_t _internal_winner_id() const;
+  void _internal_set_winner_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameOver)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 winner_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t winner_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // ===================================================================
 
@@ -1992,108 +3772,172 @@ class GameOver : public ::google::protobuf::Message /* @@protoc_insertion_point(
 
 // string username = 1;
 inline void LoginRequest::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& LoginRequest::username() const {
+inline const std::string& LoginRequest::username() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void LoginRequest::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.username)
 }
-#if LANG_CXX11
-inline void LoginRequest::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginRequest.username)
+inline std::string* LoginRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.username)
+  return _s;
 }
-#endif
-inline void LoginRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginRequest.username)
+inline const std::string& LoginRequest::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void LoginRequest::set_username(const char* value, size_t size) {
+inline void LoginRequest::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginRequest.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::mutable_username() {
+inline std::string* LoginRequest::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::release_username() {
+inline std::string* LoginRequest::release_username() {
   // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void LoginRequest::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void LoginRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.username)
 }
 
 // string password = 2;
 inline void LoginRequest::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.password_.ClearToEmpty();
 }
-inline const ::std::string& LoginRequest::password() const {
+inline const std::string& LoginRequest::password() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.password)
-  return password_.GetNoArena();
+  return _internal_password();
 }
-inline void LoginRequest::set_password(const ::std::string& value) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.password)
 }
-#if LANG_CXX11
-inline void LoginRequest::set_password(::std::string&& value) {
+inline std::string* LoginRequest::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.password)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_password() const {
+  return _impl_.password_.Get();
+}
+inline void LoginRequest::_internal_set_password(const std::string& value) {
   
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginRequest.password)
+  _impl_.password_.Set(value, GetArenaForAllocation());
 }
-#endif
-inline void LoginRequest::set_password(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* LoginRequest::_internal_mutable_password() {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginRequest.password)
+  return _impl_.password_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRequest::release_password() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.password)
+  return _impl_.password_.Release();
 }
-inline void LoginRequest::set_password(const char* value, size_t size) {
+inline void LoginRequest::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.password)
+}
+
+// uint32 capabilities = 3;
+inline void LoginRequest::clear_capabilities() {
+  _impl_.capabilities_ = 0u;
+}
+inline uint32_t LoginRequest::_internal_capabilities() const {
+  return _impl_.capabilities_;
+}
+inline uint32_t LoginRequest::capabilities() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.capabilities)
+  return _internal_capabilities();
+}
+inline void LoginRequest::_internal_set_capabilities(uint32_t value) {
   
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginRequest.password)
+  _impl_.capabilities_ = value;
+}
+inline void LoginRequest::set_capabilities(uint32_t value) {
+  _internal_set_capabilities(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.capabilities)
+}
+
+// string resume_token = 4;
+inline void LoginRequest::clear_resume_token() {
+  _impl_.resume_token_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::resume_token() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.resume_token)
+  return _internal_resume_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_resume_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.resume_token)
 }
-inline ::std::string* LoginRequest::mutable_password() {
+inline std::string* LoginRequest::mutable_resume_token() {
+  std::string* _s = _internal_mutable_resume_token();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.resume_token)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_resume_token() const {
+  return _impl_.resume_token_.Get();
+}
+inline void LoginRequest::_internal_set_resume_token(const std::string& value) {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.resume_token_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginRequest::release_password() {
-  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.password)
+inline std::string* LoginRequest::_internal_mutable_resume_token() {
   
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.resume_token_.Mutable(GetArenaForAllocation());
 }
-inline void LoginRequest::set_allocated_password(::std::string* password) {
-  if (password != NULL) {
+inline std::string* LoginRequest::release_resume_token() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.resume_token)
+  return _impl_.resume_token_.Release();
+}
+inline void LoginRequest::set_allocated_resume_token(std::string* resume_token) {
+  if (resume_token != nullptr) {
     
   } else {
     
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.password)
+  _impl_.resume_token_.SetAllocated(resume_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_token_.IsDefault()) {
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.resume_token)
 }
 
 // -------------------------------------------------------------------
@@ -2102,100 +3946,205 @@ inline void LoginRequest::set_allocated_password(::std::string* password) {
 
 // bool success = 1;
 inline void LoginResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool LoginResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool LoginResponse::success() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.success)
-  return success_;
+  return _internal_success();
 }
-inline void LoginResponse::set_success(bool value) {
+inline void LoginResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void LoginResponse::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.success)
 }
 
 // string error_message = 2;
 inline void LoginResponse::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& LoginResponse::error_message() const {
+inline const std::string& LoginResponse::error_message() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void LoginResponse::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.error_message)
 }
-#if LANG_CXX11
-inline void LoginResponse::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginResponse.error_message)
+inline std::string* LoginResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.error_message)
+  return _s;
 }
-#endif
-inline void LoginResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginResponse.error_message)
+inline const std::string& LoginResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void LoginResponse::set_error_message(const char* value, size_t size) {
+inline void LoginResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* LoginResponse::mutable_error_message() {
+inline std::string* LoginResponse::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* LoginResponse::release_error_message() {
+inline std::string* LoginResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:sanguosha.LoginResponse.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void LoginResponse::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void LoginResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginResponse.error_message)
 }
 
 // uint32 user_id = 3;
 inline void LoginResponse::clear_user_id() {
-  user_id_ = 0u;
+  _impl_.user_id_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_user_id() const {
+  return _impl_.user_id_;
 }
-inline ::google::protobuf::uint32 LoginResponse::user_id() const {
+inline uint32_t LoginResponse::user_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.user_id)
-  return user_id_;
+  return _internal_user_id();
 }
-inline void LoginResponse::set_user_id(::google::protobuf::uint32 value) {
+inline void LoginResponse::_internal_set_user_id(uint32_t value) {
   
-  user_id_ = value;
+  _impl_.user_id_ = value;
+}
+inline void LoginResponse::set_user_id(uint32_t value) {
+  _internal_set_user_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.user_id)
 }
 
+// uint32 capabilities = 4;
+inline void LoginResponse::clear_capabilities() {
+  _impl_.capabilities_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_capabilities() const {
+  return _impl_.capabilities_;
+}
+inline uint32_t LoginResponse::capabilities() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.capabilities)
+  return _internal_capabilities();
+}
+inline void LoginResponse::_internal_set_capabilities(uint32_t value) {
+  
+  _impl_.capabilities_ = value;
+}
+inline void LoginResponse::set_capabilities(uint32_t value) {
+  _internal_set_capabilities(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.capabilities)
+}
+
+// string resume_token = 5;
+inline void LoginResponse::clear_resume_token() {
+  _impl_.resume_token_.ClearToEmpty();
+}
+inline const std::string& LoginResponse::resume_token() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.resume_token)
+  return _internal_resume_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_resume_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.resume_token)
+}
+inline std::string* LoginResponse::mutable_resume_token() {
+  std::string* _s = _internal_mutable_resume_token();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.resume_token)
+  return _s;
+}
+inline const std::string& LoginResponse::_internal_resume_token() const {
+  return _impl_.resume_token_.Get();
+}
+inline void LoginResponse::_internal_set_resume_token(const std::string& value) {
+  
+  _impl_.resume_token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginResponse::_internal_mutable_resume_token() {
+  
+  return _impl_.resume_token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginResponse::release_resume_token() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginResponse.resume_token)
+  return _impl_.resume_token_.Release();
+}
+inline void LoginResponse::set_allocated_resume_token(std::string* resume_token) {
+  if (resume_token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_token_.SetAllocated(resume_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_token_.IsDefault()) {
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginResponse.resume_token)
+}
+
+// bool resumed = 6;
+inline void LoginResponse::clear_resumed() {
+  _impl_.resumed_ = false;
+}
+inline bool LoginResponse::_internal_resumed() const {
+  return _impl_.resumed_;
+}
+inline bool LoginResponse::resumed() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.resumed)
+  return _internal_resumed();
+}
+inline void LoginResponse::_internal_set_resumed(bool value) {
+  
+  _impl_.resumed_ = value;
+}
+inline void LoginResponse::set_resumed(bool value) {
+  _internal_set_resumed(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.resumed)
+}
+
 // -------------------------------------------------------------------
 
 // Heartbeat
 
 // uint64 timestamp = 1;
 inline void Heartbeat::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
+  _impl_.timestamp_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint64 Heartbeat::timestamp() const {
+inline uint64_t Heartbeat::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t Heartbeat::timestamp() const {
   // @@protoc_insertion_point(field_get:sanguosha.Heartbeat.timestamp)
-  return timestamp_;
+  return _internal_timestamp();
 }
-inline void Heartbeat::set_timestamp(::google::protobuf::uint64 value) {
+inline void Heartbeat::_internal_set_timestamp(uint64_t value) {
   
-  timestamp_ = value;
+  _impl_.timestamp_ = value;
+}
+inline void Heartbeat::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
   // @@protoc_insertion_point(field_set:sanguosha.Heartbeat.timestamp)
 }
 
@@ -2205,87 +4154,128 @@ inline void Heartbeat::set_timestamp(::google::protobuf::uint64 value) {
 
 // uint32 room_id = 1;
 inline void RoomInfo::clear_room_id() {
-  room_id_ = 0u;
+  _impl_.room_id_ = 0u;
 }
-inline ::google::protobuf::uint32 RoomInfo::room_id() const {
+inline uint32_t RoomInfo::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t RoomInfo::room_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.room_id)
-  return room_id_;
+  return _internal_room_id();
 }
-inline void RoomInfo::set_room_id(::google::protobuf::uint32 value) {
+inline void RoomInfo::_internal_set_room_id(uint32_t value) {
   
-  room_id_ = value;
+  _impl_.room_id_ = value;
+}
+inline void RoomInfo::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.room_id)
 }
 
 // repeated uint32 players = 2;
+inline int RoomInfo::_internal_players_size() const {
+  return _impl_.players_.size();
+}
 inline int RoomInfo::players_size() const {
-  return players_.size();
+  return _internal_players_size();
 }
 inline void RoomInfo::clear_players() {
-  players_.Clear();
+  _impl_.players_.Clear();
+}
+inline uint32_t RoomInfo::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
 }
-inline ::google::protobuf::uint32 RoomInfo::players(int index) const {
+inline uint32_t RoomInfo::players(int index) const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.players)
-  return players_.Get(index);
+  return _internal_players(index);
 }
-inline void RoomInfo::set_players(int index, ::google::protobuf::uint32 value) {
-  players_.Set(index, value);
+inline void RoomInfo::set_players(int index, uint32_t value) {
+  _impl_.players_.Set(index, value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.players)
 }
-inline void RoomInfo::add_players(::google::protobuf::uint32 value) {
-  players_.Add(value);
+inline void RoomInfo::_internal_add_players(uint32_t value) {
+  _impl_.players_.Add(value);
+}
+inline void RoomInfo::add_players(uint32_t value) {
+  _internal_add_players(value);
   // @@protoc_insertion_point(field_add:sanguosha.RoomInfo.players)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoomInfo::_internal_players() const {
+  return _impl_.players_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 RoomInfo::players() const {
   // @@protoc_insertion_point(field_list:sanguosha.RoomInfo.players)
-  return players_;
+  return _internal_players();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoomInfo::_internal_mutable_players() {
+  return &_impl_.players_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 RoomInfo::mutable_players() {
   // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomInfo.players)
-  return &players_;
+  return _internal_mutable_players();
 }
 
 // uint32 current_players = 3;
 inline void RoomInfo::clear_current_players() {
-  current_players_ = 0u;
+  _impl_.current_players_ = 0u;
+}
+inline uint32_t RoomInfo::_internal_current_players() const {
+  return _impl_.current_players_;
 }
-inline ::google::protobuf::uint32 RoomInfo::current_players() const {
+inline uint32_t RoomInfo::current_players() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.current_players)
-  return current_players_;
+  return _internal_current_players();
 }
-inline void RoomInfo::set_current_players(::google::protobuf::uint32 value) {
+inline void RoomInfo::_internal_set_current_players(uint32_t value) {
   
-  current_players_ = value;
+  _impl_.current_players_ = value;
+}
+inline void RoomInfo::set_current_players(uint32_t value) {
+  _internal_set_current_players(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.current_players)
 }
 
 // uint32 max_players = 4;
 inline void RoomInfo::clear_max_players() {
-  max_players_ = 0u;
+  _impl_.max_players_ = 0u;
+}
+inline uint32_t RoomInfo::_internal_max_players() const {
+  return _impl_.max_players_;
 }
-inline ::google::protobuf::uint32 RoomInfo::max_players() const {
+inline uint32_t RoomInfo::max_players() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.max_players)
-  return max_players_;
+  return _internal_max_players();
 }
-inline void RoomInfo::set_max_players(::google::protobuf::uint32 value) {
+inline void RoomInfo::_internal_set_max_players(uint32_t value) {
   
-  max_players_ = value;
+  _impl_.max_players_ = value;
+}
+inline void RoomInfo::set_max_players(uint32_t value) {
+  _internal_set_max_players(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.max_players)
 }
 
 // .sanguosha.RoomStatus status = 5;
 inline void RoomInfo::clear_status() {
-  status_ = 0;
+  _impl_.status_ = 0;
+}
+inline ::sanguosha::RoomStatus RoomInfo::_internal_status() const {
+  return static_cast< ::sanguosha::RoomStatus >(_impl_.status_);
 }
 inline ::sanguosha::RoomStatus RoomInfo::status() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.status)
-  return static_cast< ::sanguosha::RoomStatus >(status_);
+  return _internal_status();
 }
-inline void RoomInfo::set_status(::sanguosha::RoomStatus value) {
+inline void RoomInfo::_internal_set_status(::sanguosha::RoomStatus value) {
   
-  status_ = value;
+  _impl_.status_ = value;
+}
+inline void RoomInfo::set_status(::sanguosha::RoomStatus value) {
+  _internal_set_status(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.status)
 }
 
@@ -2295,29 +4285,41 @@ inline void RoomInfo::set_status(::sanguosha::RoomStatus value) {
 
 // .sanguosha.RoomAction action = 1;
 inline void RoomRequest::clear_action() {
-  action_ = 0;
+  _impl_.action_ = 0;
+}
+inline ::sanguosha::RoomAction RoomRequest::_internal_action() const {
+  return static_cast< ::sanguosha::RoomAction >(_impl_.action_);
 }
 inline ::sanguosha::RoomAction RoomRequest::action() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.action)
-  return static_cast< ::sanguosha::RoomAction >(action_);
+  return _internal_action();
 }
-inline void RoomRequest::set_action(::sanguosha::RoomAction value) {
+inline void RoomRequest::_internal_set_action(::sanguosha::RoomAction value) {
   
-  action_ = value;
+  _impl_.action_ = value;
+}
+inline void RoomRequest::set_action(::sanguosha::RoomAction value) {
+  _internal_set_action(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.action)
 }
 
 // uint32 room_id = 2;
 inline void RoomRequest::clear_room_id() {
-  room_id_ = 0u;
+  _impl_.room_id_ = 0u;
+}
+inline uint32_t RoomRequest::_internal_room_id() const {
+  return _impl_.room_id_;
 }
-inline ::google::protobuf::uint32 RoomRequest::room_id() const {
+inline uint32_t RoomRequest::room_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.room_id)
-  return room_id_;
+  return _internal_room_id();
 }
-inline void RoomRequest::set_room_id(::google::protobuf::uint32 value) {
+inline void RoomRequest::_internal_set_room_id(uint32_t value) {
   
-  room_id_ = value;
+  _impl_.room_id_ = value;
+}
+inline void RoomRequest::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.room_id)
 }
 
@@ -2327,122 +4329,161 @@ inline void RoomRequest::set_room_id(::google::protobuf::uint32 value) {
 
 // bool success = 1;
 inline void RoomResponse::clear_success() {
-  success_ = false;
+  _impl_.success_ = false;
+}
+inline bool RoomResponse::_internal_success() const {
+  return _impl_.success_;
 }
 inline bool RoomResponse::success() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.success)
-  return success_;
+  return _internal_success();
 }
-inline void RoomResponse::set_success(bool value) {
+inline void RoomResponse::_internal_set_success(bool value) {
   
-  success_ = value;
+  _impl_.success_ = value;
+}
+inline void RoomResponse::set_success(bool value) {
+  _internal_set_success(value);
   // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.success)
 }
 
 // string error_message = 2;
 inline void RoomResponse::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.error_message_.ClearToEmpty();
 }
-inline const ::std::string& RoomResponse::error_message() const {
+inline const std::string& RoomResponse::error_message() const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
 }
-inline void RoomResponse::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.error_message)
 }
-#if LANG_CXX11
-inline void RoomResponse::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.RoomResponse.error_message)
+inline std::string* RoomResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.error_message)
+  return _s;
 }
-#endif
-inline void RoomResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.RoomResponse.error_message)
+inline const std::string& RoomResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
 }
-inline void RoomResponse::set_error_message(const char* value, size_t size) {
+inline void RoomResponse::_internal_set_error_message(const std::string& value) {
   
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.RoomResponse.error_message)
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* RoomResponse::mutable_error_message() {
+inline std::string* RoomResponse::_internal_mutable_error_message() {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* RoomResponse::release_error_message() {
+inline std::string* RoomResponse::release_error_message() {
   // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.error_message_.Release();
 }
-inline void RoomResponse::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
+inline void RoomResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
     
   } else {
     
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.error_message)
 }
 
 // .sanguosha.RoomInfo room_info = 3;
+inline bool RoomResponse::_internal_has_room_info() const {
+  return this != internal_default_instance() && _impl_.room_info_ != nullptr;
+}
 inline bool RoomResponse::has_room_info() const {
-  return this != internal_default_instance() && room_info_ != NULL;
+  return _internal_has_room_info();
 }
 inline void RoomResponse::clear_room_info() {
-  if (GetArenaNoVirtual() == NULL && room_info_ != NULL) {
-    delete room_info_;
+  if (GetArenaForAllocation() == nullptr && _impl_.room_info_ != nullptr) {
+    delete _impl_.room_info_;
   }
-  room_info_ = NULL;
+  _impl_.room_info_ = nullptr;
 }
 inline const ::sanguosha::RoomInfo& RoomResponse::_internal_room_info() const {
-  return *room_info_;
+  const ::sanguosha::RoomInfo* p = _impl_.room_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sanguosha::RoomInfo&>(
+      ::sanguosha::_RoomInfo_default_instance_);
 }
 inline const ::sanguosha::RoomInfo& RoomResponse::room_info() const {
-  const ::sanguosha::RoomInfo* p = room_info_;
   // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.room_info)
-  return p != NULL ? *p : *reinterpret_cast<const ::sanguosha::RoomInfo*>(
-      &::sanguosha::_RoomInfo_default_instance_);
+  return _internal_room_info();
+}
+inline void RoomResponse::unsafe_arena_set_allocated_room_info(
+    ::sanguosha::RoomInfo* room_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_info_);
+  }
+  _impl_.room_info_ = room_info;
+  if (room_info) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.RoomResponse.room_info)
 }
 inline ::sanguosha::RoomInfo* RoomResponse::release_room_info() {
+  
+  ::sanguosha::RoomInfo* temp = _impl_.room_info_;
+  _impl_.room_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sanguosha::RoomInfo* RoomResponse::unsafe_arena_release_room_info() {
   // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.room_info)
   
-  ::sanguosha::RoomInfo* temp = room_info_;
-  room_info_ = NULL;
+  ::sanguosha::RoomInfo* temp = _impl_.room_info_;
+  _impl_.room_info_ = nullptr;
   return temp;
 }
-inline ::sanguosha::RoomInfo* RoomResponse::mutable_room_info() {
+inline ::sanguosha::RoomInfo* RoomResponse::_internal_mutable_room_info() {
   
-  if (room_info_ == NULL) {
-    auto* p = CreateMaybeMessage<::sanguosha::RoomInfo>(GetArenaNoVirtual());
-    room_info_ = p;
+  if (_impl_.room_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sanguosha::RoomInfo>(GetArenaForAllocation());
+    _impl_.room_info_ = p;
   }
+  return _impl_.room_info_;
+}
+inline ::sanguosha::RoomInfo* RoomResponse::mutable_room_info() {
+  ::sanguosha::RoomInfo* _msg = _internal_mutable_room_info();
   // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.room_info)
-  return room_info_;
+  return _msg;
 }
 inline void RoomResponse::set_allocated_room_info(::sanguosha::RoomInfo* room_info) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete room_info_;
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_info_;
   }
   if (room_info) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_info);
     if (message_arena != submessage_arena) {
-      room_info = ::google::protobuf::internal::GetOwnedMessage(
+      room_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, room_info, submessage_arena);
     }
     
   } else {
     
   }
-  room_info_ = room_info;
+  _impl_.room_info_ = room_info;
   // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.room_info)
 }
 
@@ -2451,33 +4492,43 @@ inline void RoomResponse::set_allocated_room_info(::sanguosha::RoomInfo* room_in
 // RoomListResponse
 
 // repeated .sanguosha.RoomInfo rooms = 1;
+inline int RoomListResponse::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
 inline int RoomListResponse::rooms_size() const {
-  return rooms_.size();
+  return _internal_rooms_size();
 }
 inline void RoomListResponse::clear_rooms() {
-  rooms_.Clear();
+  _impl_.rooms_.Clear();
 }
 inline ::sanguosha::RoomInfo* RoomListResponse::mutable_rooms(int index) {
   // @@protoc_insertion_point(field_mutable:sanguosha.RoomListResponse.rooms)
-  return rooms_.Mutable(index);
+  return _impl_.rooms_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >*
 RoomListResponse::mutable_rooms() {
   // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomListResponse.rooms)
-  return &rooms_;
+  return &_impl_.rooms_;
+}
+inline const ::sanguosha::RoomInfo& RoomListResponse::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
 }
 inline const ::sanguosha::RoomInfo& RoomListResponse::rooms(int index) const {
   // @@protoc_insertion_point(field_get:sanguosha.RoomListResponse.rooms)
-  return rooms_.Get(index);
+  return _internal_rooms(index);
+}
+inline ::sanguosha::RoomInfo* RoomListResponse::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
 }
 inline ::sanguosha::RoomInfo* RoomListResponse::add_rooms() {
+  ::sanguosha::RoomInfo* _add = _internal_add_rooms();
   // @@protoc_insertion_point(field_add:sanguosha.RoomListResponse.rooms)
-  return rooms_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >&
 RoomListResponse::rooms() const {
   // @@protoc_insertion_point(field_list:sanguosha.RoomListResponse.rooms)
-  return rooms_;
+  return _impl_.rooms_;
 }
 
 // -------------------------------------------------------------------
@@ -2486,173 +4537,243 @@ RoomListResponse::rooms() const {
 
 // .sanguosha.ActionType type = 1;
 inline void GameAction::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::sanguosha::ActionType GameAction::_internal_type() const {
+  return static_cast< ::sanguosha::ActionType >(_impl_.type_);
 }
 inline ::sanguosha::ActionType GameAction::type() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameAction.type)
-  return static_cast< ::sanguosha::ActionType >(type_);
+  return _internal_type();
 }
-inline void GameAction::set_type(::sanguosha::ActionType value) {
+inline void GameAction::_internal_set_type(::sanguosha::ActionType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void GameAction::set_type(::sanguosha::ActionType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameAction.type)
 }
 
 // uint32 card_id = 2;
 inline void GameAction::clear_card_id() {
-  card_id_ = 0u;
+  _impl_.card_id_ = 0u;
 }
-inline ::google::protobuf::uint32 GameAction::card_id() const {
+inline uint32_t GameAction::_internal_card_id() const {
+  return _impl_.card_id_;
+}
+inline uint32_t GameAction::card_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameAction.card_id)
-  return card_id_;
+  return _internal_card_id();
 }
-inline void GameAction::set_card_id(::google::protobuf::uint32 value) {
+inline void GameAction::_internal_set_card_id(uint32_t value) {
   
-  card_id_ = value;
+  _impl_.card_id_ = value;
+}
+inline void GameAction::set_card_id(uint32_t value) {
+  _internal_set_card_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameAction.card_id)
 }
 
 // uint32 target_player = 3;
 inline void GameAction::clear_target_player() {
-  target_player_ = 0u;
+  _impl_.target_player_ = 0u;
 }
-inline ::google::protobuf::uint32 GameAction::target_player() const {
+inline uint32_t GameAction::_internal_target_player() const {
+  return _impl_.target_player_;
+}
+inline uint32_t GameAction::target_player() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameAction.target_player)
-  return target_player_;
+  return _internal_target_player();
 }
-inline void GameAction::set_target_player(::google::protobuf::uint32 value) {
+inline void GameAction::_internal_set_target_player(uint32_t value) {
   
-  target_player_ = value;
+  _impl_.target_player_ = value;
+}
+inline void GameAction::set_target_player(uint32_t value) {
+  _internal_set_target_player(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameAction.target_player)
 }
 
+// uint32 sequence = 4;
+inline void GameAction::clear_sequence() {
+  _impl_.sequence_ = 0u;
+}
+inline uint32_t GameAction::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint32_t GameAction::sequence() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameAction.sequence)
+  return _internal_sequence();
+}
+inline void GameAction::_internal_set_sequence(uint32_t value) {
+  
+  _impl_.sequence_ = value;
+}
+inline void GameAction::set_sequence(uint32_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameAction.sequence)
+}
+
 // -------------------------------------------------------------------
 
 // PlayerState
 
 // uint32 player_id = 1;
 inline void PlayerState::clear_player_id() {
-  player_id_ = 0u;
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t PlayerState::_internal_player_id() const {
+  return _impl_.player_id_;
 }
-inline ::google::protobuf::uint32 PlayerState::player_id() const {
+inline uint32_t PlayerState::player_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.PlayerState.player_id)
-  return player_id_;
+  return _internal_player_id();
 }
-inline void PlayerState::set_player_id(::google::protobuf::uint32 value) {
+inline void PlayerState::_internal_set_player_id(uint32_t value) {
   
-  player_id_ = value;
+  _impl_.player_id_ = value;
+}
+inline void PlayerState::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.PlayerState.player_id)
 }
 
 // string username = 2;
 inline void PlayerState::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.username_.ClearToEmpty();
 }
-inline const ::std::string& PlayerState::username() const {
+inline const std::string& PlayerState::username() const {
   // @@protoc_insertion_point(field_get:sanguosha.PlayerState.username)
-  return username_.GetNoArena();
+  return _internal_username();
 }
-inline void PlayerState::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerState::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.PlayerState.username)
 }
-#if LANG_CXX11
-inline void PlayerState::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.PlayerState.username)
+inline std::string* PlayerState::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:sanguosha.PlayerState.username)
+  return _s;
 }
-#endif
-inline void PlayerState::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.PlayerState.username)
+inline const std::string& PlayerState::_internal_username() const {
+  return _impl_.username_.Get();
 }
-inline void PlayerState::set_username(const char* value, size_t size) {
+inline void PlayerState::_internal_set_username(const std::string& value) {
   
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.PlayerState.username)
+  _impl_.username_.Set(value, GetArenaForAllocation());
 }
-inline ::std::string* PlayerState::mutable_username() {
+inline std::string* PlayerState::_internal_mutable_username() {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.PlayerState.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* PlayerState::release_username() {
+inline std::string* PlayerState::release_username() {
   // @@protoc_insertion_point(field_release:sanguosha.PlayerState.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  return _impl_.username_.Release();
 }
-inline void PlayerState::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
+inline void PlayerState::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
     
   } else {
     
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:sanguosha.PlayerState.username)
 }
 
 // uint32 hp = 3;
 inline void PlayerState::clear_hp() {
-  hp_ = 0u;
+  _impl_.hp_ = 0u;
+}
+inline uint32_t PlayerState::_internal_hp() const {
+  return _impl_.hp_;
 }
-inline ::google::protobuf::uint32 PlayerState::hp() const {
+inline uint32_t PlayerState::hp() const {
   // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hp)
-  return hp_;
+  return _internal_hp();
 }
-inline void PlayerState::set_hp(::google::protobuf::uint32 value) {
+inline void PlayerState::_internal_set_hp(uint32_t value) {
   
-  hp_ = value;
+  _impl_.hp_ = value;
+}
+inline void PlayerState::set_hp(uint32_t value) {
+  _internal_set_hp(value);
   // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hp)
 }
 
 // uint32 max_hp = 4;
 inline void PlayerState::clear_max_hp() {
-  max_hp_ = 0u;
+  _impl_.max_hp_ = 0u;
+}
+inline uint32_t PlayerState::_internal_max_hp() const {
+  return _impl_.max_hp_;
 }
-inline ::google::protobuf::uint32 PlayerState::max_hp() const {
+inline uint32_t PlayerState::max_hp() const {
   // @@protoc_insertion_point(field_get:sanguosha.PlayerState.max_hp)
-  return max_hp_;
+  return _internal_max_hp();
 }
-inline void PlayerState::set_max_hp(::google::protobuf::uint32 value) {
+inline void PlayerState::_internal_set_max_hp(uint32_t value) {
   
-  max_hp_ = value;
+  _impl_.max_hp_ = value;
+}
+inline void PlayerState::set_max_hp(uint32_t value) {
+  _internal_set_max_hp(value);
   // @@protoc_insertion_point(field_set:sanguosha.PlayerState.max_hp)
 }
 
 // repeated uint32 hand_cards = 5;
+inline int PlayerState::_internal_hand_cards_size() const {
+  return _impl_.hand_cards_.size();
+}
 inline int PlayerState::hand_cards_size() const {
-  return hand_cards_.size();
+  return _internal_hand_cards_size();
 }
 inline void PlayerState::clear_hand_cards() {
-  hand_cards_.Clear();
+  _impl_.hand_cards_.Clear();
 }
-inline ::google::protobuf::uint32 PlayerState::hand_cards(int index) const {
+inline uint32_t PlayerState::_internal_hand_cards(int index) const {
+  return _impl_.hand_cards_.Get(index);
+}
+inline uint32_t PlayerState::hand_cards(int index) const {
   // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hand_cards)
-  return hand_cards_.Get(index);
+  return _internal_hand_cards(index);
 }
-inline void PlayerState::set_hand_cards(int index, ::google::protobuf::uint32 value) {
-  hand_cards_.Set(index, value);
+inline void PlayerState::set_hand_cards(int index, uint32_t value) {
+  _impl_.hand_cards_.Set(index, value);
   // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hand_cards)
 }
-inline void PlayerState::add_hand_cards(::google::protobuf::uint32 value) {
-  hand_cards_.Add(value);
+inline void PlayerState::_internal_add_hand_cards(uint32_t value) {
+  _impl_.hand_cards_.Add(value);
+}
+inline void PlayerState::add_hand_cards(uint32_t value) {
+  _internal_add_hand_cards(value);
   // @@protoc_insertion_point(field_add:sanguosha.PlayerState.hand_cards)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PlayerState::_internal_hand_cards() const {
+  return _impl_.hand_cards_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 PlayerState::hand_cards() const {
   // @@protoc_insertion_point(field_list:sanguosha.PlayerState.hand_cards)
-  return hand_cards_;
+  return _internal_hand_cards();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PlayerState::_internal_mutable_hand_cards() {
+  return &_impl_.hand_cards_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 PlayerState::mutable_hand_cards() {
   // @@protoc_insertion_point(field_mutable_list:sanguosha.PlayerState.hand_cards)
-  return &hand_cards_;
+  return _internal_mutable_hand_cards();
 }
 
 // -------------------------------------------------------------------
@@ -2661,113 +4782,668 @@ PlayerState::mutable_hand_cards() {
 
 // uint32 current_player = 1;
 inline void GameState::clear_current_player() {
-  current_player_ = 0u;
+  _impl_.current_player_ = 0u;
 }
-inline ::google::protobuf::uint32 GameState::current_player() const {
+inline uint32_t GameState::_internal_current_player() const {
+  return _impl_.current_player_;
+}
+inline uint32_t GameState::current_player() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameState.current_player)
-  return current_player_;
+  return _internal_current_player();
 }
-inline void GameState::set_current_player(::google::protobuf::uint32 value) {
+inline void GameState::_internal_set_current_player(uint32_t value) {
   
-  current_player_ = value;
+  _impl_.current_player_ = value;
+}
+inline void GameState::set_current_player(uint32_t value) {
+  _internal_set_current_player(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameState.current_player)
 }
 
 // repeated .sanguosha.PlayerState players = 2;
+inline int GameState::_internal_players_size() const {
+  return _impl_.players_.size();
+}
 inline int GameState::players_size() const {
-  return players_.size();
+  return _internal_players_size();
 }
 inline void GameState::clear_players() {
-  players_.Clear();
+  _impl_.players_.Clear();
 }
 inline ::sanguosha::PlayerState* GameState::mutable_players(int index) {
   // @@protoc_insertion_point(field_mutable:sanguosha.GameState.players)
-  return players_.Mutable(index);
+  return _impl_.players_.Mutable(index);
 }
-inline ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
 GameState::mutable_players() {
   // @@protoc_insertion_point(field_mutable_list:sanguosha.GameState.players)
-  return &players_;
+  return &_impl_.players_;
+}
+inline const ::sanguosha::PlayerState& GameState::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
 }
 inline const ::sanguosha::PlayerState& GameState::players(int index) const {
   // @@protoc_insertion_point(field_get:sanguosha.GameState.players)
-  return players_.Get(index);
+  return _internal_players(index);
+}
+inline ::sanguosha::PlayerState* GameState::_internal_add_players() {
+  return _impl_.players_.Add();
 }
 inline ::sanguosha::PlayerState* GameState::add_players() {
+  ::sanguosha::PlayerState* _add = _internal_add_players();
   // @@protoc_insertion_point(field_add:sanguosha.GameState.players)
-  return players_.Add();
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
 GameState::players() const {
   // @@protoc_insertion_point(field_list:sanguosha.GameState.players)
-  return players_;
+  return _impl_.players_;
 }
 
 // .sanguosha.GamePhase phase = 3;
 inline void GameState::clear_phase() {
-  phase_ = 0;
+  _impl_.phase_ = 0;
+}
+inline ::sanguosha::GamePhase GameState::_internal_phase() const {
+  return static_cast< ::sanguosha::GamePhase >(_impl_.phase_);
 }
 inline ::sanguosha::GamePhase GameState::phase() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameState.phase)
-  return static_cast< ::sanguosha::GamePhase >(phase_);
+  return _internal_phase();
 }
-inline void GameState::set_phase(::sanguosha::GamePhase value) {
+inline void GameState::_internal_set_phase(::sanguosha::GamePhase value) {
   
-  phase_ = value;
+  _impl_.phase_ = value;
+}
+inline void GameState::set_phase(::sanguosha::GamePhase value) {
+  _internal_set_phase(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameState.phase)
 }
 
 // string game_log = 4;
 inline void GameState::clear_game_log() {
-  game_log_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.game_log_.ClearToEmpty();
 }
-inline const ::std::string& GameState::game_log() const {
+inline const std::string& GameState::game_log() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameState.game_log)
-  return game_log_.GetNoArena();
+  return _internal_game_log();
 }
-inline void GameState::set_game_log(const ::std::string& value) {
-  
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameState::set_game_log(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.game_log_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:sanguosha.GameState.game_log)
 }
-#if LANG_CXX11
-inline void GameState::set_game_log(::std::string&& value) {
+inline std::string* GameState::mutable_game_log() {
+  std::string* _s = _internal_mutable_game_log();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.game_log)
+  return _s;
+}
+inline const std::string& GameState::_internal_game_log() const {
+  return _impl_.game_log_.Get();
+}
+inline void GameState::_internal_set_game_log(const std::string& value) {
   
-  game_log_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.GameState.game_log)
+  _impl_.game_log_.Set(value, GetArenaForAllocation());
 }
-#endif
-inline void GameState::set_game_log(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
+inline std::string* GameState::_internal_mutable_game_log() {
+  
+  return _impl_.game_log_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameState::release_game_log() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameState.game_log)
+  return _impl_.game_log_.Release();
+}
+inline void GameState::set_allocated_game_log(std::string* game_log) {
+  if (game_log != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.game_log_.SetAllocated(game_log, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_log_.IsDefault()) {
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameState.game_log)
+}
+
+// uint64 version = 5;
+inline void GameState::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t GameState::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t GameState::version() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.version)
+  return _internal_version();
+}
+inline void GameState::_internal_set_version(uint64_t value) {
   
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.GameState.game_log)
+  _impl_.version_ = value;
+}
+inline void GameState::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.version)
 }
-inline void GameState::set_game_log(const char* value, size_t size) {
+
+// uint32 acked_sequence = 6;
+inline void GameState::clear_acked_sequence() {
+  _impl_.acked_sequence_ = 0u;
+}
+inline uint32_t GameState::_internal_acked_sequence() const {
+  return _impl_.acked_sequence_;
+}
+inline uint32_t GameState::acked_sequence() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.acked_sequence)
+  return _internal_acked_sequence();
+}
+inline void GameState::_internal_set_acked_sequence(uint32_t value) {
   
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.GameState.game_log)
+  _impl_.acked_sequence_ = value;
+}
+inline void GameState::set_acked_sequence(uint32_t value) {
+  _internal_set_acked_sequence(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.acked_sequence)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerStateDelta
+
+// uint32 player_id = 1;
+inline void PlayerStateDelta::clear_player_id() {
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t PlayerStateDelta::_internal_player_id() const {
+  return _impl_.player_id_;
 }
-inline ::std::string* GameState::mutable_game_log() {
+inline uint32_t PlayerStateDelta::player_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.player_id)
+  return _internal_player_id();
+}
+inline void PlayerStateDelta::_internal_set_player_id(uint32_t value) {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.game_log)
-  return game_log_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.player_id_ = value;
 }
-inline ::std::string* GameState::release_game_log() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameState.game_log)
+inline void PlayerStateDelta::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.player_id)
+}
+
+// optional string username = 2;
+inline bool PlayerStateDelta::_internal_has_username() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PlayerStateDelta::has_username() const {
+  return _internal_has_username();
+}
+inline void PlayerStateDelta::clear_username() {
+  _impl_.username_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PlayerStateDelta::username() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerStateDelta::set_username(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.username)
+}
+inline std::string* PlayerStateDelta::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:sanguosha.PlayerStateDelta.username)
+  return _s;
+}
+inline const std::string& PlayerStateDelta::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PlayerStateDelta::_internal_set_username(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayerStateDelta::_internal_mutable_username() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayerStateDelta::release_username() {
+  // @@protoc_insertion_point(field_release:sanguosha.PlayerStateDelta.username)
+  if (!_internal_has_username()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.username_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PlayerStateDelta::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.PlayerStateDelta.username)
+}
+
+// optional uint32 hp = 3;
+inline bool PlayerStateDelta::_internal_has_hp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PlayerStateDelta::has_hp() const {
+  return _internal_has_hp();
+}
+inline void PlayerStateDelta::clear_hp() {
+  _impl_.hp_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t PlayerStateDelta::_internal_hp() const {
+  return _impl_.hp_;
+}
+inline uint32_t PlayerStateDelta::hp() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.hp)
+  return _internal_hp();
+}
+inline void PlayerStateDelta::_internal_set_hp(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hp_ = value;
+}
+inline void PlayerStateDelta::set_hp(uint32_t value) {
+  _internal_set_hp(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.hp)
+}
+
+// optional uint32 max_hp = 4;
+inline bool PlayerStateDelta::_internal_has_max_hp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PlayerStateDelta::has_max_hp() const {
+  return _internal_has_max_hp();
+}
+inline void PlayerStateDelta::clear_max_hp() {
+  _impl_.max_hp_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t PlayerStateDelta::_internal_max_hp() const {
+  return _impl_.max_hp_;
+}
+inline uint32_t PlayerStateDelta::max_hp() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.max_hp)
+  return _internal_max_hp();
+}
+inline void PlayerStateDelta::_internal_set_max_hp(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.max_hp_ = value;
+}
+inline void PlayerStateDelta::set_max_hp(uint32_t value) {
+  _internal_set_max_hp(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.max_hp)
+}
+
+// bool hand_cards_changed = 5;
+inline void PlayerStateDelta::clear_hand_cards_changed() {
+  _impl_.hand_cards_changed_ = false;
+}
+inline bool PlayerStateDelta::_internal_hand_cards_changed() const {
+  return _impl_.hand_cards_changed_;
+}
+inline bool PlayerStateDelta::hand_cards_changed() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.hand_cards_changed)
+  return _internal_hand_cards_changed();
+}
+inline void PlayerStateDelta::_internal_set_hand_cards_changed(bool value) {
+  
+  _impl_.hand_cards_changed_ = value;
+}
+inline void PlayerStateDelta::set_hand_cards_changed(bool value) {
+  _internal_set_hand_cards_changed(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.hand_cards_changed)
+}
+
+// repeated uint32 hand_cards = 6;
+inline int PlayerStateDelta::_internal_hand_cards_size() const {
+  return _impl_.hand_cards_.size();
+}
+inline int PlayerStateDelta::hand_cards_size() const {
+  return _internal_hand_cards_size();
+}
+inline void PlayerStateDelta::clear_hand_cards() {
+  _impl_.hand_cards_.Clear();
+}
+inline uint32_t PlayerStateDelta::_internal_hand_cards(int index) const {
+  return _impl_.hand_cards_.Get(index);
+}
+inline uint32_t PlayerStateDelta::hand_cards(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerStateDelta.hand_cards)
+  return _internal_hand_cards(index);
+}
+inline void PlayerStateDelta::set_hand_cards(int index, uint32_t value) {
+  _impl_.hand_cards_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerStateDelta.hand_cards)
+}
+inline void PlayerStateDelta::_internal_add_hand_cards(uint32_t value) {
+  _impl_.hand_cards_.Add(value);
+}
+inline void PlayerStateDelta::add_hand_cards(uint32_t value) {
+  _internal_add_hand_cards(value);
+  // @@protoc_insertion_point(field_add:sanguosha.PlayerStateDelta.hand_cards)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PlayerStateDelta::_internal_hand_cards() const {
+  return _impl_.hand_cards_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PlayerStateDelta::hand_cards() const {
+  // @@protoc_insertion_point(field_list:sanguosha.PlayerStateDelta.hand_cards)
+  return _internal_hand_cards();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PlayerStateDelta::_internal_mutable_hand_cards() {
+  return &_impl_.hand_cards_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PlayerStateDelta::mutable_hand_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.PlayerStateDelta.hand_cards)
+  return _internal_mutable_hand_cards();
+}
+
+// -------------------------------------------------------------------
+
+// GameStateDelta
+
+// uint64 base_version = 1;
+inline void GameStateDelta::clear_base_version() {
+  _impl_.base_version_ = uint64_t{0u};
+}
+inline uint64_t GameStateDelta::_internal_base_version() const {
+  return _impl_.base_version_;
+}
+inline uint64_t GameStateDelta::base_version() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.base_version)
+  return _internal_base_version();
+}
+inline void GameStateDelta::_internal_set_base_version(uint64_t value) {
+  
+  _impl_.base_version_ = value;
+}
+inline void GameStateDelta::set_base_version(uint64_t value) {
+  _internal_set_base_version(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.base_version)
+}
+
+// uint64 version = 2;
+inline void GameStateDelta::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t GameStateDelta::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t GameStateDelta::version() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.version)
+  return _internal_version();
+}
+inline void GameStateDelta::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void GameStateDelta::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.version)
+}
+
+// optional uint32 current_player = 3;
+inline bool GameStateDelta::_internal_has_current_player() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GameStateDelta::has_current_player() const {
+  return _internal_has_current_player();
+}
+inline void GameStateDelta::clear_current_player() {
+  _impl_.current_player_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t GameStateDelta::_internal_current_player() const {
+  return _impl_.current_player_;
+}
+inline uint32_t GameStateDelta::current_player() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.current_player)
+  return _internal_current_player();
+}
+inline void GameStateDelta::_internal_set_current_player(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.current_player_ = value;
+}
+inline void GameStateDelta::set_current_player(uint32_t value) {
+  _internal_set_current_player(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.current_player)
+}
+
+// optional .sanguosha.GamePhase phase = 4;
+inline bool GameStateDelta::_internal_has_phase() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GameStateDelta::has_phase() const {
+  return _internal_has_phase();
+}
+inline void GameStateDelta::clear_phase() {
+  _impl_.phase_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::sanguosha::GamePhase GameStateDelta::_internal_phase() const {
+  return static_cast< ::sanguosha::GamePhase >(_impl_.phase_);
+}
+inline ::sanguosha::GamePhase GameStateDelta::phase() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.phase)
+  return _internal_phase();
+}
+inline void GameStateDelta::_internal_set_phase(::sanguosha::GamePhase value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.phase_ = value;
+}
+inline void GameStateDelta::set_phase(::sanguosha::GamePhase value) {
+  _internal_set_phase(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.phase)
+}
+
+// repeated .sanguosha.PlayerStateDelta players = 5;
+inline int GameStateDelta::_internal_players_size() const {
+  return _impl_.players_.size();
+}
+inline int GameStateDelta::players_size() const {
+  return _internal_players_size();
+}
+inline void GameStateDelta::clear_players() {
+  _impl_.players_.Clear();
+}
+inline ::sanguosha::PlayerStateDelta* GameStateDelta::mutable_players(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameStateDelta.players)
+  return _impl_.players_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerStateDelta >*
+GameStateDelta::mutable_players() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameStateDelta.players)
+  return &_impl_.players_;
+}
+inline const ::sanguosha::PlayerStateDelta& GameStateDelta::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
+}
+inline const ::sanguosha::PlayerStateDelta& GameStateDelta::players(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.players)
+  return _internal_players(index);
+}
+inline ::sanguosha::PlayerStateDelta* GameStateDelta::_internal_add_players() {
+  return _impl_.players_.Add();
+}
+inline ::sanguosha::PlayerStateDelta* GameStateDelta::add_players() {
+  ::sanguosha::PlayerStateDelta* _add = _internal_add_players();
+  // @@protoc_insertion_point(field_add:sanguosha.GameStateDelta.players)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerStateDelta >&
+GameStateDelta::players() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameStateDelta.players)
+  return _impl_.players_;
+}
+
+// repeated uint32 removed_players = 6;
+inline int GameStateDelta::_internal_removed_players_size() const {
+  return _impl_.removed_players_.size();
+}
+inline int GameStateDelta::removed_players_size() const {
+  return _internal_removed_players_size();
+}
+inline void GameStateDelta::clear_removed_players() {
+  _impl_.removed_players_.Clear();
+}
+inline uint32_t GameStateDelta::_internal_removed_players(int index) const {
+  return _impl_.removed_players_.Get(index);
+}
+inline uint32_t GameStateDelta::removed_players(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.removed_players)
+  return _internal_removed_players(index);
+}
+inline void GameStateDelta::set_removed_players(int index, uint32_t value) {
+  _impl_.removed_players_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.removed_players)
+}
+inline void GameStateDelta::_internal_add_removed_players(uint32_t value) {
+  _impl_.removed_players_.Add(value);
+}
+inline void GameStateDelta::add_removed_players(uint32_t value) {
+  _internal_add_removed_players(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameStateDelta.removed_players)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameStateDelta::_internal_removed_players() const {
+  return _impl_.removed_players_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameStateDelta::removed_players() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameStateDelta.removed_players)
+  return _internal_removed_players();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameStateDelta::_internal_mutable_removed_players() {
+  return &_impl_.removed_players_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameStateDelta::mutable_removed_players() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameStateDelta.removed_players)
+  return _internal_mutable_removed_players();
+}
+
+// string game_log = 7;
+inline void GameStateDelta::clear_game_log() {
+  _impl_.game_log_.ClearToEmpty();
+}
+inline const std::string& GameStateDelta::game_log() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.game_log)
+  return _internal_game_log();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameStateDelta::set_game_log(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.game_log_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.game_log)
+}
+inline std::string* GameStateDelta::mutable_game_log() {
+  std::string* _s = _internal_mutable_game_log();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameStateDelta.game_log)
+  return _s;
+}
+inline const std::string& GameStateDelta::_internal_game_log() const {
+  return _impl_.game_log_.Get();
+}
+inline void GameStateDelta::_internal_set_game_log(const std::string& value) {
   
-  return game_log_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.game_log_.Set(value, GetArenaForAllocation());
 }
-inline void GameState::set_allocated_game_log(::std::string* game_log) {
-  if (game_log != NULL) {
+inline std::string* GameStateDelta::_internal_mutable_game_log() {
+  
+  return _impl_.game_log_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameStateDelta::release_game_log() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameStateDelta.game_log)
+  return _impl_.game_log_.Release();
+}
+inline void GameStateDelta::set_allocated_game_log(std::string* game_log) {
+  if (game_log != nullptr) {
     
   } else {
     
   }
-  game_log_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), game_log);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameState.game_log)
+  _impl_.game_log_.SetAllocated(game_log, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_log_.IsDefault()) {
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameStateDelta.game_log)
+}
+
+// uint32 acked_sequence = 8;
+inline void GameStateDelta::clear_acked_sequence() {
+  _impl_.acked_sequence_ = 0u;
+}
+inline uint32_t GameStateDelta::_internal_acked_sequence() const {
+  return _impl_.acked_sequence_;
+}
+inline uint32_t GameStateDelta::acked_sequence() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateDelta.acked_sequence)
+  return _internal_acked_sequence();
+}
+inline void GameStateDelta::_internal_set_acked_sequence(uint32_t value) {
+  
+  _impl_.acked_sequence_ = value;
+}
+inline void GameStateDelta::set_acked_sequence(uint32_t value) {
+  _internal_set_acked_sequence(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateDelta.acked_sequence)
+}
+
+// -------------------------------------------------------------------
+
+// GameStateRequest
+
+// uint64 known_version = 1;
+inline void GameStateRequest::clear_known_version() {
+  _impl_.known_version_ = uint64_t{0u};
+}
+inline uint64_t GameStateRequest::_internal_known_version() const {
+  return _impl_.known_version_;
+}
+inline uint64_t GameStateRequest::known_version() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStateRequest.known_version)
+  return _internal_known_version();
+}
+inline void GameStateRequest::_internal_set_known_version(uint64_t value) {
+  
+  _impl_.known_version_ = value;
+}
+inline void GameStateRequest::set_known_version(uint64_t value) {
+  _internal_set_known_version(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStateRequest.known_version)
 }
 
 // -------------------------------------------------------------------
@@ -2776,46 +5452,113 @@ inline void GameState::set_allocated_game_log(::std::string* game_log) {
 
 // uint32 room_id = 1;
 inline void GameStart::clear_room_id() {
-  room_id_ = 0u;
+  _impl_.room_id_ = 0u;
 }
-inline ::google::protobuf::uint32 GameStart::room_id() const {
+inline uint32_t GameStart::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t GameStart::room_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameStart.room_id)
-  return room_id_;
+  return _internal_room_id();
 }
-inline void GameStart::set_room_id(::google::protobuf::uint32 value) {
+inline void GameStart::_internal_set_room_id(uint32_t value) {
   
-  room_id_ = value;
+  _impl_.room_id_ = value;
+}
+inline void GameStart::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameStart.room_id)
 }
 
 // repeated uint32 player_ids = 2;
+inline int GameStart::_internal_player_ids_size() const {
+  return _impl_.player_ids_.size();
+}
 inline int GameStart::player_ids_size() const {
-  return player_ids_.size();
+  return _internal_player_ids_size();
 }
 inline void GameStart::clear_player_ids() {
-  player_ids_.Clear();
+  _impl_.player_ids_.Clear();
+}
+inline uint32_t GameStart::_internal_player_ids(int index) const {
+  return _impl_.player_ids_.Get(index);
 }
-inline ::google::protobuf::uint32 GameStart::player_ids(int index) const {
+inline uint32_t GameStart::player_ids(int index) const {
   // @@protoc_insertion_point(field_get:sanguosha.GameStart.player_ids)
-  return player_ids_.Get(index);
+  return _internal_player_ids(index);
 }
-inline void GameStart::set_player_ids(int index, ::google::protobuf::uint32 value) {
-  player_ids_.Set(index, value);
+inline void GameStart::set_player_ids(int index, uint32_t value) {
+  _impl_.player_ids_.Set(index, value);
   // @@protoc_insertion_point(field_set:sanguosha.GameStart.player_ids)
 }
-inline void GameStart::add_player_ids(::google::protobuf::uint32 value) {
-  player_ids_.Add(value);
+inline void GameStart::_internal_add_player_ids(uint32_t value) {
+  _impl_.player_ids_.Add(value);
+}
+inline void GameStart::add_player_ids(uint32_t value) {
+  _internal_add_player_ids(value);
   // @@protoc_insertion_point(field_add:sanguosha.GameStart.player_ids)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameStart::_internal_player_ids() const {
+  return _impl_.player_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
 GameStart::player_ids() const {
   // @@protoc_insertion_point(field_list:sanguosha.GameStart.player_ids)
-  return player_ids_;
+  return _internal_player_ids();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameStart::_internal_mutable_player_ids() {
+  return &_impl_.player_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
 GameStart::mutable_player_ids() {
   // @@protoc_insertion_point(field_mutable_list:sanguosha.GameStart.player_ids)
-  return &player_ids_;
+  return _internal_mutable_player_ids();
+}
+
+// -------------------------------------------------------------------
+
+// MessageBatch
+
+// repeated .sanguosha.GameMessage messages = 1;
+inline int MessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int MessageBatch::messages_size() const {
+  return _internal_messages_size();
+}
+inline void MessageBatch::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::sanguosha::GameMessage* MessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.MessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >*
+MessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.MessageBatch.messages)
+  return &_impl_.messages_;
+}
+inline const ::sanguosha::GameMessage& MessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::sanguosha::GameMessage& MessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.MessageBatch.messages)
+  return _internal_messages(index);
+}
+inline ::sanguosha::GameMessage* MessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::sanguosha::GameMessage* MessageBatch::add_messages() {
+  ::sanguosha::GameMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:sanguosha.MessageBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >&
+MessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:sanguosha.MessageBatch.messages)
+  return _impl_.messages_;
 }
 
 // -------------------------------------------------------------------
@@ -2824,466 +5567,994 @@ GameStart::mutable_player_ids() {
 
 // .sanguosha.MessageType type = 1;
 inline void GameMessage::clear_type() {
-  type_ = 0;
+  _impl_.type_ = 0;
+}
+inline ::sanguosha::MessageType GameMessage::_internal_type() const {
+  return static_cast< ::sanguosha::MessageType >(_impl_.type_);
 }
 inline ::sanguosha::MessageType GameMessage::type() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.type)
-  return static_cast< ::sanguosha::MessageType >(type_);
+  return _internal_type();
 }
-inline void GameMessage::set_type(::sanguosha::MessageType value) {
+inline void GameMessage::_internal_set_type(::sanguosha::MessageType value) {
   
-  type_ = value;
+  _impl_.type_ = value;
+}
+inline void GameMessage::set_type(::sanguosha::MessageType value) {
+  _internal_set_type(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameMessage.type)
 }
 
 // .sanguosha.LoginRequest login_request = 2;
-inline bool GameMessage::has_login_request() const {
+inline bool GameMessage::_internal_has_login_request() const {
   return content_case() == kLoginRequest;
 }
+inline bool GameMessage::has_login_request() const {
+  return _internal_has_login_request();
+}
 inline void GameMessage::set_has_login_request() {
-  _oneof_case_[0] = kLoginRequest;
+  _impl_._oneof_case_[0] = kLoginRequest;
 }
 inline void GameMessage::clear_login_request() {
-  if (has_login_request()) {
-    delete content_.login_request_;
+  if (_internal_has_login_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.login_request_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::LoginRequest& GameMessage::_internal_login_request() const {
-  return *content_.login_request_;
-}
 inline ::sanguosha::LoginRequest* GameMessage::release_login_request() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_request)
-  if (has_login_request()) {
+  if (_internal_has_login_request()) {
     clear_has_content();
-      ::sanguosha::LoginRequest* temp = content_.login_request_;
-    content_.login_request_ = NULL;
+    ::sanguosha::LoginRequest* temp = _impl_.content_.login_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.login_request_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::LoginRequest& GameMessage::_internal_login_request() const {
+  return _internal_has_login_request()
+      ? *_impl_.content_.login_request_
+      : reinterpret_cast< ::sanguosha::LoginRequest&>(::sanguosha::_LoginRequest_default_instance_);
+}
 inline const ::sanguosha::LoginRequest& GameMessage::login_request() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_request)
-  return has_login_request()
-      ? *content_.login_request_
-      : *reinterpret_cast< ::sanguosha::LoginRequest*>(&::sanguosha::_LoginRequest_default_instance_);
+  return _internal_login_request();
 }
-inline ::sanguosha::LoginRequest* GameMessage::mutable_login_request() {
-  if (!has_login_request()) {
+inline ::sanguosha::LoginRequest* GameMessage::unsafe_arena_release_login_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.login_request)
+  if (_internal_has_login_request()) {
+    clear_has_content();
+    ::sanguosha::LoginRequest* temp = _impl_.content_.login_request_;
+    _impl_.content_.login_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_login_request(::sanguosha::LoginRequest* login_request) {
+  clear_content();
+  if (login_request) {
+    set_has_login_request();
+    _impl_.content_.login_request_ = login_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.login_request)
+}
+inline ::sanguosha::LoginRequest* GameMessage::_internal_mutable_login_request() {
+  if (!_internal_has_login_request()) {
     clear_content();
     set_has_login_request();
-    content_.login_request_ = CreateMaybeMessage< ::sanguosha::LoginRequest >(
-        GetArenaNoVirtual());
+    _impl_.content_.login_request_ = CreateMaybeMessage< ::sanguosha::LoginRequest >(GetArenaForAllocation());
   }
+  return _impl_.content_.login_request_;
+}
+inline ::sanguosha::LoginRequest* GameMessage::mutable_login_request() {
+  ::sanguosha::LoginRequest* _msg = _internal_mutable_login_request();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_request)
-  return content_.login_request_;
+  return _msg;
 }
 
 // .sanguosha.LoginResponse login_response = 3;
-inline bool GameMessage::has_login_response() const {
+inline bool GameMessage::_internal_has_login_response() const {
   return content_case() == kLoginResponse;
 }
+inline bool GameMessage::has_login_response() const {
+  return _internal_has_login_response();
+}
 inline void GameMessage::set_has_login_response() {
-  _oneof_case_[0] = kLoginResponse;
+  _impl_._oneof_case_[0] = kLoginResponse;
 }
 inline void GameMessage::clear_login_response() {
-  if (has_login_response()) {
-    delete content_.login_response_;
+  if (_internal_has_login_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.login_response_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::LoginResponse& GameMessage::_internal_login_response() const {
-  return *content_.login_response_;
-}
 inline ::sanguosha::LoginResponse* GameMessage::release_login_response() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_response)
-  if (has_login_response()) {
+  if (_internal_has_login_response()) {
     clear_has_content();
-      ::sanguosha::LoginResponse* temp = content_.login_response_;
-    content_.login_response_ = NULL;
+    ::sanguosha::LoginResponse* temp = _impl_.content_.login_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.login_response_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::LoginResponse& GameMessage::_internal_login_response() const {
+  return _internal_has_login_response()
+      ? *_impl_.content_.login_response_
+      : reinterpret_cast< ::sanguosha::LoginResponse&>(::sanguosha::_LoginResponse_default_instance_);
+}
 inline const ::sanguosha::LoginResponse& GameMessage::login_response() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_response)
-  return has_login_response()
-      ? *content_.login_response_
-      : *reinterpret_cast< ::sanguosha::LoginResponse*>(&::sanguosha::_LoginResponse_default_instance_);
+  return _internal_login_response();
+}
+inline ::sanguosha::LoginResponse* GameMessage::unsafe_arena_release_login_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.login_response)
+  if (_internal_has_login_response()) {
+    clear_has_content();
+    ::sanguosha::LoginResponse* temp = _impl_.content_.login_response_;
+    _impl_.content_.login_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_login_response(::sanguosha::LoginResponse* login_response) {
+  clear_content();
+  if (login_response) {
+    set_has_login_response();
+    _impl_.content_.login_response_ = login_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.login_response)
 }
-inline ::sanguosha::LoginResponse* GameMessage::mutable_login_response() {
-  if (!has_login_response()) {
+inline ::sanguosha::LoginResponse* GameMessage::_internal_mutable_login_response() {
+  if (!_internal_has_login_response()) {
     clear_content();
     set_has_login_response();
-    content_.login_response_ = CreateMaybeMessage< ::sanguosha::LoginResponse >(
-        GetArenaNoVirtual());
+    _impl_.content_.login_response_ = CreateMaybeMessage< ::sanguosha::LoginResponse >(GetArenaForAllocation());
   }
+  return _impl_.content_.login_response_;
+}
+inline ::sanguosha::LoginResponse* GameMessage::mutable_login_response() {
+  ::sanguosha::LoginResponse* _msg = _internal_mutable_login_response();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_response)
-  return content_.login_response_;
+  return _msg;
 }
 
 // .sanguosha.Heartbeat heartbeat = 4;
-inline bool GameMessage::has_heartbeat() const {
+inline bool GameMessage::_internal_has_heartbeat() const {
   return content_case() == kHeartbeat;
 }
+inline bool GameMessage::has_heartbeat() const {
+  return _internal_has_heartbeat();
+}
 inline void GameMessage::set_has_heartbeat() {
-  _oneof_case_[0] = kHeartbeat;
+  _impl_._oneof_case_[0] = kHeartbeat;
 }
 inline void GameMessage::clear_heartbeat() {
-  if (has_heartbeat()) {
-    delete content_.heartbeat_;
+  if (_internal_has_heartbeat()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.heartbeat_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::Heartbeat& GameMessage::_internal_heartbeat() const {
-  return *content_.heartbeat_;
-}
 inline ::sanguosha::Heartbeat* GameMessage::release_heartbeat() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.heartbeat)
-  if (has_heartbeat()) {
+  if (_internal_has_heartbeat()) {
     clear_has_content();
-      ::sanguosha::Heartbeat* temp = content_.heartbeat_;
-    content_.heartbeat_ = NULL;
+    ::sanguosha::Heartbeat* temp = _impl_.content_.heartbeat_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.heartbeat_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::Heartbeat& GameMessage::_internal_heartbeat() const {
+  return _internal_has_heartbeat()
+      ? *_impl_.content_.heartbeat_
+      : reinterpret_cast< ::sanguosha::Heartbeat&>(::sanguosha::_Heartbeat_default_instance_);
+}
 inline const ::sanguosha::Heartbeat& GameMessage::heartbeat() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.heartbeat)
-  return has_heartbeat()
-      ? *content_.heartbeat_
-      : *reinterpret_cast< ::sanguosha::Heartbeat*>(&::sanguosha::_Heartbeat_default_instance_);
+  return _internal_heartbeat();
 }
-inline ::sanguosha::Heartbeat* GameMessage::mutable_heartbeat() {
-  if (!has_heartbeat()) {
+inline ::sanguosha::Heartbeat* GameMessage::unsafe_arena_release_heartbeat() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_content();
+    ::sanguosha::Heartbeat* temp = _impl_.content_.heartbeat_;
+    _impl_.content_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_heartbeat(::sanguosha::Heartbeat* heartbeat) {
+  clear_content();
+  if (heartbeat) {
+    set_has_heartbeat();
+    _impl_.content_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.heartbeat)
+}
+inline ::sanguosha::Heartbeat* GameMessage::_internal_mutable_heartbeat() {
+  if (!_internal_has_heartbeat()) {
     clear_content();
     set_has_heartbeat();
-    content_.heartbeat_ = CreateMaybeMessage< ::sanguosha::Heartbeat >(
-        GetArenaNoVirtual());
+    _impl_.content_.heartbeat_ = CreateMaybeMessage< ::sanguosha::Heartbeat >(GetArenaForAllocation());
   }
+  return _impl_.content_.heartbeat_;
+}
+inline ::sanguosha::Heartbeat* GameMessage::mutable_heartbeat() {
+  ::sanguosha::Heartbeat* _msg = _internal_mutable_heartbeat();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.heartbeat)
-  return content_.heartbeat_;
+  return _msg;
 }
 
 // .sanguosha.RoomRequest room_request = 5;
-inline bool GameMessage::has_room_request() const {
+inline bool GameMessage::_internal_has_room_request() const {
   return content_case() == kRoomRequest;
 }
+inline bool GameMessage::has_room_request() const {
+  return _internal_has_room_request();
+}
 inline void GameMessage::set_has_room_request() {
-  _oneof_case_[0] = kRoomRequest;
+  _impl_._oneof_case_[0] = kRoomRequest;
 }
 inline void GameMessage::clear_room_request() {
-  if (has_room_request()) {
-    delete content_.room_request_;
+  if (_internal_has_room_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_request_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::RoomRequest& GameMessage::_internal_room_request() const {
-  return *content_.room_request_;
-}
 inline ::sanguosha::RoomRequest* GameMessage::release_room_request() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_request)
-  if (has_room_request()) {
+  if (_internal_has_room_request()) {
     clear_has_content();
-      ::sanguosha::RoomRequest* temp = content_.room_request_;
-    content_.room_request_ = NULL;
+    ::sanguosha::RoomRequest* temp = _impl_.content_.room_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_request_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::RoomRequest& GameMessage::_internal_room_request() const {
+  return _internal_has_room_request()
+      ? *_impl_.content_.room_request_
+      : reinterpret_cast< ::sanguosha::RoomRequest&>(::sanguosha::_RoomRequest_default_instance_);
+}
 inline const ::sanguosha::RoomRequest& GameMessage::room_request() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_request)
-  return has_room_request()
-      ? *content_.room_request_
-      : *reinterpret_cast< ::sanguosha::RoomRequest*>(&::sanguosha::_RoomRequest_default_instance_);
+  return _internal_room_request();
 }
-inline ::sanguosha::RoomRequest* GameMessage::mutable_room_request() {
-  if (!has_room_request()) {
+inline ::sanguosha::RoomRequest* GameMessage::unsafe_arena_release_room_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_request)
+  if (_internal_has_room_request()) {
+    clear_has_content();
+    ::sanguosha::RoomRequest* temp = _impl_.content_.room_request_;
+    _impl_.content_.room_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_room_request(::sanguosha::RoomRequest* room_request) {
+  clear_content();
+  if (room_request) {
+    set_has_room_request();
+    _impl_.content_.room_request_ = room_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_request)
+}
+inline ::sanguosha::RoomRequest* GameMessage::_internal_mutable_room_request() {
+  if (!_internal_has_room_request()) {
     clear_content();
     set_has_room_request();
-    content_.room_request_ = CreateMaybeMessage< ::sanguosha::RoomRequest >(
-        GetArenaNoVirtual());
+    _impl_.content_.room_request_ = CreateMaybeMessage< ::sanguosha::RoomRequest >(GetArenaForAllocation());
   }
+  return _impl_.content_.room_request_;
+}
+inline ::sanguosha::RoomRequest* GameMessage::mutable_room_request() {
+  ::sanguosha::RoomRequest* _msg = _internal_mutable_room_request();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_request)
-  return content_.room_request_;
+  return _msg;
 }
 
 // .sanguosha.RoomResponse room_response = 6;
-inline bool GameMessage::has_room_response() const {
+inline bool GameMessage::_internal_has_room_response() const {
   return content_case() == kRoomResponse;
 }
+inline bool GameMessage::has_room_response() const {
+  return _internal_has_room_response();
+}
 inline void GameMessage::set_has_room_response() {
-  _oneof_case_[0] = kRoomResponse;
+  _impl_._oneof_case_[0] = kRoomResponse;
 }
 inline void GameMessage::clear_room_response() {
-  if (has_room_response()) {
-    delete content_.room_response_;
+  if (_internal_has_room_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_response_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::RoomResponse& GameMessage::_internal_room_response() const {
-  return *content_.room_response_;
-}
 inline ::sanguosha::RoomResponse* GameMessage::release_room_response() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_response)
-  if (has_room_response()) {
+  if (_internal_has_room_response()) {
     clear_has_content();
-      ::sanguosha::RoomResponse* temp = content_.room_response_;
-    content_.room_response_ = NULL;
+    ::sanguosha::RoomResponse* temp = _impl_.content_.room_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_response_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::RoomResponse& GameMessage::_internal_room_response() const {
+  return _internal_has_room_response()
+      ? *_impl_.content_.room_response_
+      : reinterpret_cast< ::sanguosha::RoomResponse&>(::sanguosha::_RoomResponse_default_instance_);
+}
 inline const ::sanguosha::RoomResponse& GameMessage::room_response() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_response)
-  return has_room_response()
-      ? *content_.room_response_
-      : *reinterpret_cast< ::sanguosha::RoomResponse*>(&::sanguosha::_RoomResponse_default_instance_);
+  return _internal_room_response();
 }
-inline ::sanguosha::RoomResponse* GameMessage::mutable_room_response() {
-  if (!has_room_response()) {
+inline ::sanguosha::RoomResponse* GameMessage::unsafe_arena_release_room_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_response)
+  if (_internal_has_room_response()) {
+    clear_has_content();
+    ::sanguosha::RoomResponse* temp = _impl_.content_.room_response_;
+    _impl_.content_.room_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_room_response(::sanguosha::RoomResponse* room_response) {
+  clear_content();
+  if (room_response) {
+    set_has_room_response();
+    _impl_.content_.room_response_ = room_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_response)
+}
+inline ::sanguosha::RoomResponse* GameMessage::_internal_mutable_room_response() {
+  if (!_internal_has_room_response()) {
     clear_content();
     set_has_room_response();
-    content_.room_response_ = CreateMaybeMessage< ::sanguosha::RoomResponse >(
-        GetArenaNoVirtual());
+    _impl_.content_.room_response_ = CreateMaybeMessage< ::sanguosha::RoomResponse >(GetArenaForAllocation());
   }
+  return _impl_.content_.room_response_;
+}
+inline ::sanguosha::RoomResponse* GameMessage::mutable_room_response() {
+  ::sanguosha::RoomResponse* _msg = _internal_mutable_room_response();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_response)
-  return content_.room_response_;
+  return _msg;
 }
 
 // .sanguosha.GameAction game_action = 7;
-inline bool GameMessage::has_game_action() const {
+inline bool GameMessage::_internal_has_game_action() const {
   return content_case() == kGameAction;
 }
+inline bool GameMessage::has_game_action() const {
+  return _internal_has_game_action();
+}
 inline void GameMessage::set_has_game_action() {
-  _oneof_case_[0] = kGameAction;
+  _impl_._oneof_case_[0] = kGameAction;
 }
 inline void GameMessage::clear_game_action() {
-  if (has_game_action()) {
-    delete content_.game_action_;
+  if (_internal_has_game_action()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_action_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::GameAction& GameMessage::_internal_game_action() const {
-  return *content_.game_action_;
-}
 inline ::sanguosha::GameAction* GameMessage::release_game_action() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_action)
-  if (has_game_action()) {
+  if (_internal_has_game_action()) {
     clear_has_content();
-      ::sanguosha::GameAction* temp = content_.game_action_;
-    content_.game_action_ = NULL;
+    ::sanguosha::GameAction* temp = _impl_.content_.game_action_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_action_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::GameAction& GameMessage::_internal_game_action() const {
+  return _internal_has_game_action()
+      ? *_impl_.content_.game_action_
+      : reinterpret_cast< ::sanguosha::GameAction&>(::sanguosha::_GameAction_default_instance_);
+}
 inline const ::sanguosha::GameAction& GameMessage::game_action() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_action)
-  return has_game_action()
-      ? *content_.game_action_
-      : *reinterpret_cast< ::sanguosha::GameAction*>(&::sanguosha::_GameAction_default_instance_);
+  return _internal_game_action();
 }
-inline ::sanguosha::GameAction* GameMessage::mutable_game_action() {
-  if (!has_game_action()) {
+inline ::sanguosha::GameAction* GameMessage::unsafe_arena_release_game_action() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_action)
+  if (_internal_has_game_action()) {
+    clear_has_content();
+    ::sanguosha::GameAction* temp = _impl_.content_.game_action_;
+    _impl_.content_.game_action_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_action(::sanguosha::GameAction* game_action) {
+  clear_content();
+  if (game_action) {
+    set_has_game_action();
+    _impl_.content_.game_action_ = game_action;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_action)
+}
+inline ::sanguosha::GameAction* GameMessage::_internal_mutable_game_action() {
+  if (!_internal_has_game_action()) {
     clear_content();
     set_has_game_action();
-    content_.game_action_ = CreateMaybeMessage< ::sanguosha::GameAction >(
-        GetArenaNoVirtual());
+    _impl_.content_.game_action_ = CreateMaybeMessage< ::sanguosha::GameAction >(GetArenaForAllocation());
   }
+  return _impl_.content_.game_action_;
+}
+inline ::sanguosha::GameAction* GameMessage::mutable_game_action() {
+  ::sanguosha::GameAction* _msg = _internal_mutable_game_action();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_action)
-  return content_.game_action_;
+  return _msg;
 }
 
 // .sanguosha.GameState game_state = 8;
-inline bool GameMessage::has_game_state() const {
+inline bool GameMessage::_internal_has_game_state() const {
   return content_case() == kGameState;
 }
+inline bool GameMessage::has_game_state() const {
+  return _internal_has_game_state();
+}
 inline void GameMessage::set_has_game_state() {
-  _oneof_case_[0] = kGameState;
+  _impl_._oneof_case_[0] = kGameState;
 }
 inline void GameMessage::clear_game_state() {
-  if (has_game_state()) {
-    delete content_.game_state_;
+  if (_internal_has_game_state()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_state_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::GameState& GameMessage::_internal_game_state() const {
-  return *content_.game_state_;
-}
 inline ::sanguosha::GameState* GameMessage::release_game_state() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_state)
-  if (has_game_state()) {
+  if (_internal_has_game_state()) {
     clear_has_content();
-      ::sanguosha::GameState* temp = content_.game_state_;
-    content_.game_state_ = NULL;
+    ::sanguosha::GameState* temp = _impl_.content_.game_state_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_state_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::GameState& GameMessage::_internal_game_state() const {
+  return _internal_has_game_state()
+      ? *_impl_.content_.game_state_
+      : reinterpret_cast< ::sanguosha::GameState&>(::sanguosha::_GameState_default_instance_);
+}
 inline const ::sanguosha::GameState& GameMessage::game_state() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_state)
-  return has_game_state()
-      ? *content_.game_state_
-      : *reinterpret_cast< ::sanguosha::GameState*>(&::sanguosha::_GameState_default_instance_);
+  return _internal_game_state();
 }
-inline ::sanguosha::GameState* GameMessage::mutable_game_state() {
-  if (!has_game_state()) {
+inline ::sanguosha::GameState* GameMessage::unsafe_arena_release_game_state() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_state)
+  if (_internal_has_game_state()) {
+    clear_has_content();
+    ::sanguosha::GameState* temp = _impl_.content_.game_state_;
+    _impl_.content_.game_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_state(::sanguosha::GameState* game_state) {
+  clear_content();
+  if (game_state) {
+    set_has_game_state();
+    _impl_.content_.game_state_ = game_state;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_state)
+}
+inline ::sanguosha::GameState* GameMessage::_internal_mutable_game_state() {
+  if (!_internal_has_game_state()) {
     clear_content();
     set_has_game_state();
-    content_.game_state_ = CreateMaybeMessage< ::sanguosha::GameState >(
-        GetArenaNoVirtual());
+    _impl_.content_.game_state_ = CreateMaybeMessage< ::sanguosha::GameState >(GetArenaForAllocation());
   }
+  return _impl_.content_.game_state_;
+}
+inline ::sanguosha::GameState* GameMessage::mutable_game_state() {
+  ::sanguosha::GameState* _msg = _internal_mutable_game_state();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_state)
-  return content_.game_state_;
+  return _msg;
 }
 
 // .sanguosha.GameStart game_start = 9;
-inline bool GameMessage::has_game_start() const {
+inline bool GameMessage::_internal_has_game_start() const {
   return content_case() == kGameStart;
 }
+inline bool GameMessage::has_game_start() const {
+  return _internal_has_game_start();
+}
 inline void GameMessage::set_has_game_start() {
-  _oneof_case_[0] = kGameStart;
+  _impl_._oneof_case_[0] = kGameStart;
 }
 inline void GameMessage::clear_game_start() {
-  if (has_game_start()) {
-    delete content_.game_start_;
+  if (_internal_has_game_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_start_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::GameStart& GameMessage::_internal_game_start() const {
-  return *content_.game_start_;
-}
 inline ::sanguosha::GameStart* GameMessage::release_game_start() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_start)
-  if (has_game_start()) {
+  if (_internal_has_game_start()) {
     clear_has_content();
-      ::sanguosha::GameStart* temp = content_.game_start_;
-    content_.game_start_ = NULL;
+    ::sanguosha::GameStart* temp = _impl_.content_.game_start_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_start_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::GameStart& GameMessage::_internal_game_start() const {
+  return _internal_has_game_start()
+      ? *_impl_.content_.game_start_
+      : reinterpret_cast< ::sanguosha::GameStart&>(::sanguosha::_GameStart_default_instance_);
+}
 inline const ::sanguosha::GameStart& GameMessage::game_start() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_start)
-  return has_game_start()
-      ? *content_.game_start_
-      : *reinterpret_cast< ::sanguosha::GameStart*>(&::sanguosha::_GameStart_default_instance_);
+  return _internal_game_start();
 }
-inline ::sanguosha::GameStart* GameMessage::mutable_game_start() {
-  if (!has_game_start()) {
+inline ::sanguosha::GameStart* GameMessage::unsafe_arena_release_game_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_start)
+  if (_internal_has_game_start()) {
+    clear_has_content();
+    ::sanguosha::GameStart* temp = _impl_.content_.game_start_;
+    _impl_.content_.game_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_start(::sanguosha::GameStart* game_start) {
+  clear_content();
+  if (game_start) {
+    set_has_game_start();
+    _impl_.content_.game_start_ = game_start;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_start)
+}
+inline ::sanguosha::GameStart* GameMessage::_internal_mutable_game_start() {
+  if (!_internal_has_game_start()) {
     clear_content();
     set_has_game_start();
-    content_.game_start_ = CreateMaybeMessage< ::sanguosha::GameStart >(
-        GetArenaNoVirtual());
+    _impl_.content_.game_start_ = CreateMaybeMessage< ::sanguosha::GameStart >(GetArenaForAllocation());
   }
+  return _impl_.content_.game_start_;
+}
+inline ::sanguosha::GameStart* GameMessage::mutable_game_start() {
+  ::sanguosha::GameStart* _msg = _internal_mutable_game_start();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_start)
-  return content_.game_start_;
+  return _msg;
 }
 
 // .sanguosha.GameOver game_over = 10;
-inline bool GameMessage::has_game_over() const {
+inline bool GameMessage::_internal_has_game_over() const {
   return content_case() == kGameOver;
 }
+inline bool GameMessage::has_game_over() const {
+  return _internal_has_game_over();
+}
 inline void GameMessage::set_has_game_over() {
-  _oneof_case_[0] = kGameOver;
+  _impl_._oneof_case_[0] = kGameOver;
 }
 inline void GameMessage::clear_game_over() {
-  if (has_game_over()) {
-    delete content_.game_over_;
+  if (_internal_has_game_over()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_over_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::GameOver& GameMessage::_internal_game_over() const {
-  return *content_.game_over_;
-}
 inline ::sanguosha::GameOver* GameMessage::release_game_over() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_over)
-  if (has_game_over()) {
+  if (_internal_has_game_over()) {
     clear_has_content();
-      ::sanguosha::GameOver* temp = content_.game_over_;
-    content_.game_over_ = NULL;
+    ::sanguosha::GameOver* temp = _impl_.content_.game_over_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_over_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::GameOver& GameMessage::_internal_game_over() const {
+  return _internal_has_game_over()
+      ? *_impl_.content_.game_over_
+      : reinterpret_cast< ::sanguosha::GameOver&>(::sanguosha::_GameOver_default_instance_);
+}
 inline const ::sanguosha::GameOver& GameMessage::game_over() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_over)
-  return has_game_over()
-      ? *content_.game_over_
-      : *reinterpret_cast< ::sanguosha::GameOver*>(&::sanguosha::_GameOver_default_instance_);
+  return _internal_game_over();
 }
-inline ::sanguosha::GameOver* GameMessage::mutable_game_over() {
-  if (!has_game_over()) {
+inline ::sanguosha::GameOver* GameMessage::unsafe_arena_release_game_over() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_over)
+  if (_internal_has_game_over()) {
+    clear_has_content();
+    ::sanguosha::GameOver* temp = _impl_.content_.game_over_;
+    _impl_.content_.game_over_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_over(::sanguosha::GameOver* game_over) {
+  clear_content();
+  if (game_over) {
+    set_has_game_over();
+    _impl_.content_.game_over_ = game_over;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_over)
+}
+inline ::sanguosha::GameOver* GameMessage::_internal_mutable_game_over() {
+  if (!_internal_has_game_over()) {
     clear_content();
     set_has_game_over();
-    content_.game_over_ = CreateMaybeMessage< ::sanguosha::GameOver >(
-        GetArenaNoVirtual());
+    _impl_.content_.game_over_ = CreateMaybeMessage< ::sanguosha::GameOver >(GetArenaForAllocation());
   }
+  return _impl_.content_.game_over_;
+}
+inline ::sanguosha::GameOver* GameMessage::mutable_game_over() {
+  ::sanguosha::GameOver* _msg = _internal_mutable_game_over();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_over)
-  return content_.game_over_;
+  return _msg;
+}
+
+// .sanguosha.GameStateDelta game_state_delta = 11;
+inline bool GameMessage::_internal_has_game_state_delta() const {
+  return content_case() == kGameStateDelta;
+}
+inline bool GameMessage::has_game_state_delta() const {
+  return _internal_has_game_state_delta();
+}
+inline void GameMessage::set_has_game_state_delta() {
+  _impl_._oneof_case_[0] = kGameStateDelta;
+}
+inline void GameMessage::clear_game_state_delta() {
+  if (_internal_has_game_state_delta()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_state_delta_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameStateDelta* GameMessage::release_game_state_delta() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_state_delta)
+  if (_internal_has_game_state_delta()) {
+    clear_has_content();
+    ::sanguosha::GameStateDelta* temp = _impl_.content_.game_state_delta_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_state_delta_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameStateDelta& GameMessage::_internal_game_state_delta() const {
+  return _internal_has_game_state_delta()
+      ? *_impl_.content_.game_state_delta_
+      : reinterpret_cast< ::sanguosha::GameStateDelta&>(::sanguosha::_GameStateDelta_default_instance_);
+}
+inline const ::sanguosha::GameStateDelta& GameMessage::game_state_delta() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_state_delta)
+  return _internal_game_state_delta();
+}
+inline ::sanguosha::GameStateDelta* GameMessage::unsafe_arena_release_game_state_delta() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_state_delta)
+  if (_internal_has_game_state_delta()) {
+    clear_has_content();
+    ::sanguosha::GameStateDelta* temp = _impl_.content_.game_state_delta_;
+    _impl_.content_.game_state_delta_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_state_delta(::sanguosha::GameStateDelta* game_state_delta) {
+  clear_content();
+  if (game_state_delta) {
+    set_has_game_state_delta();
+    _impl_.content_.game_state_delta_ = game_state_delta;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_state_delta)
+}
+inline ::sanguosha::GameStateDelta* GameMessage::_internal_mutable_game_state_delta() {
+  if (!_internal_has_game_state_delta()) {
+    clear_content();
+    set_has_game_state_delta();
+    _impl_.content_.game_state_delta_ = CreateMaybeMessage< ::sanguosha::GameStateDelta >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_state_delta_;
+}
+inline ::sanguosha::GameStateDelta* GameMessage::mutable_game_state_delta() {
+  ::sanguosha::GameStateDelta* _msg = _internal_mutable_game_state_delta();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_state_delta)
+  return _msg;
+}
+
+// .sanguosha.GameStateRequest game_state_request = 12;
+inline bool GameMessage::_internal_has_game_state_request() const {
+  return content_case() == kGameStateRequest;
+}
+inline bool GameMessage::has_game_state_request() const {
+  return _internal_has_game_state_request();
+}
+inline void GameMessage::set_has_game_state_request() {
+  _impl_._oneof_case_[0] = kGameStateRequest;
+}
+inline void GameMessage::clear_game_state_request() {
+  if (_internal_has_game_state_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_state_request_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameStateRequest* GameMessage::release_game_state_request() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_state_request)
+  if (_internal_has_game_state_request()) {
+    clear_has_content();
+    ::sanguosha::GameStateRequest* temp = _impl_.content_.game_state_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameStateRequest& GameMessage::_internal_game_state_request() const {
+  return _internal_has_game_state_request()
+      ? *_impl_.content_.game_state_request_
+      : reinterpret_cast< ::sanguosha::GameStateRequest&>(::sanguosha::_GameStateRequest_default_instance_);
+}
+inline const ::sanguosha::GameStateRequest& GameMessage::game_state_request() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_state_request)
+  return _internal_game_state_request();
+}
+inline ::sanguosha::GameStateRequest* GameMessage::unsafe_arena_release_game_state_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_state_request)
+  if (_internal_has_game_state_request()) {
+    clear_has_content();
+    ::sanguosha::GameStateRequest* temp = _impl_.content_.game_state_request_;
+    _impl_.content_.game_state_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_state_request(::sanguosha::GameStateRequest* game_state_request) {
+  clear_content();
+  if (game_state_request) {
+    set_has_game_state_request();
+    _impl_.content_.game_state_request_ = game_state_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_state_request)
+}
+inline ::sanguosha::GameStateRequest* GameMessage::_internal_mutable_game_state_request() {
+  if (!_internal_has_game_state_request()) {
+    clear_content();
+    set_has_game_state_request();
+    _impl_.content_.game_state_request_ = CreateMaybeMessage< ::sanguosha::GameStateRequest >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_state_request_;
+}
+inline ::sanguosha::GameStateRequest* GameMessage::mutable_game_state_request() {
+  ::sanguosha::GameStateRequest* _msg = _internal_mutable_game_state_request();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_state_request)
+  return _msg;
 }
 
 // .sanguosha.RoomListResponse room_list_response = 14;
-inline bool GameMessage::has_room_list_response() const {
+inline bool GameMessage::_internal_has_room_list_response() const {
   return content_case() == kRoomListResponse;
 }
+inline bool GameMessage::has_room_list_response() const {
+  return _internal_has_room_list_response();
+}
 inline void GameMessage::set_has_room_list_response() {
-  _oneof_case_[0] = kRoomListResponse;
+  _impl_._oneof_case_[0] = kRoomListResponse;
 }
 inline void GameMessage::clear_room_list_response() {
-  if (has_room_list_response()) {
-    delete content_.room_list_response_;
+  if (_internal_has_room_list_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_list_response_;
+    }
     clear_has_content();
   }
 }
-inline const ::sanguosha::RoomListResponse& GameMessage::_internal_room_list_response() const {
-  return *content_.room_list_response_;
-}
 inline ::sanguosha::RoomListResponse* GameMessage::release_room_list_response() {
   // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_list_response)
-  if (has_room_list_response()) {
+  if (_internal_has_room_list_response()) {
     clear_has_content();
-      ::sanguosha::RoomListResponse* temp = content_.room_list_response_;
-    content_.room_list_response_ = NULL;
+    ::sanguosha::RoomListResponse* temp = _impl_.content_.room_list_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_list_response_ = nullptr;
     return temp;
   } else {
-    return NULL;
+    return nullptr;
   }
 }
+inline const ::sanguosha::RoomListResponse& GameMessage::_internal_room_list_response() const {
+  return _internal_has_room_list_response()
+      ? *_impl_.content_.room_list_response_
+      : reinterpret_cast< ::sanguosha::RoomListResponse&>(::sanguosha::_RoomListResponse_default_instance_);
+}
 inline const ::sanguosha::RoomListResponse& GameMessage::room_list_response() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_list_response)
-  return has_room_list_response()
-      ? *content_.room_list_response_
-      : *reinterpret_cast< ::sanguosha::RoomListResponse*>(&::sanguosha::_RoomListResponse_default_instance_);
+  return _internal_room_list_response();
 }
-inline ::sanguosha::RoomListResponse* GameMessage::mutable_room_list_response() {
-  if (!has_room_list_response()) {
+inline ::sanguosha::RoomListResponse* GameMessage::unsafe_arena_release_room_list_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_list_response)
+  if (_internal_has_room_list_response()) {
+    clear_has_content();
+    ::sanguosha::RoomListResponse* temp = _impl_.content_.room_list_response_;
+    _impl_.content_.room_list_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_room_list_response(::sanguosha::RoomListResponse* room_list_response) {
+  clear_content();
+  if (room_list_response) {
+    set_has_room_list_response();
+    _impl_.content_.room_list_response_ = room_list_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_list_response)
+}
+inline ::sanguosha::RoomListResponse* GameMessage::_internal_mutable_room_list_response() {
+  if (!_internal_has_room_list_response()) {
     clear_content();
     set_has_room_list_response();
-    content_.room_list_response_ = CreateMaybeMessage< ::sanguosha::RoomListResponse >(
-        GetArenaNoVirtual());
+    _impl_.content_.room_list_response_ = CreateMaybeMessage< ::sanguosha::RoomListResponse >(GetArenaForAllocation());
   }
+  return _impl_.content_.room_list_response_;
+}
+inline ::sanguosha::RoomListResponse* GameMessage::mutable_room_list_response() {
+  ::sanguosha::RoomListResponse* _msg = _internal_mutable_room_list_response();
   // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_list_response)
-  return content_.room_list_response_;
+  return _msg;
+}
+
+// .sanguosha.MessageBatch batch = 15;
+inline bool GameMessage::_internal_has_batch() const {
+  return content_case() == kBatch;
+}
+inline bool GameMessage::has_batch() const {
+  return _internal_has_batch();
+}
+inline void GameMessage::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
+}
+inline void GameMessage::clear_batch() {
+  if (_internal_has_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.batch_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::MessageBatch* GameMessage::release_batch() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.batch)
+  if (_internal_has_batch()) {
+    clear_has_content();
+    ::sanguosha::MessageBatch* temp = _impl_.content_.batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::MessageBatch& GameMessage::_internal_batch() const {
+  return _internal_has_batch()
+      ? *_impl_.content_.batch_
+      : reinterpret_cast< ::sanguosha::MessageBatch&>(::sanguosha::_MessageBatch_default_instance_);
+}
+inline const ::sanguosha::MessageBatch& GameMessage::batch() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.batch)
+  return _internal_batch();
+}
+inline ::sanguosha::MessageBatch* GameMessage::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.batch)
+  if (_internal_has_batch()) {
+    clear_has_content();
+    ::sanguosha::MessageBatch* temp = _impl_.content_.batch_;
+    _impl_.content_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_batch(::sanguosha::MessageBatch* batch) {
+  clear_content();
+  if (batch) {
+    set_has_batch();
+    _impl_.content_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.batch)
+}
+inline ::sanguosha::MessageBatch* GameMessage::_internal_mutable_batch() {
+  if (!_internal_has_batch()) {
+    clear_content();
+    set_has_batch();
+    _impl_.content_.batch_ = CreateMaybeMessage< ::sanguosha::MessageBatch >(GetArenaForAllocation());
+  }
+  return _impl_.content_.batch_;
+}
+inline ::sanguosha::MessageBatch* GameMessage::mutable_batch() {
+  ::sanguosha::MessageBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.batch)
+  return _msg;
 }
 
 inline bool GameMessage::has_content() const {
   return content_case() != CONTENT_NOT_SET;
 }
 inline void GameMessage::clear_has_content() {
-  _oneof_case_[0] = CONTENT_NOT_SET;
+  _impl_._oneof_case_[0] = CONTENT_NOT_SET;
 }
 inline GameMessage::ContentCase GameMessage::content_case() const {
-  return GameMessage::ContentCase(_oneof_case_[0]);
+  return GameMessage::ContentCase(_impl_._oneof_case_[0]);
 }
 // -------------------------------------------------------------------
 
@@ -3291,15 +6562,21 @@ inline GameMessage::ContentCase GameMessage::content_case() const {
 
 // uint32 winner_id = 1;
 inline void GameOver::clear_winner_id() {
-  winner_id_ = 0u;
+  _impl_.winner_id_ = 0u;
 }
-inline ::google::protobuf::uint32 GameOver::winner_id() const {
+inline uint32_t GameOver::_internal_winner_id() const {
+  return _impl_.winner_id_;
+}
+inline uint32_t GameOver::winner_id() const {
   // @@protoc_insertion_point(field_get:sanguosha.GameOver.winner_id)
-  return winner_id_;
+  return _internal_winner_id();
 }
-inline void GameOver::set_winner_id(::google::protobuf::uint32 value) {
+inline void GameOver::_internal_set_winner_id(uint32_t value) {
   
-  winner_id_ = value;
+  _impl_.winner_id_ = value;
+}
+inline void GameOver::set_winner_id(uint32_t value) {
+  _internal_set_winner_id(value);
   // @@protoc_insertion_point(field_set:sanguosha.GameOver.winner_id)
 }
 
@@ -3330,19 +6607,31 @@ inline void GameOver::set_winner_id(::google::protobuf::uint32 value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace sanguosha
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
 template <> struct is_proto_enum< ::sanguosha::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::MessageType>() {
   return ::sanguosha::MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::sanguosha::Capability> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::Capability>() {
+  return ::sanguosha::Capability_descriptor();
+}
 template <> struct is_proto_enum< ::sanguosha::RoomAction> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::RoomAction>() {
@@ -3369,9 +6658,9 @@ inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::ActionType>() {
   return ::sanguosha::ActionType_descriptor();
 }
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_sanguosha_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "actionpredictor.h"
+#include "clientgamestate.h"
+#include "testcheck.h"
+
+// 出牌预测的单元测试：确认、部分确认、修正回退、超时和序号回绕。
+namespace {
+const uint32_t kSelf = 1;
+const uint32_t kOpponent = 2;
+
+// 服务器发来的权威状态：自己持有 hand，双方体力分别为 selfHp / opponentHp
+sanguosha::GameState makeState(const std::vector<uint32_t>& hand, uint32_t selfHp, uint32_t opponentHp,
+                               uint32_t ackedSequence) {
+    sanguosha::GameState state;
+    state.set_current_player(kSelf);
+    state.set_phase(sanguosha::PLAY_PHASE);
+    state.set_acked_sequence(ackedSequence);
+
+    sanguosha::PlayerState* self = state.add_players();
+    self->set_player_id(kSelf);
+    self->set_hp(selfHp);
+    self->set_max_hp(4);
+    for (uint32_t card : hand) {
+        self->add_hand_cards(card);
+    }
+
+    sanguosha::PlayerState* opponent = state.add_players();
+    opponent->set_player_id(kOpponent);
+    opponent->set_hp(opponentHp);
+    opponent->set_max_hp(4);
+    opponent->add_hand_cards(sanguosha::CARD_DEFEND);
+    return state;
+}
+
+// 应用权威状态后与预测对账，和界面收到 GAME_STATE 时的顺序一致
+ActionPredictor::ReconcileResult applyAuthoritative(ActionPredictor& predictor, ClientGameState& client,
+                                                    const sanguosha::GameState& state, int64_t nowMs) {
+    client.applyState(state);
+    return predictor.reconcile(&client, state.acked_sequence(), nowMs);
+}
+
+size_t countCard(const ClientGameState& client, uint32_t cardId) {
+    return static_cast<size_t>(std::count(client.hand().begin(), client.hand().end(), cardId));
+}
+
+struct Fixture {
+    ActionPredictor predictor;
+    ClientGameState client;
+
+    Fixture() {
+        predictor.setEnabled(true);
+        client.setSelfId(kSelf);
+        client.applyState(makeState({ sanguosha::CARD_ATTACK, sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 4, 0));
+    }
+};
+
+void testDisabled() {
+    ActionPredictor predictor;
+    ClientGameState client;
+    client.setSelfId(kSelf);
+    client.applyState(makeState({ sanguosha::CARD_ATTACK }, 3, 4, 0));
+
+    CHECK(predictor.predictPlayCard(&client, sanguosha::CARD_ATTACK, kOpponent, 0) == 0);
+    CHECK(countCard(client, sanguosha::CARD_ATTACK) == 1);
+    CHECK(predictor.pendingCount() == 0);
+}
+
+void testInOrderAck() {
+    Fixture f;
+    uint32_t sequence = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_ATTACK, kOpponent, 0);
+    CHECK(sequence != 0);
+    // 预测立即生效：杀离开手牌，对方扣1点体力
+    CHECK(countCard(f.client, sanguosha::CARD_ATTACK) == 0);
+    CHECK(f.client.findPlayer(kOpponent)->hp == 3);
+    CHECK(f.client.findPlayer(kSelf)->handCardCount == 2);
+    CHECK(f.predictor.nextDeadlineMs() == f.predictor.timeoutMs());
+
+    ActionPredictor::ReconcileResult result = applyAuthoritative(
+        f.predictor, f.client, makeState({ sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 3, sequence), 100);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 0);
+    CHECK(f.predictor.nextDeadlineMs() == -1);
+    CHECK(f.predictor.correctionCount() == 0);
+}
+
+void testPartialAckReplaysPending() {
+    Fixture f;
+    uint32_t first = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_ATTACK, kOpponent, 0);
+    uint32_t second = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_HEAL, kSelf, 10);
+    CHECK(second != first);
+    CHECK(f.client.findPlayer(kSelf)->hp == 4);
+
+    // 服务器只处理了第一张牌，新状态里桃还在手里
+    ActionPredictor::ReconcileResult result = applyAuthoritative(
+        f.predictor, f.client,
+        makeState({ sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 3, first), 100);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 1);
+    // 未确认的桃重放到新的权威状态上
+    CHECK(countCard(f.client, sanguosha::CARD_HEAL) == 0);
+    CHECK(f.client.findPlayer(kSelf)->hp == 4);
+    CHECK(f.predictor.nextDeadlineMs() == 10 + f.predictor.timeoutMs());
+
+    result = applyAuthoritative(f.predictor, f.client, makeState({ sanguosha::CARD_DEFEND }, 4, 3, second), 200);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 0);
+}
+
+void testRollbackWithCorrection() {
+    Fixture f;
+    uint32_t sequence = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_ATTACK, kOpponent, 0);
+
+    // 服务器拒绝了出牌：杀回到手里，对方体力不变
+    ActionPredictor::ReconcileResult result = applyAuthoritative(
+        f.predictor, f.client,
+        makeState({ sanguosha::CARD_ATTACK, sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 4, sequence), 100);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 1);
+    CHECK(f.predictor.correctionCount() == 1);
+    CHECK(countCard(f.client, sanguosha::CARD_ATTACK) == 1);
+    CHECK(f.client.findPlayer(kOpponent)->hp == 4);
+
+    // 杀被闪抵消：牌已打出，但对方体力与预测不同
+    sequence = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_ATTACK, kOpponent, 200);
+    result = applyAuthoritative(
+        f.predictor, f.client,
+        makeState({ sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 4, sequence), 300);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 1);
+    CHECK(f.predictor.correctionCount() == 2);
+}
+
+void testTimeout() {
+    Fixture f;
+    const int64_t timeout = f.predictor.timeoutMs();
+    f.predictor.predictPlayCard(&f.client, sanguosha::CARD_ATTACK, kOpponent, 1000);
+    const sanguosha::GameState unchanged =
+        makeState({ sanguosha::CARD_ATTACK, sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 4, 0);
+
+    // 未到时限：仍在途中，重放后继续显示预测效果
+    ActionPredictor::ReconcileResult result = applyAuthoritative(f.predictor, f.client, unchanged, 1000 + timeout - 1);
+    CHECK(result.confirmed == 0);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 1);
+    CHECK(countCard(f.client, sanguosha::CARD_ATTACK) == 0);
+    CHECK(f.predictor.nextDeadlineMs() == 1000 + timeout);
+
+    // 到达时限：预测丢弃，界面回到权威状态
+    result = applyAuthoritative(f.predictor, f.client, unchanged, 1000 + timeout);
+    CHECK(result.confirmed == 0);
+    CHECK(result.corrected == 1);
+    CHECK(f.predictor.pendingCount() == 0);
+    CHECK(f.predictor.nextDeadlineMs() == -1);
+    CHECK(countCard(f.client, sanguosha::CARD_ATTACK) == 1);
+    CHECK(f.client.findPlayer(kOpponent)->hp == 4);
+}
+
+void testSequenceWrap() {
+    Fixture f;
+    f.predictor.setNextSequence(0xFFFFFFFFu);
+    uint32_t last = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_DEFEND, kOpponent, 0);
+    uint32_t wrapped = f.predictor.predictPlayCard(&f.client, sanguosha::CARD_HEAL, kSelf, 0);
+    CHECK(last == 0xFFFFFFFFu);
+    CHECK(wrapped == 1); // 0 保留给不需要确认的操作
+
+    // 确认回绕前的序号时，回绕后的序号仍算作未确认
+    ActionPredictor::ReconcileResult result = applyAuthoritative(
+        f.predictor, f.client, makeState({ sanguosha::CARD_ATTACK, sanguosha::CARD_HEAL }, 3, 4, last), 100);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 1);
+
+    result = applyAuthoritative(f.predictor, f.client, makeState({ sanguosha::CARD_ATTACK }, 4, 4, wrapped), 200);
+    CHECK(result.confirmed == 1);
+    CHECK(result.corrected == 0);
+    CHECK(f.predictor.pendingCount() == 0);
+}
+
+void testZeroAckConfirmsNothing() {
+    Fixture f;
+    f.predictor.setNextSequence(0x80000001u);
+    f.predictor.predictPlayCard(&f.client, sanguosha::CARD_DEFEND, kOpponent, 0);
+
+    // 0 表示服务器还没有处理过任何操作，即使按回绕比较它"晚于"待确认的序号
+    ActionPredictor::ReconcileResult result = applyAuthoritative(
+        f.predictor, f.client,
+        makeState({ sanguosha::CARD_ATTACK, sanguosha::CARD_HEAL, sanguosha::CARD_DEFEND }, 3, 4, 0), 100);
+    CHECK(result.confirmed == 0);
+    CHECK(f.predictor.pendingCount() == 1);
+}
+}
+
+int main()
+{
+    testDisabled();
+    testInOrderAck();
+    testPartialAckReplaysPending();
+    testRollbackWithCorrection();
+    testTimeout();
+    testSequenceWrap();
+    testZeroAckConfirmsNothing();
+    return testResult("actionpredictor_test");
+}
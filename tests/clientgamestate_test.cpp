@@ -0,0 +1,105 @@
+#include <cstdint>
+#include <vector>
+#include "clientgamestate.h"
+#include "testcheck.h"
+
+// 客户端对局状态存储的单元测试：按ID查找、座位变化和玩家数上限。
+namespace {
+sanguosha::GameState makeState(const std::vector<uint32_t>& playerIds) {
+    sanguosha::GameState state;
+    state.set_current_player(playerIds.empty() ? 0 : playerIds.front());
+    state.set_phase(sanguosha::PLAY_PHASE);
+    for (uint32_t id : playerIds) {
+        sanguosha::PlayerState* player = state.add_players();
+        player->set_player_id(id);
+        player->set_hp(id % 4 + 1);
+        player->set_max_hp(4);
+        player->add_hand_cards(sanguosha::CARD_ATTACK);
+    }
+    return state;
+}
+
+void testFindPlayerById() {
+    ClientGameState client;
+    client.setSelfId(1000003);
+    // 任意分布的用户ID，包括0和会在散列表中冲突的值
+    std::vector<uint32_t> ids = { 7, 1000003, 0, 23, 16, 0xFFFFFFFFu, 39, 55 };
+    client.applyState(makeState(ids));
+
+    CHECK(client.playerCount() == 8);
+    for (size_t seat = 0; seat < ids.size(); ++seat) {
+        const ClientPlayer* player = client.findPlayer(ids[seat]);
+        CHECK(player == &client.playerAt(static_cast<int>(seat)));
+        CHECK(player && player->hp == ids[seat] % 4 + 1);
+    }
+    CHECK(client.findPlayer(8) == nullptr);
+    CHECK(client.findPlayer(1000004) == nullptr);
+    CHECK(client.hand().size() == 1);
+    CHECK(client.firstOpponent() == 7);
+}
+
+void testSeatsChangeBetweenStates() {
+    ClientGameState client;
+    client.setSelfId(2);
+    client.applyState(makeState({ 1, 2, 3 }));
+    CHECK(client.findPlayer(3) != nullptr);
+
+    // 玩家离开、换座、新玩家加入后索引随之更新
+    client.applyState(makeState({ 4, 2 }));
+    CHECK(client.playerCount() == 2);
+    CHECK(client.findPlayer(1) == nullptr);
+    CHECK(client.findPlayer(3) == nullptr);
+    CHECK(client.findPlayer(4) == &client.playerAt(0));
+    CHECK(client.findPlayer(2) == &client.playerAt(1));
+
+    // 自己不在状态中时手牌清空
+    client.applyState(makeState({ 4, 5 }));
+    CHECK(client.findPlayer(2) == nullptr);
+    CHECK(client.hand().empty());
+}
+
+void testMutableLookupWritesThrough() {
+    ClientGameState client;
+    client.applyState(makeState({ 10, 20 }));
+    ClientPlayer* player = client.findPlayer(20);
+    CHECK(player != nullptr);
+    if (player) {
+        player->hp = 0;
+    }
+    CHECK(client.playerAt(1).hp == 0);
+    CHECK(client.anyPlayerDead());
+}
+
+void testPlayersBeyondCapIgnored() {
+    ClientGameState client;
+    std::vector<uint32_t> ids;
+    for (uint32_t id = 1; id <= ClientGameState::kMaxPlayers + 3; ++id) {
+        ids.push_back(id);
+    }
+    client.applyState(makeState(ids));
+    CHECK(client.playerCount() == ClientGameState::kMaxPlayers);
+    CHECK(client.findPlayer(ClientGameState::kMaxPlayers) != nullptr);
+    CHECK(client.findPlayer(ClientGameState::kMaxPlayers + 1) == nullptr);
+}
+
+void testReset() {
+    ClientGameState client;
+    client.setSelfId(1);
+    client.applyState(makeState({ 1, 2 }));
+    client.reset();
+    CHECK(!client.hasState());
+    CHECK(client.playerCount() == 0);
+    CHECK(client.findPlayer(1) == nullptr);
+    CHECK(client.findPlayer(2) == nullptr);
+}
+}
+
+int main()
+{
+    testFindPlayerById();
+    testSeatsChangeBetweenStates();
+    testMutableLookupWritesThrough();
+    testPlayersBeyondCapIgnored();
+    testReset();
+    return testResult("clientgamestate_test");
+}
@@ -0,0 +1,205 @@
+#include <cstdint>
+#include <string>
+#include "framedecoder.h"
+#include "testcheck.h"
+
+// 分帧解码器的单元测试，不依赖 Qt。
+namespace {
+// 4字节网络字节序长度前缀，compressed 时置最高位
+std::string encodeHeader(uint32_t bodySize, bool compressed = false) {
+    uint32_t header = bodySize | (compressed ? FrameDecoder::kCompressedFlag : 0u);
+    std::string bytes(FrameDecoder::kHeaderSize, '\0');
+    bytes[0] = static_cast<char>((header >> 24) & 0xff);
+    bytes[1] = static_cast<char>((header >> 16) & 0xff);
+    bytes[2] = static_cast<char>((header >> 8) & 0xff);
+    bytes[3] = static_cast<char>(header & 0xff);
+    return bytes;
+}
+
+std::string encodeFrame(const std::string& body, bool compressed = false) {
+    return encodeHeader(static_cast<uint32_t>(body.size()), compressed) + body;
+}
+
+std::string makeBody(size_t size, char seed) {
+    std::string body(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        body[i] = static_cast<char>(seed + i);
+    }
+    return body;
+}
+
+void append(FrameDecoder& decoder, const std::string& bytes) {
+    decoder.append(bytes.data(), bytes.size());
+}
+
+// 把可能分成两段的消息体拼回连续字符串
+std::string bodyOf(const FrameView& frame) {
+    std::string body(frame.first, frame.firstSize);
+    if (frame.secondSize > 0) {
+        body.append(frame.second, frame.secondSize);
+    }
+    return body;
+}
+
+void testPartialHeader() {
+    FrameDecoder decoder(64);
+    std::string body = makeBody(10, 'a');
+    std::string bytes = encodeFrame(body);
+    FrameView frame;
+
+    // 头部逐字节到达，不足4字节时不出帧也不报错
+    for (size_t i = 0; i < FrameDecoder::kHeaderSize; ++i) {
+        CHECK(!decoder.nextFrame(frame));
+        CHECK(!decoder.hasError());
+        append(decoder, bytes.substr(i, 1));
+    }
+    // 头部已读完但消息体不完整
+    append(decoder, bytes.substr(FrameDecoder::kHeaderSize, 3));
+    CHECK(!decoder.nextFrame(frame));
+    CHECK(!decoder.hasError());
+
+    append(decoder, bytes.substr(FrameDecoder::kHeaderSize + 3));
+    CHECK(decoder.nextFrame(frame));
+    CHECK(bodyOf(frame) == body);
+    CHECK(!frame.compressed);
+    CHECK(decoder.bufferedBytes() == 0);
+    CHECK(!decoder.nextFrame(frame));
+}
+
+void testEmptyBodyAndBackToBackFrames() {
+    FrameDecoder decoder(64);
+    std::string first = makeBody(5, 'x');
+    std::string second = makeBody(7, 'k');
+    append(decoder, encodeFrame(first) + encodeFrame(std::string()) + encodeFrame(second));
+
+    FrameView frame;
+    CHECK(decoder.nextFrame(frame));
+    CHECK(bodyOf(frame) == first);
+    CHECK(decoder.nextFrame(frame));
+    CHECK(frame.size() == 0);
+    CHECK(decoder.nextFrame(frame));
+    CHECK(bodyOf(frame) == second);
+    CHECK(!decoder.nextFrame(frame));
+}
+
+void testFrameSplitAcrossWrap() {
+    // 先出一帧把读游标推到 offset，再写入下一帧，使其头部或消息体跨越缓冲区末尾。
+    // 缓冲的数据始终放得下，不会扩容，读游标也不会因缓冲区清空而回到起点
+    const size_t kCapacity = 64;
+    const std::string body = makeBody(20, 'A');
+    const std::string next = encodeFrame(body);
+    int wrappedBodies = 0;
+    int wrappedHeaders = 0;
+
+    for (size_t offset = FrameDecoder::kHeaderSize; offset < kCapacity; ++offset) {
+        FrameDecoder decoder(kCapacity);
+        std::string leading = makeBody(offset - FrameDecoder::kHeaderSize, 'z');
+        append(decoder, encodeFrame(leading) + next.substr(0, 1));
+
+        FrameView frame;
+        CHECK(decoder.nextFrame(frame));
+        CHECK(bodyOf(frame) == leading);
+
+        append(decoder, next.substr(1));
+        CHECK(decoder.capacity() == kCapacity);
+        CHECK(decoder.nextFrame(frame));
+        CHECK(bodyOf(frame) == body);
+        CHECK(!decoder.hasError());
+        if (!frame.isContiguous()) {
+            ++wrappedBodies;
+            CHECK(frame.second != nullptr);
+            CHECK(frame.firstSize + frame.secondSize == body.size());
+        }
+        if (offset + FrameDecoder::kHeaderSize > kCapacity) {
+            ++wrappedHeaders;
+        }
+    }
+    CHECK(wrappedBodies > 0);
+    CHECK(wrappedHeaders > 0);
+}
+
+void testGrowBeyondInitialCapacity() {
+    FrameDecoder decoder(64);
+    std::string body = makeBody(300, 'q');
+    append(decoder, encodeFrame(body));
+
+    FrameView frame;
+    CHECK(decoder.capacity() >= body.size() + FrameDecoder::kHeaderSize);
+    CHECK(decoder.nextFrame(frame));
+    CHECK(frame.isContiguous());
+    CHECK(bodyOf(frame) == body);
+}
+
+void testCompressedFlag() {
+    FrameDecoder decoder(64);
+    std::string compressed = makeBody(9, 'c');
+    std::string plain = makeBody(4, 'p');
+    append(decoder, encodeFrame(compressed, true) + encodeFrame(plain));
+
+    // 压缩标记只影响 compressed，不计入消息体长度
+    FrameView frame;
+    CHECK(decoder.nextFrame(frame));
+    CHECK(frame.compressed);
+    CHECK(bodyOf(frame) == compressed);
+    CHECK(decoder.nextFrame(frame));
+    CHECK(!frame.compressed);
+    CHECK(bodyOf(frame) == plain);
+}
+
+void testOversizeLength() {
+    const size_t kMaxFrame = 100;
+
+    // 恰好等于上限的帧可以正常解出
+    {
+        FrameDecoder decoder(64, kMaxFrame);
+        std::string body = makeBody(kMaxFrame, 'm');
+        append(decoder, encodeFrame(body, true));
+        FrameView frame;
+        CHECK(decoder.nextFrame(frame));
+        CHECK(frame.compressed);
+        CHECK(bodyOf(frame) == body);
+        CHECK(!decoder.hasError());
+    }
+
+    // 只收到头部就能判定超长，不等消息体到达
+    {
+        FrameDecoder decoder(64, kMaxFrame);
+        append(decoder, encodeHeader(kMaxFrame + 1));
+        FrameView frame;
+        CHECK(!decoder.nextFrame(frame));
+        CHECK(decoder.hasError());
+        // 出错后不再出帧，直到 reset
+        append(decoder, encodeFrame(makeBody(3, 'r')));
+        CHECK(!decoder.nextFrame(frame));
+        CHECK(decoder.hasError());
+
+        decoder.reset();
+        CHECK(!decoder.hasError());
+        CHECK(decoder.bufferedBytes() == 0);
+        std::string body = makeBody(3, 'r');
+        append(decoder, encodeFrame(body));
+        CHECK(decoder.nextFrame(frame));
+        CHECK(bodyOf(frame) == body);
+    }
+
+    // 31位长度字段的最大值同样超长，压缩标记不会被当作长度
+    {
+        FrameDecoder decoder(64, kMaxFrame);
+        append(decoder, encodeHeader(~FrameDecoder::kCompressedFlag, true));
+        FrameView frame;
+        CHECK(!decoder.nextFrame(frame));
+        CHECK(decoder.hasError());
+    }
+}
+}
+
+int main()
+{
+    testPartialHeader();
+    testEmptyBodyAndBackToBackFrames();
+    testFrameSplitAcrossWrap();
+    testGrowBeyondInitialCapacity();
+    testCompressedFlag();
+    testOversizeLength();
+    return testResult("framedecoder_test");
+}
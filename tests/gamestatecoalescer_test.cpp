@@ -0,0 +1,149 @@
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <string>
+#include <vector>
+#include "gamestatecoalescer.h"
+#include "testcheck.h"
+
+// 游戏状态合并器的单元测试：同一轮事件循环内的更新合并成一次输出，日志按顺序拼接，
+// 输出间隔不短于一帧。合并依赖 Qt 的定时器，需要事件循环。
+namespace {
+struct Emissions {
+    int count = 0;
+    std::vector<std::string> logs;
+    const sanguosha::GameState* lastState = nullptr;
+};
+
+void connectRecorder(GameStateCoalescer& coalescer, Emissions* emissions) {
+    QObject::connect(&coalescer, &GameStateCoalescer::gameStateReady,
+                     [emissions](const sanguosha::GameState& state) {
+        ++emissions->count;
+        emissions->logs.push_back(state.game_log());
+        emissions->lastState = &state;
+    });
+}
+
+void runEventLoop(int ms) {
+    QEventLoop loop;
+    QTimer::singleShot(ms, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+void testBurstCoalescedIntoOneUpdate() {
+    sanguosha::GameState state;
+    GameStateCoalescer coalescer;
+    coalescer.setState(&state);
+    Emissions emissions;
+    connectRecorder(coalescer, &emissions);
+
+    coalescer.markDirty("first");
+    coalescer.markDirty("");          // 没有日志的更新不产生空行
+    coalescer.markDirty("second");
+    coalescer.markDirty("third");
+    CHECK(emissions.count == 0);      // 不在 markDirty 里同步输出
+
+    runEventLoop(50);
+    CHECK(emissions.count == 1);
+    CHECK(emissions.logs.size() == 1 && emissions.logs[0] == "first\nsecond\nthird");
+    CHECK(emissions.lastState == &state);
+
+    // 输出过一次后不会重复输出
+    runEventLoop(50);
+    CHECK(emissions.count == 1);
+}
+
+void testFlushEmitsImmediately() {
+    sanguosha::GameState state;
+    GameStateCoalescer coalescer;
+    coalescer.setState(&state);
+    Emissions emissions;
+    connectRecorder(coalescer, &emissions);
+
+    // 其他类型的消息分发前先 flush，保证状态先于后续消息输出
+    coalescer.markDirty("before game over");
+    coalescer.flush();
+    CHECK(emissions.count == 1);
+    CHECK(emissions.logs[0] == "before game over");
+
+    // 已经输出过的更新不会被定时器再输出一次，没有挂起的更新时 flush 什么也不做
+    runEventLoop(50);
+    coalescer.flush();
+    CHECK(emissions.count == 1);
+}
+
+void testClearDropsPendingUpdates() {
+    sanguosha::GameState state;
+    GameStateCoalescer coalescer;
+    coalescer.setState(&state);
+    Emissions emissions;
+    connectRecorder(coalescer, &emissions);
+
+    coalescer.markDirty("discarded");
+    coalescer.clear();
+    runEventLoop(50);
+    CHECK(emissions.count == 0);
+
+    // 清空的日志不会混进下一次输出
+    coalescer.markDirty("kept");
+    coalescer.flush();
+    CHECK(emissions.count == 1);
+    CHECK(emissions.logs[0] == "kept");
+}
+
+void testNoStateNoOutput() {
+    GameStateCoalescer coalescer;
+    Emissions emissions;
+    connectRecorder(coalescer, &emissions);
+
+    coalescer.markDirty("no state yet");
+    coalescer.flush();
+    runEventLoop(20);
+    CHECK(emissions.count == 0);
+}
+
+void testOutputPacedToFrameInterval() {
+    const int kIntervalMs = 100;
+    sanguosha::GameState state;
+    GameStateCoalescer coalescer;
+    coalescer.setState(&state);
+    coalescer.setFrameInterval(kIntervalMs);
+    Emissions emissions;
+    connectRecorder(coalescer, &emissions);
+
+    coalescer.markDirty("frame 1");
+    coalescer.flush();
+    QElapsedTimer sinceFlush;
+    sinceFlush.start();
+
+    // 距上次输出不到一帧，更新等到下一帧才输出
+    coalescer.markDirty("frame 2");
+    runEventLoop(10);
+    if (sinceFlush.elapsed() < kIntervalMs) {
+        CHECK(emissions.count == 1);
+    }
+
+    QElapsedTimer deadline;
+    deadline.start();
+    while (emissions.count < 2 && deadline.elapsed() < 5 * kIntervalMs) {
+        runEventLoop(10);
+    }
+    CHECK(emissions.count == 2);
+    // 默认的粗粒度定时器可能提前最多5%触发
+    CHECK(sinceFlush.elapsed() >= kIntervalMs - kIntervalMs / 10);
+    CHECK(emissions.logs.size() == 2 && emissions.logs[1] == "frame 2");
+}
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    testBurstCoalescedIntoOneUpdate();
+    testFlushEmitsImmediately();
+    testClearDropsPendingUpdates();
+    testNoStateNoOutput();
+    testOutputPacedToFrameInterval();
+    return testResult("gamestatecoalescer_test");
+}
@@ -0,0 +1,237 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <google/protobuf/arena.h>
+#include "gamestatereconstructor.h"
+#include "metrics.h"
+#include "testcheck.h"
+
+// 增量状态重建器的单元测试：应用、缺口、过期三种结果，玩家的增删和手牌替换。
+namespace {
+sanguosha::GameState makeSnapshot(uint64_t version) {
+    sanguosha::GameState state;
+    state.set_version(version);
+    state.set_current_player(1);
+    state.set_phase(sanguosha::DRAW_PHASE);
+    state.set_game_log("snapshot");
+    for (uint32_t id = 1; id <= 3; ++id) {
+        sanguosha::PlayerState* player = state.add_players();
+        player->set_player_id(id);
+        player->set_username("player" + std::to_string(id));
+        player->set_hp(4);
+        player->set_max_hp(4);
+        player->add_hand_cards(sanguosha::CARD_ATTACK);
+        player->add_hand_cards(sanguosha::CARD_DEFEND);
+    }
+    return state;
+}
+
+sanguosha::GameStateDelta makeDelta(uint64_t baseVersion, uint64_t version) {
+    sanguosha::GameStateDelta delta;
+    delta.set_base_version(baseVersion);
+    delta.set_version(version);
+    return delta;
+}
+
+const sanguosha::PlayerState* findPlayer(const sanguosha::GameState& state, uint32_t playerId) {
+    for (const sanguosha::PlayerState& player : state.players()) {
+        if (player.player_id() == playerId) {
+            return &player;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<uint32_t> handOf(const sanguosha::PlayerState& player) {
+    return std::vector<uint32_t>(player.hand_cards().begin(), player.hand_cards().end());
+}
+
+// 计数器是进程内共享的，各测试只比较前后差值
+uint64_t counterValue(const char* name) {
+    return MetricsRegistry::instance().counter(name).value();
+}
+
+void testDeltaBeforeSnapshotIsGap() {
+    GameStateReconstructor reconstructor;
+    const uint64_t gaps = counterValue("net.delta_gaps");
+    CHECK(!reconstructor.hasSnapshot());
+    CHECK(reconstructor.applyDelta(makeDelta(0, 1)) == GameStateReconstructor::Result::Gap);
+    CHECK(counterValue("net.delta_gaps") == gaps + 1);
+}
+
+void testAppliedDelta() {
+    GameStateReconstructor reconstructor;
+    const uint64_t applied = counterValue("net.deltas_applied");
+    sanguosha::GameState snapshot = makeSnapshot(10);
+    reconstructor.applySnapshot(&snapshot);
+    CHECK(reconstructor.hasSnapshot());
+    CHECK(!reconstructor.referencesSnapshot());
+    CHECK(reconstructor.version() == 10);
+
+    sanguosha::GameStateDelta delta = makeDelta(10, 11);
+    delta.set_current_player(2);
+    delta.set_phase(sanguosha::PLAY_PHASE);
+    delta.set_game_log("player1 attacks");
+    delta.set_acked_sequence(7);
+    sanguosha::PlayerStateDelta* changed = delta.add_players();
+    changed->set_player_id(2);
+    changed->set_hp(3);
+    // 只带变化的字段：没有 username / max_hp 时保留原值
+    CHECK(reconstructor.applyDelta(delta) == GameStateReconstructor::Result::Applied);
+
+    const sanguosha::GameState& state = reconstructor.state();
+    CHECK(state.version() == 11);
+    CHECK(state.current_player() == 2);
+    CHECK(state.phase() == sanguosha::PLAY_PHASE);
+    CHECK(state.game_log() == "player1 attacks");
+    CHECK(state.acked_sequence() == 7);
+    const sanguosha::PlayerState* player = findPlayer(state, 2);
+    CHECK(player && player->hp() == 3);
+    CHECK(player && player->max_hp() == 4);
+    CHECK(player && player->username() == "player2");
+    CHECK(player && player->hand_cards_size() == 2);
+    CHECK(counterValue("net.deltas_applied") == applied + 1);
+
+    // 没有变化的字段和其他玩家保持不变，日志不在快照中累积
+    sanguosha::GameStateDelta quiet = makeDelta(11, 12);
+    CHECK(reconstructor.applyDelta(quiet) == GameStateReconstructor::Result::Applied);
+    CHECK(reconstructor.state().current_player() == 2);
+    CHECK(reconstructor.state().game_log().empty());
+    CHECK(reconstructor.state().players_size() == 3);
+}
+
+void testHandCardsChanged() {
+    GameStateReconstructor reconstructor;
+    sanguosha::GameState snapshot = makeSnapshot(1);
+    reconstructor.applySnapshot(&snapshot);
+
+    // hand_cards_changed 为 false 时忽略 hand_cards
+    sanguosha::GameStateDelta ignored = makeDelta(1, 2);
+    sanguosha::PlayerStateDelta* player = ignored.add_players();
+    player->set_player_id(1);
+    player->add_hand_cards(sanguosha::CARD_HEAL);
+    CHECK(reconstructor.applyDelta(ignored) == GameStateReconstructor::Result::Applied);
+    CHECK(handOf(*findPlayer(reconstructor.state(), 1))
+          == std::vector<uint32_t>({ sanguosha::CARD_ATTACK, sanguosha::CARD_DEFEND }));
+
+    // 为 true 时整体替换
+    sanguosha::GameStateDelta replaced = makeDelta(2, 3);
+    player = replaced.add_players();
+    player->set_player_id(1);
+    player->set_hand_cards_changed(true);
+    player->add_hand_cards(sanguosha::CARD_HEAL);
+    player->add_hand_cards(sanguosha::CARD_HEAL);
+    CHECK(reconstructor.applyDelta(replaced) == GameStateReconstructor::Result::Applied);
+    CHECK(handOf(*findPlayer(reconstructor.state(), 1))
+          == std::vector<uint32_t>({ sanguosha::CARD_HEAL, sanguosha::CARD_HEAL }));
+
+    // 为 true 且列表为空表示手牌打光
+    sanguosha::GameStateDelta emptied = makeDelta(3, 4);
+    player = emptied.add_players();
+    player->set_player_id(1);
+    player->set_hand_cards_changed(true);
+    CHECK(reconstructor.applyDelta(emptied) == GameStateReconstructor::Result::Applied);
+    CHECK(findPlayer(reconstructor.state(), 1)->hand_cards_size() == 0);
+}
+
+void testAddAndRemovePlayers() {
+    GameStateReconstructor reconstructor;
+    sanguosha::GameState snapshot = makeSnapshot(5);
+    reconstructor.applySnapshot(&snapshot);
+
+    sanguosha::GameStateDelta delta = makeDelta(5, 6);
+    sanguosha::PlayerStateDelta* joined = delta.add_players();
+    joined->set_player_id(9);
+    joined->set_username("newcomer");
+    joined->set_hp(3);
+    delta.add_removed_players(2);
+    delta.add_removed_players(42); // 不存在的玩家直接忽略
+    CHECK(reconstructor.applyDelta(delta) == GameStateReconstructor::Result::Applied);
+
+    const sanguosha::GameState& state = reconstructor.state();
+    CHECK(state.players_size() == 3);
+    CHECK(findPlayer(state, 2) == nullptr);
+    const sanguosha::PlayerState* player = findPlayer(state, 9);
+    CHECK(player && player->username() == "newcomer" && player->hp() == 3);
+    // 其余玩家保持座位顺序
+    CHECK(state.players(0).player_id() == 1);
+    CHECK(state.players(1).player_id() == 3);
+}
+
+void testStaleDelta() {
+    GameStateReconstructor reconstructor;
+    const uint64_t gaps = counterValue("net.delta_gaps");
+    const uint64_t applied = counterValue("net.deltas_applied");
+    sanguosha::GameState snapshot = makeSnapshot(20);
+    reconstructor.applySnapshot(&snapshot);
+
+    // 重复或更早的增量被忽略，不算缺口
+    sanguosha::GameStateDelta old = makeDelta(18, 19);
+    old.set_current_player(3);
+    CHECK(reconstructor.applyDelta(old) == GameStateReconstructor::Result::Stale);
+    CHECK(reconstructor.applyDelta(makeDelta(19, 20)) == GameStateReconstructor::Result::Stale);
+    CHECK(reconstructor.state().current_player() == 1);
+    CHECK(reconstructor.version() == 20);
+    CHECK(counterValue("net.delta_gaps") == gaps);
+    CHECK(counterValue("net.deltas_applied") == applied);
+    // 没有进入等待快照的状态，下一个连续的增量照常应用
+    CHECK(reconstructor.applyDelta(makeDelta(20, 21)) == GameStateReconstructor::Result::Applied);
+}
+
+void testGapCountedOnce() {
+    GameStateReconstructor reconstructor;
+    const uint64_t gaps = counterValue("net.delta_gaps");
+    sanguosha::GameState snapshot = makeSnapshot(30);
+    reconstructor.applySnapshot(&snapshot);
+
+    // 31 丢失：32、33 都无法应用，但只算一次缺口
+    sanguosha::GameStateDelta skipped = makeDelta(31, 32);
+    skipped.set_current_player(3);
+    CHECK(reconstructor.applyDelta(skipped) == GameStateReconstructor::Result::Gap);
+    CHECK(reconstructor.applyDelta(makeDelta(32, 33)) == GameStateReconstructor::Result::Gap);
+    CHECK(counterValue("net.delta_gaps") == gaps + 1);
+    CHECK(reconstructor.state().current_player() == 1);
+    CHECK(reconstructor.version() == 30);
+
+    // 收到完整快照后恢复，之后的新缺口再计一次
+    sanguosha::GameState recovered = makeSnapshot(33);
+    reconstructor.applySnapshot(&recovered);
+    CHECK(reconstructor.applyDelta(makeDelta(33, 34)) == GameStateReconstructor::Result::Applied);
+    CHECK(reconstructor.applyDelta(makeDelta(35, 36)) == GameStateReconstructor::Result::Gap);
+    CHECK(counterValue("net.delta_gaps") == gaps + 2);
+}
+
+void testArenaSnapshotReferencedInPlace() {
+    google::protobuf::Arena arena;
+    sanguosha::GameState* snapshot = google::protobuf::Arena::CreateMessage<sanguosha::GameState>(&arena);
+    *snapshot = makeSnapshot(40);
+
+    GameStateReconstructor reconstructor;
+    reconstructor.applySnapshot(snapshot);
+    CHECK(reconstructor.referencesSnapshot());
+    CHECK(&reconstructor.state() == snapshot);
+
+    sanguosha::GameStateDelta delta = makeDelta(40, 41);
+    delta.set_current_player(3);
+    CHECK(reconstructor.applyDelta(delta) == GameStateReconstructor::Result::Applied);
+    CHECK(snapshot->current_player() == 3);
+
+    // reset 之后不再引用调用方的快照
+    reconstructor.reset();
+    CHECK(!reconstructor.referencesSnapshot());
+    CHECK(!reconstructor.hasSnapshot());
+    CHECK(reconstructor.applyDelta(makeDelta(41, 42)) == GameStateReconstructor::Result::Gap);
+}
+}
+
+int main()
+{
+    testDeltaBeforeSnapshotIsGap();
+    testAppliedDelta();
+    testHandCardsChanged();
+    testAddAndRemovePlayers();
+    testStaleDelta();
+    testGapCountedOnce();
+    testArenaSnapshotReferencedInPlace();
+    return testResult("gamestatereconstructor_test");
+}
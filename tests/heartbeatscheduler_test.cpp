@@ -0,0 +1,119 @@
+#include "heartbeatscheduler.h"
+#include "testcheck.h"
+
+// 心跳调度策略的单元测试：流量抑制、空闲探测、回显超时和断线判定。
+namespace {
+typedef HeartbeatScheduler::Action Action;
+
+HeartbeatConfig testConfig() {
+    HeartbeatConfig config;
+    config.idleIntervalMs = 1000;
+    config.activeIntervalMs = 200;
+    config.echoTimeoutMs = 100;
+    config.maxMissedEchoes = 3;
+    return config;
+}
+
+void testIntervalFollowsGameState() {
+    HeartbeatScheduler scheduler(testConfig());
+    CHECK(scheduler.currentIntervalMs() == 1000);
+    scheduler.setGameActive(true);
+    CHECK(scheduler.currentIntervalMs() == 200);
+    scheduler.setGameActive(false);
+    CHECK(scheduler.currentIntervalMs() == 1000);
+}
+
+void testIdleConnectionSendsHeartbeat() {
+    HeartbeatScheduler scheduler(testConfig());
+    scheduler.reset(0);
+    CHECK(scheduler.poll(999) == Action::None);
+    CHECK(scheduler.poll(1000) == Action::SendHeartbeat);
+
+    // 回显到达后重新计时
+    scheduler.onHeartbeatSent(1000);
+    CHECK(scheduler.poll(1050) == Action::None);
+    scheduler.onFrameReceived(1060);
+    CHECK(scheduler.poll(1500) == Action::None);
+    CHECK(scheduler.missedEchoes() == 0);
+}
+
+void testTrafficSuppressesHeartbeat() {
+    HeartbeatScheduler scheduler(testConfig());
+    scheduler.setGameActive(true);
+    scheduler.reset(0);
+
+    // 双向都有近期流量时不发心跳，每个周期记一次省略
+    for (int64_t now = 50; now <= 1000; now += 50) {
+        scheduler.onFrameSent(now);
+        scheduler.onFrameReceived(now);
+        CHECK(scheduler.poll(now) == Action::None);
+    }
+    CHECK(scheduler.suppressedHeartbeats() == 5);
+}
+
+void testOneWayTrafficStillProbes() {
+    HeartbeatScheduler scheduler(testConfig());
+    scheduler.setGameActive(true);
+    scheduler.reset(0);
+
+    // 一直在发送但收不到任何数据，仍要探测对端
+    scheduler.onFrameSent(150);
+    CHECK(scheduler.poll(199) == Action::None);
+    CHECK(scheduler.poll(200) == Action::SendHeartbeat);
+
+    // 一直在接收但没有发送，需要保活
+    scheduler.reset(1000);
+    scheduler.onFrameReceived(1150);
+    CHECK(scheduler.poll(1200) == Action::SendHeartbeat);
+}
+
+void testMissedEchoesDeclareLinkDead() {
+    HeartbeatScheduler scheduler(testConfig());
+    scheduler.reset(0);
+    CHECK(scheduler.poll(1000) == Action::SendHeartbeat);
+    scheduler.onHeartbeatSent(1000);
+
+    // 每次回显超时立即再探测，连续3次超时判定断线
+    CHECK(scheduler.poll(1099) == Action::None);
+    CHECK(scheduler.poll(1100) == Action::SendHeartbeat);
+    CHECK(scheduler.missedEchoes() == 1);
+    scheduler.onHeartbeatSent(1100);
+    CHECK(scheduler.poll(1200) == Action::SendHeartbeat);
+    CHECK(scheduler.missedEchoes() == 2);
+    scheduler.onHeartbeatSent(1200);
+    CHECK(scheduler.poll(1300) == Action::LinkDead);
+    CHECK(scheduler.missedEchoes() == 3);
+}
+
+void testLateDataClearsMissedEchoes() {
+    HeartbeatScheduler scheduler(testConfig());
+    scheduler.reset(0);
+    scheduler.onHeartbeatSent(1000);
+    CHECK(scheduler.poll(1100) == Action::SendHeartbeat);
+    scheduler.onHeartbeatSent(1100);
+    CHECK(scheduler.missedEchoes() == 1);
+
+    // 任何数据到达都说明连接存活
+    scheduler.onFrameReceived(1150);
+    CHECK(scheduler.missedEchoes() == 0);
+    CHECK(scheduler.poll(1200) == Action::None);
+
+    // reset 同样清除计数
+    scheduler.onHeartbeatSent(1200);
+    CHECK(scheduler.poll(1300) == Action::SendHeartbeat);
+    scheduler.reset(1300);
+    CHECK(scheduler.missedEchoes() == 0);
+    CHECK(scheduler.poll(1300) == Action::None);
+}
+}
+
+int main()
+{
+    testIntervalFollowsGameState();
+    testIdleConnectionSendsHeartbeat();
+    testTrafficSuppressesHeartbeat();
+    testOneWayTrafficStillProbes();
+    testMissedEchoesDeclareLinkDead();
+    testLateDataClearsMissedEchoes();
+    return testResult("heartbeatscheduler_test");
+}
@@ -0,0 +1,96 @@
+#include "latencystats.h"
+#include "testcheck.h"
+
+// 滚动窗口延迟统计的单元测试。
+namespace {
+void testEmpty() {
+    LatencyStats stats(4);
+    CHECK(stats.isEmpty());
+    LatencySummary summary = stats.summary();
+    CHECK(summary.sampleCount == 0);
+    CHECK(summary.minMs == 0.0);
+    CHECK(summary.p99Ms == 0.0);
+}
+
+void testSummary() {
+    LatencyStats stats(100);
+    // 乱序加入 1..100，分位数按最近秩法取值
+    for (int i = 0; i < 100; ++i) {
+        stats.addSample(static_cast<double>((i * 37) % 100 + 1));
+    }
+    LatencySummary summary = stats.summary();
+    CHECK(!stats.isEmpty());
+    CHECK(summary.sampleCount == 100);
+    CHECK(summary.minMs == 1.0);
+    CHECK(summary.avgMs == 50.5);
+    CHECK(summary.p50Ms == 50.0);
+    CHECK(summary.p99Ms == 99.0);
+    CHECK(summary.lastMs == static_cast<double>((99 * 37) % 100 + 1));
+}
+
+void testSingleSample() {
+    LatencyStats stats(8);
+    stats.addSample(12.5);
+    LatencySummary summary = stats.summary();
+    CHECK(summary.sampleCount == 1);
+    CHECK(summary.minMs == 12.5);
+    CHECK(summary.avgMs == 12.5);
+    CHECK(summary.p50Ms == 12.5);
+    CHECK(summary.p99Ms == 12.5);
+    CHECK(summary.lastMs == 12.5);
+}
+
+void testWindowKeepsRecentSamples() {
+    LatencyStats stats(3);
+    stats.addSample(100.0);
+    stats.addSample(200.0);
+    stats.addSample(1.0);
+    stats.addSample(2.0);
+    stats.addSample(3.0);
+
+    // 窗口只剩最近3个样本，累计样本数仍然包含被挤出的样本
+    LatencySummary summary = stats.summary();
+    CHECK(summary.sampleCount == 5);
+    CHECK(summary.minMs == 1.0);
+    CHECK(summary.avgMs == 2.0);
+    CHECK(summary.p99Ms == 3.0);
+    CHECK(summary.lastMs == 3.0);
+}
+
+void testReset() {
+    LatencyStats stats(4);
+    stats.addSample(5.0);
+    stats.addSample(7.0);
+    stats.reset();
+    CHECK(stats.isEmpty());
+    CHECK(stats.summary().sampleCount == 0);
+
+    // 重置后旧样本不再参与统计
+    stats.addSample(9.0);
+    LatencySummary summary = stats.summary();
+    CHECK(summary.sampleCount == 1);
+    CHECK(summary.minMs == 9.0);
+    CHECK(summary.avgMs == 9.0);
+}
+
+void testZeroWindowHoldsOneSample() {
+    LatencyStats stats(0);
+    stats.addSample(4.0);
+    stats.addSample(6.0);
+    LatencySummary summary = stats.summary();
+    CHECK(summary.sampleCount == 2);
+    CHECK(summary.minMs == 6.0);
+    CHECK(summary.p50Ms == 6.0);
+}
+}
+
+int main()
+{
+    testEmpty();
+    testSummary();
+    testSingleSample();
+    testWindowKeepsRecentSamples();
+    testReset();
+    testZeroWindowHoldsOneSample();
+    return testResult("latencystats_test");
+}
@@ -0,0 +1,68 @@
+#include <set>
+#include "reconnectpolicy.h"
+#include "testcheck.h"
+
+// 重连退避策略的单元测试：指数增长、上限、抖动范围和重置。
+namespace {
+ReconnectConfig testConfig() {
+    ReconnectConfig config;
+    config.initialDelayMs = 100;
+    config.maxDelayMs = 1000;
+    config.multiplier = 2.0;
+    return config;
+}
+
+void testBackoffStaysWithinJitterRange() {
+    const int ceilings[] = { 100, 200, 400, 800, 1000, 1000, 1000 };
+    // 抖动是随机的，多跑几轮检查每次都落在 [上限/2, 上限] 内
+    for (int round = 0; round < 200; ++round) {
+        ReconnectPolicy policy(testConfig());
+        for (int attempt = 0; attempt < 7; ++attempt) {
+            CHECK(policy.attempts() == attempt);
+            int delay = policy.nextDelayMs();
+            CHECK(delay >= ceilings[attempt] / 2);
+            CHECK(delay <= ceilings[attempt]);
+        }
+        CHECK(policy.attempts() == 7);
+    }
+}
+
+void testJitterSpreadsClients() {
+    // 服务器重启后各客户端的第一次重连不应落在同一时刻
+    std::set<int> delays;
+    for (int client = 0; client < 50; ++client) {
+        ReconnectPolicy policy(testConfig());
+        delays.insert(policy.nextDelayMs());
+    }
+    CHECK(delays.size() > 1);
+}
+
+void testResetRestartsBackoff() {
+    ReconnectPolicy policy(testConfig());
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        policy.nextDelayMs();
+    }
+    policy.reset();
+    CHECK(policy.attempts() == 0);
+    int delay = policy.nextDelayMs();
+    CHECK(delay >= 50 && delay <= 100);
+}
+
+void testManyAttemptsStayCapped() {
+    // 失败次数很多时放大倍数的幂不会溢出上限
+    ReconnectPolicy policy(testConfig());
+    for (int attempt = 0; attempt < 2000; ++attempt) {
+        int delay = policy.nextDelayMs();
+        CHECK(delay >= 0 && delay <= 1000);
+    }
+}
+}
+
+int main()
+{
+    testBackoffStaysWithinJitterRange();
+    testJitterSpreadsClients();
+    testResetRestartsBackoff();
+    testManyAttemptsStayCapped();
+    return testResult("reconnectpolicy_test");
+}
@@ -0,0 +1,90 @@
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include "spscqueue.h"
+#include "testcheck.h"
+
+// 单生产者/单消费者队列的单元测试：顺序、节点复用和跨线程传递。
+namespace {
+// 统计存活的元素对象，确认复用节点时旧值被正确覆盖和释放
+struct Tracked {
+    static int alive;
+    uint32_t value;
+    explicit Tracked(uint32_t v) : value(v) { ++alive; }
+    ~Tracked() { --alive; }
+};
+int Tracked::alive = 0;
+
+void testFifoOrder() {
+    SpscQueue<int> queue;
+    int value = -1;
+    CHECK(!queue.pop(value));
+
+    for (int i = 0; i < 5; ++i) {
+        queue.push(i);
+    }
+    for (int i = 0; i < 5; ++i) {
+        CHECK(queue.pop(value));
+        CHECK(value == i);
+    }
+    CHECK(!queue.pop(value));
+}
+
+void testNodesReused() {
+    SpscQueue<std::unique_ptr<Tracked>> queue;
+    std::unique_ptr<Tracked> value;
+    // 交替入队出队，复用的节点里不能残留旧元素
+    for (uint32_t round = 0; round < 1000; ++round) {
+        queue.push(std::unique_ptr<Tracked>(new Tracked(round * 2)));
+        queue.push(std::unique_ptr<Tracked>(new Tracked(round * 2 + 1)));
+        CHECK(queue.pop(value) && value && value->value == round * 2);
+        CHECK(queue.pop(value) && value && value->value == round * 2 + 1);
+        value.reset();
+        CHECK(Tracked::alive == 0);
+    }
+    CHECK(!queue.pop(value));
+
+    // 析构时释放仍在队列中的元素
+    {
+        SpscQueue<std::unique_ptr<Tracked>> pending;
+        pending.push(std::unique_ptr<Tracked>(new Tracked(1)));
+        pending.push(std::unique_ptr<Tracked>(new Tracked(2)));
+        CHECK(Tracked::alive == 2);
+    }
+    CHECK(Tracked::alive == 0);
+}
+
+void testAcrossThreads() {
+    const uint32_t kCount = 200000;
+    SpscQueue<uint32_t> queue;
+    std::thread producer([&queue, kCount]() {
+        for (uint32_t i = 1; i <= kCount; ++i) {
+            queue.push(i);
+        }
+    });
+
+    uint32_t expected = 1;
+    bool ordered = true;
+    while (expected <= kCount) {
+        uint32_t value = 0;
+        if (!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && value == expected;
+        ++expected;
+    }
+    producer.join();
+    CHECK(ordered);
+    uint32_t value = 0;
+    CHECK(!queue.pop(value));
+}
+}
+
+int main()
+{
+    testFifoOrder();
+    testNodesReused();
+    testAcrossThreads();
+    return testResult("spscqueue_test");
+}
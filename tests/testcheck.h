@@ -0,0 +1,30 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <cstdio>
+
+// 单元测试用的极简断言，不依赖第三方测试框架。
+// 失败时打印位置并计数，测试程序最后用 testResult() 作为返回值，ctest 据此判断成败。
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+#define CHECK(condition) \
+    do { \
+        if (!(condition)) { \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+            ++testFailures(); \
+        } \
+    } while (0)
+
+inline int testResult(const char* name) {
+    if (testFailures() > 0) {
+        std::fprintf(stderr, "%s: %d check(s) failed\n", name, testFailures());
+        return 1;
+    }
+    std::printf("%s: all checks passed\n", name);
+    return 0;
+}
+
+#endif // TEST_CHECK_H